@@ -65,13 +65,13 @@ NetworkMessage* Communications::waitMessage(NetworkMessage::Type type_msg, Feder
 
     // Otherwise, wait for a message with same type than expected and with
     // same federate number.
-    msg = NM_Factory::receive(socketTCP);
+    msg = NM_Factory::receive(socketTCP, NM_msgBufReceive);
 
     Debug(D, pdProtocol) << "TCP Message of Type " << static_cast<int>(type_msg) << "has arrived." << std::endl;
 
     while ((msg->getMessageType() != type_msg) || ((numeroFedere != 0) && (msg->getFederate() != numeroFedere))) {
         waitingList.push_back(msg);
-        msg = NM_Factory::receive(socketTCP);
+        msg = NM_Factory::receive(socketTCP, NM_msgBufReceive);
         Debug(D, pdProtocol) << "Message of Type " << static_cast<int>(type_msg) << " has arrived." << std::endl;
     }
 
@@ -80,11 +80,8 @@ NetworkMessage* Communications::waitMessage(NetworkMessage::Type type_msg, Feder
     return msg;
 }
 
-Communications::Communications(int RTIA_port, int RTIA_fd)
+Communications::Communications(int RTIA_port, int RTIA_fd, const std::string& shm_channel)
 {
-    char nom_serveur_RTIG[200];
-    const char* default_host = "localhost";
-
     socketUN = new SocketUN();
 #ifdef FEDERATION_USES_MULTICAST
     socketMC = new SocketMC();
@@ -99,17 +96,43 @@ Communications::Communications(int RTIA_port, int RTIA_fd)
 #endif
     socketUDP = new SocketUDP();
 
+    try {
+        createLinks(RTIA_port, RTIA_fd, shm_channel);
+    }
+    catch (...) {
+        // Close the federate link too, so that a federate running us as a thread sees we are gone
+        delete socketUN;
+#ifdef FEDERATION_USES_MULTICAST
+        delete socketMC;
+#endif
+        delete socketTCP;
+        delete socketUDP;
+        throw;
+    }
+}
+
+void Communications::createLinks(int RTIA_port, int RTIA_fd, const std::string& shm_channel)
+{
+    char nom_serveur_RTIG[200];
+    const char* default_host = "localhost";
+
     // Federate/RTIA link creation.
     if (0 <= RTIA_fd) {
         socketUN->setSocketFD(RTIA_fd);
     }
     else if (0 <= RTIA_port) {
-        if (socketUN->connectUN(RTIA_port) == -1)
-            exit(EXIT_FAILURE);
+        if (socketUN->connectUN(RTIA_port) == -1) {
+            throw NetworkError("Cannot connect to the federate");
+        }
     }
     else {
-        exit(EXIT_FAILURE);
+        throw NetworkError("No link to the federate");
+    }
+#ifndef _WIN32
+    if (!shm_channel.empty()) {
+        socketUN->useSharedMemory(shm_channel, false);
     }
+#endif
 
     // RTIG TCP link creation.
     const char* certihost = NULL;
@@ -136,6 +159,7 @@ Communications::Communications(int RTIA_port, int RTIA_fd)
 
     socketTCP->createConnection(certihost, atoi(tcp_port));
     socketUDP->createConnection(certihost, atoi(udp_port));
+    socketUDP->setFallback(socketTCP);
 }
 
 Communications::~Communications()
@@ -164,10 +188,55 @@ void Communications::requestFederateService(Message* req)
     assert(req != NULL);
     Debug(D, pdRequest) << "Sending Request to Federate, Name " << req->getMessageName() << ", Type "
                         << req->getMessageType() << std::endl;
+    if (batching) {
+        msgBufSend.reset();
+        req->serialize(msgBufSend);
+        msgBufSend.updateReservedBytes();
+        const unsigned char* bytes = static_cast<unsigned char*>(msgBufSend(0));
+        batch.insert(batch.end(), bytes, bytes + msgBufSend.size());
+        ++batchCount;
+        return;
+    }
     req->send(socketUN, msgBufSend);
     // G.Out(pdGendoc,"exit  Communications::requestFederateService");
 }
 
+void Communications::startBatch()
+{
+    batching = true;
+}
+
+void Communications::sendBatch()
+{
+    batching = false;
+    if (batch.empty()) {
+        return;
+    }
+
+    Debug(D, pdRequest) << "Sending " << batchCount << " messages to Federate, " << batch.size() << " bytes"
+                        << std::endl;
+    // Reset first, a failed send must not be replayed by the next batch
+    std::vector<unsigned char> bytes;
+    bytes.swap(batch);
+    batchCount = 0;
+
+    socketUN->send(bytes.data(), bytes.size());
+
+    // Keep the memory for the next batches
+    bytes.clear();
+    batch.swap(bytes);
+}
+
+uint32_t Communications::getBatchCount() const
+{
+    return batchCount;
+}
+
+uint32_t Communications::getBatchBytes() const
+{
+    return static_cast<uint32_t>(batch.size());
+}
+
 unsigned long Communications::getAddress()
 {
     return socketUDP->getAddr();
@@ -223,19 +292,13 @@ void Communications::readMessage(Communications::ReadResult& n,
     else if (msg_reseau && socketTCP->isDataReady()) {
         // Datas are in TCP waiting buffer.
         // Read a message from RTIG TCP link.
-        *msg_reseau = NM_Factory::receive(socketTCP);
-        n = ReadResult::FromNetwork;
-    }
-    else if (msg_reseau && socketUDP->isDataReady()) {
-        // Datas are in UDP waiting buffer.
-        // Read a message from RTIG UDP link.
-        *msg_reseau = NM_Factory::receive(socketUDP);
+        *msg_reseau = NM_Factory::receive(socketTCP, NM_msgBufReceive);
         n = ReadResult::FromNetwork;
     }
     else if (msg && socketUN->isDataReady()) {
         // Datas are in UNIX waiting buffer.
         // Read a message from federate UNIX link.
-        *msg = M_Factory::receive(socketUN);
+        *msg = M_Factory::receive(socketUN, msgBufReceive);
         n = ReadResult::FromFederate;
     }
     else {
@@ -271,17 +334,17 @@ void Communications::readMessage(Communications::ReadResult& n,
 
         if (FD_ISSET(socketTCP->returnSocket(), &fdset)) {
             // Read a message coming from the TCP link with RTIG.
-            *msg_reseau = NM_Factory::receive(socketTCP);
+            *msg_reseau = NM_Factory::receive(socketTCP, NM_msgBufReceive);
             n = ReadResult::FromNetwork;
         }
         else if (FD_ISSET(socketUDP->returnSocket(), &fdset)) {
-            // Read a message coming from the UDP link with RTIG.
-            *msg_reseau = NM_Factory::receive(socketUDP);
-            n = ReadResult::FromNetwork;
+            // Read a message coming from the UDP link with RTIG, nothing if the datagram was dropped.
+            *msg_reseau = NetworkMessage::receiveDatagram(socketUDP, NM_msgBufReceive);
+            n = *msg_reseau ? ReadResult::FromNetwork : ReadResult::Invalid;
         }
         else if (FD_ISSET(socketUN->returnSocket(), &fdset)) {
             // Read a message coming from the federate.
-            *msg = M_Factory::receive(socketUN);
+            *msg = M_Factory::receive(socketUN, msgBufReceive);
             n = ReadResult::FromFederate;
         }
         else {
@@ -316,6 +379,11 @@ void Communications::sendMessage(NetworkMessage* Msg)
     Msg->send(socketTCP, NM_msgBufSend);
 }
 
+void Communications::sendBestEffort(NetworkMessage* Msg)
+{
+    Msg->send(socketUDP, NM_msgBufSend);
+}
+
 void Communications::sendUN(Message* Msg)
 {
     Msg->send(socketUN, msgBufSend);
@@ -323,7 +391,7 @@ void Communications::sendUN(Message* Msg)
 
 Message* Communications::receiveUN()
 {
-    Message* msg = M_Factory::receive(socketUN);
+    Message* msg = M_Factory::receive(socketUN, msgBufReceive);
     return msg;
 }
 }
@@ -24,6 +24,8 @@
 #define _CERTI_COMMUNICATIONS_HH
 
 #include <list>
+#include <string>
+#include <vector>
 
 #include <include/certi.hh>
 
@@ -48,7 +50,12 @@ public:
     
     enum class ReadResult { Invalid, FromNetwork, FromFederate, Timeout };
     
-    Communications(int RTIA_port, int RTIA_fd);
+    /**
+     * @param[in] RTIA_port TCP port of the federate, used if RTIA_fd is negative
+     * @param[in] RTIA_fd socket connected to the federate
+     * @param[in] shm_channel shared memory channel created by the federate, if not empty
+     */
+    Communications(int RTIA_port, int RTIA_fd, const std::string& shm_channel);
     ~Communications();
 
     /**
@@ -57,6 +64,13 @@ public:
      */
     void sendMessage(NetworkMessage* Msg);
 
+    /**
+     * Send a message to RTIG as a datagram, which may be lost.
+     * A message too large for a datagram is sent through TCP instead.
+     * @param[in] Msg the message to be sent
+     */
+    void sendBestEffort(NetworkMessage* Msg);
+
     /** Send a message to RTIA.
      * FIXME Historically those messages were sent to Unix Socket thus the 'UN'.
      * @param[in] Msg the message to be sent
@@ -82,6 +96,21 @@ public:
     void readMessage(Communications::ReadResult& n, NetworkMessage** msg_reseau, Message** msg, struct timeval* timeout);
 
     void requestFederateService(Message* req);
+
+    /** Keep the messages requested to the federate until sendBatch is called.
+     * They are then sent at once, which the federate cannot tell from separate sends.
+     */
+    void startBatch();
+
+    /// Send the messages kept since startBatch, and send further messages right away.
+    void sendBatch();
+
+    /// Number of messages kept since startBatch.
+    uint32_t getBatchCount() const;
+
+    /// Size of the messages kept since startBatch, in bytes.
+    uint32_t getBatchBytes() const;
+
     unsigned long getAddress();
     unsigned int getPort();
 
@@ -96,8 +125,14 @@ public:
 protected:
     MessageBuffer NM_msgBufSend;
     MessageBuffer msgBufSend;
+    MessageBuffer NM_msgBufReceive;
+    MessageBuffer msgBufReceive;
 
     SocketUN* socketUN;
+
+    bool batching{false};
+    uint32_t batchCount{0};
+    std::vector<unsigned char> batch;
 #ifdef FEDERATION_USES_MULTICAST
     SocketMC* socketMC;
 #endif
@@ -105,6 +140,9 @@ protected:
     SocketUDP* socketUDP;
 
 private:
+    /** Connect to the federate and to the RTIG, @throw NetworkError if one of them fails. */
+    void createLinks(int RTIA_port, int RTIA_fd, const std::string& shm_channel);
+
     /** This is the wait list of message already received from RTIG
      * but not yet dispatched. We need a wait list because we may
      * receive messages while waiting for some particular [other] messages.
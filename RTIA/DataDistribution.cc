@@ -121,7 +121,7 @@ void DataDistribution::modifyRegion(RegionHandle handle, const std::vector<Exten
     Debug(D, pdDebug) << "Modify region " << handle << "..." << endl;
 
     // check region
-    RTIRegion* region = rootObject->getRegion(handle);
+    rootObject->getRegion(handle);
 
     // Request to RTIG
     NM_DDM_Modify_Region req;
@@ -136,7 +136,7 @@ void DataDistribution::modifyRegion(RegionHandle handle, const std::vector<Exten
     e = rep->getException();
 
     if (e == Exception::Type::NO_EXCEPTION) {
-        region->replaceExtents(extents);
+        rootObject->modifyRegion(handle, extents);
         Debug(D, pdDebug) << "Modified region " << handle << endl;
     }
 }
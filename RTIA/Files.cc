@@ -54,22 +54,7 @@ NetworkMessage* Queues::giveFifoMessage(bool& gave_msg, bool& has_remaining_msg)
 
 void Queues::insertTsoMessage(NetworkMessage* msg)
 {
-    if (tsos.empty()) {
-        tsos.push_front(msg);
-        return;
-    }
-    else {
-        for (auto i = tsos.begin(); i != tsos.end(); ++i) {
-            // stricly greater because we want to place new message behind
-            // older ones with same logical time and thus keep receive order
-            // in list.
-            if ((*i)->getDate() > msg->getDate()) {
-                tsos.insert(i, msg);
-                return;
-            }
-        }
-    }
-    tsos.push_back(msg);
+    tsos.push(TsoEntry{msg->getDate(), tsoSequence++, msg});
 }
 
 NetworkMessage* Queues::giveTsoMessage(FederationTime logical_time, bool& gave_msg, bool& has_remaining_msg)
@@ -78,17 +63,15 @@ NetworkMessage* Queues::giveTsoMessage(FederationTime logical_time, bool& gave_m
     has_remaining_msg = false;
 
     if (!tsos.empty()) {
-        auto msg = tsos.front();
-        if (msg->getDate() <= logical_time) {
-            // remove from list but keep pointer to execute ExecuterServiceFedere.
-            tsos.pop_front();
+        auto msg = tsos.top().msg;
+        if (tsos.top().date <= logical_time) {
+            // remove from queue but keep pointer to execute ExecuterServiceFedere.
+            tsos.pop();
             gave_msg = true;
 
             // Test if next TSO message can be sent.
             if (!tsos.empty()) {
-                auto next_msg = tsos.front();
-
-                has_remaining_msg = (next_msg->getDate() <= logical_time);
+                has_remaining_msg = (tsos.top().date <= logical_time);
             }
             return msg;
         }
@@ -99,16 +82,13 @@ NetworkMessage* Queues::giveTsoMessage(FederationTime logical_time, bool& gave_m
 
 void Queues::nextTsoDate(bool& found, FederationTime& logical_time)
 {
-    NetworkMessage* msg_buffer;
-
     if (tsos.empty()) {
         found = false;
         logical_time = -1.0;
     }
     else {
-        msg_buffer = tsos.front();
         found = true;
-        logical_time = msg_buffer->getDate();
+        logical_time = tsos.top().date;
     }
 }
 
@@ -23,8 +23,11 @@
 #ifndef CERTI_RTIA_FILES_HH
 #define CERTI_RTIA_FILES_HH
 
+#include <cstdint>
 #include <list>
+#include <queue>
 #include <stdlib.h>
+#include <vector>
 
 #include "DeclarationManagement.hh"
 #include "FederationManagement.hh"
@@ -48,7 +51,9 @@ public:
     NetworkMessage* giveFifoMessage(bool& gave_msg, bool& has_remaining_msg);
 
     // File TSO(Time Stamp Order)
-    /// TSO list is sorted by message logical time.
+    /** TSO queue is sorted by message logical time, messages with the same
+     * logical time are kept in receive order. Logarithmic.
+     */
     void insertTsoMessage(NetworkMessage* msg);
 
     /** 'heure_logique' is the minimum value between current LBTS and current
@@ -77,9 +82,28 @@ public:
     ObjectManagement* om;
 
 private:
+    /// Element of the TSO queue, the sequence number keeps receive order between equal dates.
+    struct TsoEntry {
+        FederationTime date;
+        uint64_t sequence;
+        NetworkMessage* msg;
+    };
+
+    /// Orders the TSO heap so that the earliest message is on top.
+    struct TsoLater {
+        bool operator()(const TsoEntry& lhs, const TsoEntry& rhs) const
+        {
+            if (lhs.date != rhs.date) {
+                return lhs.date > rhs.date;
+            }
+            return lhs.sequence > rhs.sequence;
+        }
+    };
+
     // Attributes
     std::list<NetworkMessage*> fifos; /// FIFO list.
-    std::list<NetworkMessage*> tsos; /// TSO list.
+    std::priority_queue<TsoEntry, std::vector<TsoEntry>, TsoLater> tsos; /// TSO heap.
+    uint64_t tsoSequence{0}; /// Sequence number of the next TSO message.
     std::list<NetworkMessage*> commands; /// commands list.
 
     /// Call a service on the federate.
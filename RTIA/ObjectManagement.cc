@@ -30,6 +30,8 @@
 #include <libCERTI/InteractionSet.hh>
 #include <libCERTI/M_Classes.hh>
 #include <libCERTI/NM_Classes.hh>
+#include <libCERTI/Object.hh>
+#include <libCERTI/ObjectAttribute.hh>
 #include <libCERTI/ObjectClassSet.hh>
 #include <libCERTI/ObjectSet.hh>
 #include <libCERTI/PrettyDebug.hh>
@@ -55,6 +57,9 @@ const ObjectManagement::OrderTypeList ObjectManagement::orderTypeList[]
 ObjectManagement::ObjectManagement(Communications* GC, FederationManagement* GF, RootObject* theRootObj)
     : comm(GC), fm(GF), rootObject(theRootObj)
 {
+    if (getenv("CERTI_PIPELINED_UPDATES")) {
+        my_pipelined_updates = true;
+    }
 }
 
 ObjectManagement::~ObjectManagement()
@@ -137,11 +142,17 @@ EventRetractionHandle ObjectManagement::updateAttributeValues(ObjectHandle theOb
 
         req.setLabel(theTag);
 
-        comm->sendMessage(&req);
-        std::unique_ptr<NM_Update_Attribute_Values> rep(
-            static_cast<NM_Update_Attribute_Values*>(comm->waitMessage(req.getMessageType(), req.getFederate())));
-        e = rep->getException();
-        evtrHandle = rep->getEvent();
+        if (my_pipelined_updates) {
+            evtrHandle = nextEventRetraction();
+            req.setSequence(startPipelinedRequest());
+            comm->sendMessage(&req);
+        }
+        else {
+            comm->sendMessage(&req);
+            auto rep = waitAnswer(req);
+            e = rep->getException();
+            evtrHandle = rep->getEvent();
+        }
 #ifdef CERTI_USE_NULL_PRIME_MESSAGE_PROTOCOL
         // update the time of the min tx event date
         // this is used per NULL MESSAGE PRIM algorithm
@@ -189,10 +200,23 @@ void ObjectManagement::updateAttributeValues(ObjectHandle theObjectHandle,
 
     req.setLabel(theTag);
 
-    comm->sendMessage(&req);
-    std::unique_ptr<NetworkMessage> rep(comm->waitMessage(req.getMessageType(), req.getFederate()));
+    const bool bestEffort = isBestEffort(theObjectHandle, attribArray, attribArraySize);
+    if (my_pipelined_updates || bestEffort) {
+        // Datagrams are not answered either, their failures come back as the pipelined ones
+        req.setSequence(startPipelinedRequest());
+        if (bestEffort) {
+            comm->sendBestEffort(&req);
+        }
+        else {
+            comm->sendMessage(&req);
+        }
+    }
+    else {
+        comm->sendMessage(&req);
+        auto rep = waitAnswer(req);
 
-    e = rep->getException();
+        e = rep->getException();
+    }
     Debug(G, pdGendoc) << "exit  ObjectManagement::updateAttributeValues without time" << std::endl;
 }
 
@@ -221,58 +245,31 @@ void ObjectManagement::discoverObject(ObjectHandle the_object,
 	 */
 }
 
-void ObjectManagement::reflectAttributeValues(ObjectHandle the_object,
-                                              const std::vector<AttributeHandle>& the_attributes,
-                                              const std::vector<AttributeValue_t>& the_values,
-                                              uint16_t the_size,
-                                              FederationTime the_time,
-                                              const std::string& the_tag,
-                                              EventRetractionHandle the_event,
-                                              Exception::Type& /*e*/)
+void ObjectManagement::reflectAttributeValues(NM_Reflect_Attribute_Values& the_message, Exception::Type& /*e*/)
 {
     M_Reflect_Attribute_Values req;
-    EventRetraction event;
 
-    Debug(G, pdGendoc) << "enter ObjectManagement::reflectAttributeValues with time" << std::endl;
-    req.setObject(the_object);
-    req.setDate(the_time);
-    event.setSN(the_event);
-    req.setEventRetraction(event);
-    req.setTag(the_tag);
-
-    req.setValuesSize(the_size);
-    req.setAttributesSize(the_size);
-    for (int i = 0; i < the_size; ++i) {
-        req.setValues(the_values[i], i);
-        req.setAttributes(the_attributes[i], i);
+    Debug(G, pdGendoc) << "enter ObjectManagement::reflectAttributeValues" << std::endl;
+    req.setObject(the_message.getObject());
+    if (the_message.isDated()) {
+        EventRetraction event;
+        req.setDate(the_message.getDate());
+        event.setSN(the_message.eventRetraction);
+        req.setEventRetraction(event);
     }
-
-    comm->requestFederateService(&req);
-    Debug(G, pdGendoc) << "exit  ObjectManagement::reflectAttributeValues with time" << std::endl;
-}
-
-void ObjectManagement::reflectAttributeValues(ObjectHandle the_object,
-                                              const std::vector<AttributeHandle>& the_attributes,
-                                              const std::vector<AttributeValue_t>& the_values,
-                                              uint16_t the_size,
-                                              const std::string& the_tag,
-                                              Exception::Type& /*e*/)
-{
-    M_Reflect_Attribute_Values req;
-
-    Debug(G, pdGendoc) << "enter ObjectManagement::reflectAttributeValues without time" << std::endl;
-    req.setObject(the_object);
-    req.setTag(the_tag);
-
-    req.setValuesSize(the_size);
-    req.setAttributesSize(the_size);
-    for (int i = 0; i < the_size; ++i) {
-        req.setValues(the_values[i], i);
-        req.setAttributes(the_attributes[i], i);
+    req.setTag(the_message.getLabel());
+
+    // Values may be large, they are handed over rather than copied
+    const uint32_t size = the_message.getAttributesSize();
+    req.setValuesSize(size);
+    req.setAttributesSize(size);
+    for (uint32_t i = 0; i < size; ++i) {
+        req.getValues(i).swap(the_message.getValues(i));
+        req.setAttributes(the_message.getAttributes(i), i);
     }
 
     comm->requestFederateService(&req);
-    Debug(G, pdGendoc) << "exit  ObjectManagement::reflectAttributeValues without time" << std::endl;
+    Debug(G, pdGendoc) << "exit  ObjectManagement::reflectAttributeValues" << std::endl;
 }
 
 EventRetractionHandle ObjectManagement::sendInteraction(InteractionClassHandle theInteraction,
@@ -309,12 +306,18 @@ EventRetractionHandle ObjectManagement::sendInteraction(InteractionClassHandle t
 
         req.setLabel(theTag);
 
-        // Send network message and then wait for answer.
-        comm->sendMessage(&req);
-        std::unique_ptr<NetworkMessage> rep(
-            comm->waitMessage(NetworkMessage::Type::SEND_INTERACTION, req.getFederate()));
-        e = rep->getException();
-        evtrHandle = rep->eventRetraction;
+        if (my_pipelined_updates) {
+            evtrHandle = nextEventRetraction();
+            req.setSequence(startPipelinedRequest());
+            comm->sendMessage(&req);
+        }
+        else {
+            // Send network message and then wait for answer.
+            comm->sendMessage(&req);
+            auto rep = waitAnswer(req);
+            e = rep->getException();
+            evtrHandle = rep->eventRetraction;
+        }
 #ifdef CERTI_USE_NULL_PRIME_MESSAGE_PROTOCOL
         // update the time of the min tx event date
         // this is used per NULL MESSAGE PRIM algorithm
@@ -357,11 +360,109 @@ void ObjectManagement::sendInteraction(InteractionClassHandle theInteraction,
 
     req.setLabel(theTag);
 
-    // Send network message and then wait for answer.
-    comm->sendMessage(&req);
-    std::unique_ptr<NetworkMessage> rep(comm->waitMessage(NetworkMessage::Type::SEND_INTERACTION, req.getFederate()));
+    const bool bestEffort = isBestEffort(theInteraction);
+    if (my_pipelined_updates || bestEffort) {
+        // Datagrams are not answered either, their failures come back as the pipelined ones
+        req.setSequence(startPipelinedRequest());
+        if (bestEffort) {
+            comm->sendBestEffort(&req);
+        }
+        else {
+            comm->sendMessage(&req);
+        }
+    }
+    else {
+        // Send network message and then wait for answer.
+        comm->sendMessage(&req);
+        auto rep = waitAnswer(req);
 
-    e = rep->getException();
+        e = rep->getException();
+    }
+}
+
+void ObjectManagement::pipelinedRequestFailed(uint32_t sequence, Exception::Type exception, const std::string& reason)
+{
+    Debug(D, pdExcept) << "Pipelined request " << sequence << " failed: " << static_cast<int>(exception) << " - "
+                       << reason << std::endl;
+    my_pipelined_failures.push_back({sequence, exception, reason});
+}
+
+bool ObjectManagement::takePipelinedFailure(PipelinedFailure& failure)
+{
+    if (my_pipelined_failures.empty()) {
+        return false;
+    }
+    failure = std::move(my_pipelined_failures.front());
+    my_pipelined_failures.pop_front();
+    return true;
+}
+
+uint32_t ObjectManagement::startPipelinedRequest()
+{
+    // The sequence numbers count from 1, 0 is skipped when they wrap around
+    if (++my_last_sequence == 0) {
+        ++my_last_sequence;
+    }
+    return my_last_sequence;
+}
+
+EventRetractionHandle ObjectManagement::nextEventRetraction()
+{
+    if (++my_last_event_retraction == 0) {
+        ++my_last_event_retraction;
+    }
+    return my_last_event_retraction;
+}
+
+template <typename T>
+std::unique_ptr<T> ObjectManagement::waitAnswer(T& request)
+{
+    while (true) {
+        std::unique_ptr<T> rep(static_cast<T*>(comm->waitMessage(request.getMessageType(), request.getFederate())));
+        if (!rep->hasSequence()) {
+            return rep;
+        }
+        pipelinedRequestFailed(rep->getSequence(), rep->getException(), rep->getExceptionReason());
+    }
+}
+
+bool ObjectManagement::isBestEffort(ObjectHandle theObjectHandle,
+                                    const std::vector<AttributeHandle>& attribArray,
+                                    uint32_t attribArraySize) const
+{
+#ifdef HLA_USES_UDP
+    if (attribArraySize == 0) {
+        return false;
+    }
+    try {
+        Object* object = rootObject->getObject(theObjectHandle);
+        for (uint32_t i = 0; i < attribArraySize; ++i) {
+            if (object->getAttribute(attribArray[i])->getTransport() != BEST_EFFORT) {
+                return false;
+            }
+        }
+        return true;
+    }
+    catch (Exception&) {
+        return false;
+    }
+#else
+    return false;
+#endif
+}
+
+bool ObjectManagement::isBestEffort(InteractionClassHandle theInteraction) const
+{
+#ifdef HLA_USES_UDP
+    try {
+        return rootObject->getInteractionClass(theInteraction)->transport == BEST_EFFORT;
+    }
+    catch (Exception&) {
+        return false;
+    }
+#else
+    return false;
+#endif
 }
 
 void ObjectManagement::receiveInteraction(InteractionClassHandle the_interaction,
@@ -533,26 +634,44 @@ EventRetractionHandle ObjectManagement::changeAttributeTransportType(ObjectHandl
                                                                      TransportType theType,
                                                                      Exception::Type& e)
 {
-    NM_Change_Attribute_Transport_Type req;
-    uint32_t i;
+    if ((theType != RELIABLE) && (theType != BEST_EFFORT)) {
+        e = Exception::Type::InvalidTransportationHandle;
+        return 0;
+    }
 
-    req.setObject(theObjectHandle);
+    // Every attribute is checked before any is changed
+    Object* object = rootObject->getObject(theObjectHandle);
+    std::vector<ObjectAttribute*> attributes;
+    for (uint32_t i = 0; i < attribArraySize; i++) {
+        attributes.push_back(object->getAttribute(attribArray[i]));
+    }
+
+    // Only the RTIG knows the owners of the attributes
+    NM_Change_Attribute_Transport_Type req;
     req.setFederation(fm->getFederationHandle().get());
     req.setFederate(fm->getFederateHandle());
+    req.setObject(theObjectHandle);
     req.setTransport(theType);
     req.setAttributesSize(attribArraySize);
-
-    for (i = 0; i < attribArraySize; i++)
+    for (uint32_t i = 0; i < attribArraySize; i++) {
         req.setAttributes(attribArray[i], i);
+    }
 
     comm->sendMessage(&req);
-
-    std::unique_ptr<NetworkMessage> rep(
-        comm->waitMessage(NetworkMessage::Type::CHANGE_ATTRIBUTE_TRANSPORT_TYPE, req.getFederate()));
+    std::unique_ptr<NetworkMessage> rep(comm->waitMessage(req.getMessageType(), req.getFederate()));
 
     e = rep->getException();
+    if (e != Exception::Type::NO_EXCEPTION) {
+        return 0;
+    }
 
-    return rep->eventRetraction;
+    for (auto attribute : attributes) {
+        attribute->setTransport(theType);
+    }
+    Debug(D, pdDebug) << "Object " << theObjectHandle << ": transport of " << attribArraySize << " attributes is now "
+                      << (theType == BEST_EFFORT ? "best effort" : "reliable") << std::endl;
+
+    return 0;
 }
 
 EventRetractionHandle ObjectManagement::changeAttributeOrderType(ObjectHandle theObjectHandle,
@@ -586,19 +705,30 @@ EventRetractionHandle ObjectManagement::changeAttributeOrderType(ObjectHandle th
 EventRetractionHandle
 ObjectManagement::changeInteractionTransportType(InteractionClassHandle id, TransportType theType, Exception::Type& e)
 {
-    NM_Change_Interaction_Transport_Type req;
+    if ((theType != RELIABLE) && (theType != BEST_EFFORT)) {
+        e = Exception::Type::InvalidTransportationHandle;
+        return 0;
+    }
 
-    req.setInteractionClass(id);
+    // Only the RTIG knows the publishers of the interaction class
+    NM_Change_Interaction_Transport_Type req;
     req.setFederation(fm->getFederationHandle().get());
     req.setFederate(fm->getFederateHandle());
+    req.setInteractionClass(id);
     req.setTransport(theType);
 
     comm->sendMessage(&req);
-    std::unique_ptr<NetworkMessage> rep(
-        comm->waitMessage(NetworkMessage::Type::CHANGE_INTERACTION_TRANSPORT_TYPE, req.getFederate()));
+    std::unique_ptr<NetworkMessage> rep(comm->waitMessage(req.getMessageType(), req.getFederate()));
+
     e = rep->getException();
+    if (e != Exception::Type::NO_EXCEPTION) {
+        return 0;
+    }
 
-    return rep->eventRetraction;
+    // Throws FederateNotPublishing or InvalidTransportationHandle
+    rootObject->getInteractionClass(id)->changeTransportationType(theType, fm->getFederateHandle());
+
+    return 0;
 }
 
 EventRetractionHandle
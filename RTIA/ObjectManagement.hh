@@ -24,9 +24,15 @@
 #ifndef _CERTI_RTIA_OM
 #define _CERTI_RTIA_OM
 
+#include <deque>
+#include <memory>
+
 #include <libCERTI/RootObject.hh>
 
 namespace certi {
+
+class NM_Reflect_Attribute_Values;
+
 namespace rtia {
 
 class Communications;
@@ -87,21 +93,11 @@ public:
                         EventRetractionHandle the_event,
                         Exception::Type& e);
 
-    void reflectAttributeValues(ObjectHandle the_object,
-                                const std::vector<AttributeHandle>& the_attributes,
-                                const std::vector<AttributeValue_t>& the_values,
-                                uint16_t the_size,
-                                FederationTime the_time,
-                                const std::string& the_tag,
-                                EventRetractionHandle the_event,
-                                Exception::Type& e);
-
-    void reflectAttributeValues(ObjectHandle the_object,
-                                const std::vector<AttributeHandle>& the_attributes,
-                                const std::vector<AttributeValue_t>& the_values,
-                                uint16_t the_size,
-                                const std::string& the_tag,
-                                Exception::Type& e);
+    /** Forward an update received from the RTIG to the federate, with its time if it is dated.
+     * The values are moved to the federate message instead of being copied, the_message is left
+     * without them.
+     */
+    void reflectAttributeValues(NM_Reflect_Attribute_Values& the_message, Exception::Type& e);
 
     EventRetractionHandle sendInteraction(InteractionClassHandle theInteraction,
                                           const std::vector<ParameterHandle>& paramArray,
@@ -156,6 +152,9 @@ public:
 
     void removeObject(ObjectHandle theObject, ObjectRemovalReason theReason, Exception::Type& e);
 
+    /** Change the transport of the updates of object attributes.
+     * Transports are only used to send the updates, so the change is local.
+     */
     EventRetractionHandle changeAttributeTransportType(ObjectHandle theObjectHandle,
                                                        const std::vector<AttributeHandle>& attribArray,
                                                        uint32_t attribArraySize,
@@ -168,6 +167,7 @@ public:
                                                    OrderType theType,
                                                    Exception::Type& e);
 
+    /** Change the transport of the interactions of a class sent by the federate, locally as well. */
     EventRetractionHandle
     changeInteractionTransportType(InteractionClassHandle id, TransportType theType, Exception::Type& e);
 
@@ -238,6 +238,29 @@ public:
                                          const uint16_t attribArraySize,
                                          Exception::Type& e);
 
+    /// Failure of a pipelined update or interaction, as answered by the RTIG.
+    struct PipelinedFailure {
+        uint32_t sequence;
+        Exception::Type exception;
+        std::string reason;
+    };
+
+    /** Record the failure of a pipelined update or interaction.
+     *
+     * The RTIG only answers pipelined requests when they fail. The failures
+     * are kept, in order, until the federate queries them.
+     * @param[in] sequence the sequence number of the failed request
+     * @param[in] exception the exception raised by the RTIG
+     * @param[in] reason the reason of the exception
+     */
+    void pipelinedRequestFailed(uint32_t sequence, Exception::Type exception, const std::string& reason);
+
+    /** Take the oldest failure of a pipelined update or interaction.
+     * @param[out] failure the failure, unchanged if none is pending
+     * @return false if no failure is pending
+     */
+    bool takePipelinedFailure(PipelinedFailure& failure);
+
     // 1516 - 6.3
     void nameReservationSucceeded(const std::string& reservedName);
     void nameReservationFailed(const std::string& reservedName);
@@ -278,6 +301,43 @@ protected:
     RootObject* rootObject;
 
 private:
+    /** Start a pipelined request.
+     * The sequence numbers count the pipelined requests of the federate from 1.
+     * @return the sequence number of the request
+     */
+    uint32_t startPipelinedRequest();
+
+    /// Event retraction handle of a pipelined timestamped request, never 0.
+    EventRetractionHandle nextEventRetraction();
+
+    /** Wait for the RTIG answer to an update or interaction. The failures of
+     * pipelined or best effort requests met meanwhile are recorded.
+     */
+    template <typename T>
+    std::unique_ptr<T> waitAnswer(T& request);
+
+    /** True if a receive order update goes as a datagram, i.e. every attribute is best effort.
+     * Unknown objects or attributes are left to the RTIG to report.
+     */
+    bool isBestEffort(ObjectHandle theObjectHandle,
+                      const std::vector<AttributeHandle>& attribArray,
+                      uint32_t attribArraySize) const;
+
+    /// True if a receive order interaction goes as a datagram.
+    bool isBestEffort(InteractionClassHandle theInteraction) const;
+
+    /// Updates and interactions do not wait for the RTIG answer (CERTI_PIPELINED_UPDATES).
+    bool my_pipelined_updates{false};
+
+    /// Sequence number of the last pipelined request sent.
+    uint32_t my_last_sequence{0};
+
+    /// Last event retraction handle given to a pipelined request.
+    EventRetractionHandle my_last_event_retraction{0};
+
+    /// Failures of pipelined requests not yet reported to the federate.
+    std::deque<PipelinedFailure> my_pipelined_failures;
+
     struct TransportTypeList {
         std::string name;
         TransportType type;
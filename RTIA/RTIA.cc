@@ -26,13 +26,16 @@
 #include <limits.h>
 #include <math.h>
 
+#include <algorithm>
+#include <chrono>
+
 #include "RTIA.hh"
 
 namespace certi {
 namespace rtia {
 
-RTIA::RTIA(int RTIA_port, int RTIA_fd)
-    : comm{RTIA_port, RTIA_fd}
+RTIA::RTIA(int RTIA_port, int RTIA_fd, const std::string& shm_channel)
+    : comm{RTIA_port, RTIA_fd, shm_channel}
     , fm{&comm}
     , om{&comm, &fm, &my_root_object}
     , owm{&comm, &fm}
@@ -79,31 +82,42 @@ void RTIA::execute()
         NetworkMessage* msgFromRTIG{nullptr};
         Communications::ReadResult result{Communications::ReadResult::Invalid};
 
+        // The time state which no NULL message reported in time is sent on its own
+        const auto now = std::chrono::steady_clock::now();
+        tm.sendTimeStateUpdate(now);
+
+        // Wait until the end of a blocking tick() or the next time state deadline, whichever comes first
+        struct timeval timev;
+        struct timeval* timeout{nullptr};
+
+        auto deadline = tm.getTimeStateDeadline();
+        if (tm._tick_state == TimeManagement::TICK_BLOCKING) {
+            deadline = std::min(deadline, tm._tick_deadline);
+        }
+        if (deadline != std::chrono::steady_clock::time_point::max()) {
+            const auto delay = std::max(std::chrono::duration_cast<std::chrono::microseconds>(deadline - now),
+                                        std::chrono::microseconds(0));
+            timev.tv_sec = delay.count() / 1000000;
+            timev.tv_usec = delay.count() % 1000000;
+            timeout = &timev;
+        }
+
         try {
             switch (tm._tick_state) {
             case TimeManagement::NO_TICK:
                 // tick() is not active: block until RTIA or federate message comes
-                comm.readMessage(result, &msgFromRTIG, &msgFromFederate, NULL);
+                comm.readMessage(result, &msgFromRTIG, &msgFromFederate, timeout);
                 break;
 
             case TimeManagement::TICK_BLOCKING:
                 // blocking tick() waits for an event to come: block until RTIA or federate message comes, or timeout expires
-                if (tm._tick_timeout != std::numeric_limits<double>::infinity() && tm._tick_timeout < LONG_MAX) {
-                    struct timeval timev;
-                    timev.tv_sec = int(tm._tick_timeout);
-                    timev.tv_usec = int((tm._tick_timeout - timev.tv_sec) * 1000000.0);
-
-                    comm.readMessage(result, &msgFromRTIG, &msgFromFederate, &timev);
-                }
-                else {
-                    comm.readMessage(result, &msgFromRTIG, &msgFromFederate, NULL);
-                }
+                comm.readMessage(result, &msgFromRTIG, &msgFromFederate, timeout);
                 break;
 
             case TimeManagement::TICK_CALLBACK:
             case TimeManagement::TICK_RETURN:
                 // tick() waits until a federate callback finishes: block until federate message comes RTIA messages are queued in a system queue
-                comm.readMessage(result, NULL, &msgFromFederate, NULL);
+                comm.readMessage(result, NULL, &msgFromFederate, timeout);
                 break;
 
             default:
@@ -132,7 +146,9 @@ void RTIA::execute()
             processFederateRequest(msgFromFederate);
             break;
         case Communications::ReadResult::Timeout:
-            if (tm._tick_state == TimeManagement::TICK_BLOCKING) {
+            // The tick deadline is absolute, waking up for the time state does not restart it
+            if (tm._tick_state == TimeManagement::TICK_BLOCKING
+                && std::chrono::steady_clock::now() >= tm._tick_deadline) {
                 // stop the ongoing tick() operation
                 tm._tick_state = TimeManagement::TICK_RETURN;
                 processOngoingTick();
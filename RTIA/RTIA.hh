@@ -44,7 +44,8 @@ namespace rtia {
  * to communication to/from the RTI.
  * In current CERTI implementation RTIA is a seperate process
  * which is created (forked) when the RTIambassador's federate
- * constructor is called.
+ * constructor is called, or a thread of the federate when
+ * CERTI_RTIA_IN_PROCESS is set (see RTIAThread).
  * RTIA is a reactive process which process Message from federate
  * and NetworkMessage from RTIG.
  */
@@ -53,8 +54,9 @@ public:
     /** RTIA constructor.
      * @param[in] RTIA_port the TCP port used
      * @param[in] RTIA_fd the file descriptor
+     * @param[in] shm_channel the shared memory channel created by the federate, if any
      */
-    RTIA(int RTIA_port, int RTIA_fd);
+    RTIA(int RTIA_port, int RTIA_fd, const std::string& shm_channel = "");
 
     ~RTIA();
 
@@ -97,6 +99,9 @@ private:
     /// RTIA processes the TICK_REQUEST.
     void processOngoingTick();
 
+    /// Evoke the callbacks of the ongoing tick, those of a batch are sent by processOngoingTick.
+    void evokeTickCallbacks();
+
     RootObject my_root_object{};
     libhla::clock::Clock* my_clock{libhla::clock::Clock::getBestClock()};
     Statistics stat;
@@ -0,0 +1,90 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include "RTIAThread.hh"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#ifndef _WIN32
+#include <csignal>
+#endif
+
+#include "RTIA.hh"
+
+namespace certi {
+namespace rtia {
+
+static PrettyDebug D("RTIA_THREAD", __FILE__);
+
+RTIAThread::RTIAThread(int RTIA_port, int RTIA_fd, const std::string& shm_channel)
+    : my_thread{&RTIAThread::run, RTIA_port, RTIA_fd, shm_channel}
+{
+}
+
+RTIAThread::~RTIAThread()
+{
+    if (my_thread.joinable()) {
+        my_thread.join();
+    }
+}
+
+bool RTIAThread::isRequested()
+{
+    const char* value = getenv("CERTI_RTIA_IN_PROCESS");
+    return value && *value && strcmp(value, "0") != 0;
+}
+
+void RTIAThread::run(int RTIA_port, int RTIA_fd, const std::string shm_channel)
+{
+#ifndef _WIN32
+    // Signals are for the threads of the federate, a broken link is seen as an error by the RTIA
+    sigset_t all;
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, nullptr);
+#endif
+
+    Debug(D, pdInit) << "In-process RTIA started" << std::endl;
+    try {
+        RTIA rtia(RTIA_port, RTIA_fd, shm_channel);
+        try {
+            rtia.execute();
+        }
+        catch (Exception& e) {
+            std::cerr << "RTIA:: RTIA has thrown " << e.name() << " exception." << std::endl;
+            if (!e.reason().empty()) {
+                std::cerr << "RTIA:: Reason: " << e.reason() << std::endl;
+            }
+        }
+        rtia.displayStatistics();
+    }
+    catch (Exception& e) {
+        std::cerr << "RTIA:: RTIA has thrown " << e.name() << " exception." << std::endl;
+        if (!e.reason().empty()) {
+            std::cerr << "RTIA:: Reason: " << e.reason() << std::endl;
+        }
+    }
+    Debug(D, pdTerm) << "In-process RTIA ended" << std::endl;
+}
+}
+} // namespace certi/rtia
@@ -0,0 +1,65 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_RTIA_THREAD_HH
+#define CERTI_RTIA_THREAD_HH
+
+#include <string>
+#include <thread>
+
+namespace certi {
+namespace rtia {
+
+/**
+ * RTIA running as a thread of the federate instead of a process of its own.
+ *
+ * libRTI starts it in place of the rtia executable when CERTI_RTIA_IN_PROCESS
+ * is set. The federate and the RTIA exchange the same messages as between
+ * processes, through the shared memory channel if any, which then never
+ * leaves the process.
+ *
+ * The RTIA ends as the process does: once the federate closed the connection,
+ * or when its end of the socket is closed.
+ */
+class RTIAThread {
+public:
+    /** Start the RTIA, the arguments are the ones of the RTIA constructor. */
+    RTIAThread(int RTIA_port, int RTIA_fd, const std::string& shm_channel);
+
+    /** Wait for the end of the RTIA, the federate end of the socket must be closed first. */
+    ~RTIAThread();
+
+    RTIAThread(const RTIAThread&) = delete;
+    RTIAThread& operator=(const RTIAThread&) = delete;
+
+    /** Whether the federate asked for an in-process RTIA. */
+    static bool isRequested();
+
+private:
+    static void run(int RTIA_port, int RTIA_fd, const std::string shm_channel);
+
+    std::thread my_thread;
+};
+}
+} // namespace certi/rtia
+
+#endif // CERTI_RTIA_THREAD_HH
@@ -23,6 +23,8 @@
 #include "RTIA.hh"
 
 #include <assert.h>
+
+#include <chrono>
 #include <memory>
 
 #include <config.h>
@@ -77,6 +79,7 @@ void RTIA::saveAndRestoreStatus(Message::Type type) throw(SaveInProgress, Restor
     case Message::GET_TRANSPORTATION_NAME:
     case Message::GET_ORDERING_HANDLE:
     case Message::GET_ORDERING_NAME:
+    case Message::QUERY_PIPELINED_FAILURE:
         break;
     case Message::FEDERATE_SAVE_BEGUN:
     case Message::FEDERATE_SAVE_COMPLETE:
@@ -253,6 +256,9 @@ void RTIA::chooseFederateProcessing(Message* request, Message* answer, Exception
             JFEr->setFederationExecutionName(JFEq->getFederationExecutionName());
             JFEr->setFederateName(JFEq->getFederateName());
 
+            // So that the federate resolves names and handles by itself
+            my_root_object.getFomNames(*JFEr);
+
             /// Set RTIA PrettyDebug federate name
             PrettyDebug::setFederateName("RTIA::" + JFEq->getFederateName());
         }
@@ -1053,6 +1059,18 @@ void RTIA::chooseFederateProcessing(Message* request, Message* answer, Exception
         GONr->setOrderingName(om.getOrderingName(GONq->getOrdering()));
     } break;
 
+    case Message::QUERY_PIPELINED_FAILURE: {
+        M_Query_Pipelined_Failure* QPFr;
+        QPFr = static_cast<M_Query_Pipelined_Failure*>(answer);
+        Debug(D, pdTrace) << "Message from Federate: queryPipelinedFailure" << std::endl;
+        ObjectManagement::PipelinedFailure failure;
+        if (om.takePipelinedFailure(failure)) {
+            QPFr->setSequence(failure.sequence);
+            QPFr->setFailure(static_cast<uint32_t>(failure.exception));
+            QPFr->setFailureReason(failure.reason);
+        }
+    } break;
+
     case Message::DDM_CREATE_REGION: {
         M_Ddm_Create_Region *DDMCRq, *DDMCRr;
         DDMCRr = static_cast<M_Ddm_Create_Region*>(answer);
@@ -1163,9 +1181,18 @@ void RTIA::chooseFederateProcessing(Message* request, Message* answer, Exception
 
         tm._tick_multiple = TRq->getMultiple();
         tm._tick_result = false; // default return value
+        tm._tick_batch_count = TRq->getBatchCount();
+        tm._tick_batch_bytes = TRq->getBatchBytes();
 
         if (TRq->getMinTickTime() >= 0.0) {
             tm._tick_timeout = TRq->getMinTickTime();
+            // An infinite or too long timeout leaves the tick without deadline
+            const auto now = std::chrono::steady_clock::now();
+            const std::chrono::duration<double> timeout(tm._tick_timeout);
+            tm._tick_deadline = std::chrono::steady_clock::time_point::max();
+            if (timeout < std::chrono::steady_clock::time_point::max() - now) {
+                tm._tick_deadline = now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+            }
             tm._tick_max_tick = TRq->getMaxTickTime();
             tm._tick_clock_start = my_clock->getCurrentTicksValue();
             tm._tick_state = TimeManagement::TICK_BLOCKING;
@@ -1244,8 +1271,28 @@ void RTIA::chooseFederateProcessing(Message* request, Message* answer, Exception
 } /* end of RTIA::chooseFederateProcessing */
 
 void RTIA::processOngoingTick()
+{
+    if (tm._tick_batch_count == 0) {
+        evokeTickCallbacks();
+        return;
+    }
+
+    // The callbacks evoked in one go are sent at once
+    comm.startBatch();
+    try {
+        evokeTickCallbacks();
+    }
+    catch (...) {
+        comm.sendBatch();
+        throw;
+    }
+    comm.sendBatch();
+}
+
+void RTIA::evokeTickCallbacks()
 {
     Exception::Type exc = Exception::Type::NO_EXCEPTION;
+    const bool batching = tm._tick_batch_count > 0;
 
     while (1) {
         switch (tm._tick_state) {
@@ -1267,11 +1314,23 @@ void RTIA::processOngoingTick()
             if (tm._tick_result && tm._tick_multiple
                 && 1e-9 * my_clock->getDeltaNanoSecond(tm._tick_clock_start) < tm._tick_max_tick) {
                 tm._tick_state = TimeManagement::TICK_CALLBACK;
+                if (!batching) {
+                    return;
+                }
+                if (comm.getBatchCount() < tm._tick_batch_count
+                    && (tm._tick_batch_bytes == 0 || comm.getBatchBytes() < tm._tick_batch_bytes)) {
+                    break; // goto TICK_CALLBACK
+                }
+                /* end of the batch, wait for the federate to ask for the next one */
+                M_Tick_Request_Next msg_next;
+                comm.requestFederateService(&msg_next);
+                return;
             }
-            else {
-                tm._tick_state = TimeManagement::TICK_RETURN;
+
+            tm._tick_state = TimeManagement::TICK_RETURN;
+            if (batching) {
+                break; // the batch ends with the TICK_REQUEST response
             }
-            /* Unconditional return */
             return;
 
         case TimeManagement::TICK_CALLBACK:
@@ -1307,7 +1366,7 @@ void RTIA::processOngoingTick()
             break;
         }
     }
-} /* RTIA::processOngoingTick() */
+} /* RTIA::evokeTickCallbacks() */
 
 void RTIA::initFederateProcessing(Message* request, Message* answer)
 {
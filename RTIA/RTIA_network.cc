@@ -466,6 +466,24 @@ void RTIA::processNetworkMessage(NetworkMessage* request)
         break;
     }
 
+    case NetworkMessage::Type::UPDATE_ATTRIBUTE_VALUES: {
+        // Only failed pipelined updates are answered outside of waitMessage
+        auto uav = static_cast<NM_Update_Attribute_Values*>(request);
+        Debug(D, pdTrace) << "Receiving Message from RTIG, type UpdateAttributeValues failure." << std::endl;
+        om.pipelinedRequestFailed(uav->getSequence(), uav->getException(), uav->getExceptionReason());
+        delete request;
+        break;
+    }
+
+    case NetworkMessage::Type::SEND_INTERACTION: {
+        // Only failed pipelined interactions are answered outside of waitMessage
+        auto si = static_cast<NM_Send_Interaction*>(request);
+        Debug(D, pdTrace) << "Receiving Message from RTIG, type SendInteraction failure." << std::endl;
+        om.pipelinedRequestFailed(si->getSequence(), si->getException(), si->getExceptionReason());
+        delete request;
+        break;
+    }
+
     default: {
         Debug(D, pdTrace) << "Receving Message from RTIG, unknown type " << static_cast<int>(msgType) << std::endl;
         delete request;
@@ -39,6 +39,12 @@ static PrettyDebug DNULL("RTIA_NULLMSG", "[RTIA NULL MSG] ");
 static PrettyDebug DTUS("RTIA_TIME_UP", "[RTIA NULL MSG] ");
 
 static constexpr double epsilon2 = 1.0e-4;
+
+bool isSameTimeState(const NM_Time_State& lhs, const NM_Time_State& rhs)
+{
+    return lhs.getTime() == rhs.getTime() && lhs.getLookahead() == rhs.getLookahead()
+        && lhs.getState() == rhs.getState() && lhs.getGalt() == rhs.getGalt() && lhs.getLits() == rhs.getLits();
+}
 }
 
 TimeManagement::TimeManagement(Communications* GC,
@@ -56,7 +62,6 @@ TimeManagement::TimeManagement(Communications* GC,
     , om(GO)
     , owm(GP)
 {
-    sendTimeStateUpdate();
 }
 
 void TimeManagement::timeAdvanceRequest(FederationTime logical_time, Exception::Type& e)
@@ -95,14 +100,15 @@ void TimeManagement::timeAdvanceRequest(FederationTime logical_time, Exception::
         _type_granted_state = AFTER_TAR_OR_NER_WITH_ZERO_LK;
     }
 
+    _avancee_en_cours = TAR;
+    date_avancee = logical_time;
+
+    // The NULL message carries the time state, already advancing
     if (_is_regulating) {
         sendNullMessage(logical_time);
     }
-
-    _avancee_en_cours = TAR;
-    date_avancee = logical_time;
     
-    sendTimeStateUpdate();
+    updateTimeState();
 
     Debug(D, pdTrace) << "timeAdvanceRequest accepted, asked time=" << date_avancee.getTime() << std::endl;
 }
@@ -134,14 +140,15 @@ void TimeManagement::timeAdvanceRequestAvailable(FederationTime logical_time, Ex
     
     _type_granted_state = AFTER_TARA_OR_NERA; // will be
 
+    _avancee_en_cours = TARA;
+    date_avancee = logical_time;
+
+    // The NULL message carries the time state, already advancing
     if (_is_regulating) {
         sendNullMessage(logical_time);
     }
-
-    _avancee_en_cours = TARA;
-    date_avancee = logical_time;
     
-    sendTimeStateUpdate();
+    updateTimeState();
 
     Debug(D, pdTrace) << "timeAdvanceRequestAvailable accepted, asked time=" << date_avancee.getTime() << std::endl;
 }
@@ -186,7 +193,7 @@ void TimeManagement::nextEventRequest(FederationTime logical_time, Exception::Ty
     Debug(D, pdTrace) << "NextEventRequest accepted, lk=" << _lookahead_courant.getTime()
                         << ", date_avance=" << date_avancee.getTime() << std::endl;
 
-    sendTimeStateUpdate();
+    updateTimeState();
 }
 
 void TimeManagement::nextEventRequestAvailable(FederationTime heure_logique, Exception::Type& e)
@@ -220,7 +227,7 @@ void TimeManagement::nextEventRequestAvailable(FederationTime heure_logique, Exc
     sendNullPrimeMessage(heure_logique);
     Debug(D, pdTrace) << "NextEventRequestAvailable accepted." << std::endl;
 
-    sendTimeStateUpdate();
+    updateTimeState();
 }
 
 bool TimeManagement::tick(Exception::Type& e)
@@ -277,7 +284,7 @@ bool TimeManagement::tick(Exception::Type& e)
 
     delete msg;
     
-    sendTimeStateUpdate();
+    updateTimeState();
 
     Debug(G, pdGendoc) << " exit  TimeManagement::tick" << std::endl;
     return moreMsgToHandle;
@@ -340,7 +347,7 @@ void TimeManagement::setLookahead(FederationTimeDelta lookahead, Exception::Type
         sendNullMessage(_heure_courante);
     }
     
-    sendTimeStateUpdate();
+    updateTimeState();
 
     Debug(D, pdRegister) << "New Lookahead : " << _lookahead_courant.getTime() << std::endl;
 }
@@ -431,7 +438,7 @@ void TimeManagement::setTimeRegulating(bool etat,
 
     comm->sendMessage(&msg);
     
-    sendTimeStateUpdate();
+    updateTimeState();
 
     Debug(D, pdRegister) << "Demande de modif de TimeRegulating emise, etat=" << etat << std::endl;
 }
@@ -440,7 +447,7 @@ void TimeManagement::StopperAvanceTemps()
 {
     _avancee_en_cours = PAS_D_AVANCEE;
     
-    sendTimeStateUpdate();
+    updateTimeState();
 };
 
 FederationTime TimeManagement::requestFederationTime()
@@ -504,6 +511,16 @@ bool TimeManagement::requestRegulateurState()
 void TimeManagement::setMomUpdateRate(const std::chrono::seconds updateRate)
 {
     my_updateRate = updateRate;
+
+    // Report the whole state again, the next deadline uses the new period
+    my_reportedTimeState = NM_Time_State();
+    my_timeStateDeadline = std::chrono::steady_clock::time_point::max();
+    updateTimeState();
+}
+
+std::chrono::steady_clock::time_point TimeManagement::getTimeStateDeadline() const
+{
+    return my_timeStateDeadline;
 }
 
 void TimeManagement::advance(bool& msg_restant, Exception::Type& e)
@@ -588,7 +605,7 @@ void TimeManagement::timeAdvance(bool& msg_restant, Exception::Type& e)
         _avancee_en_cours = PAS_D_AVANCEE;
     }
         
-    sendTimeStateUpdate();
+    updateTimeState();
     
     Debug(G, pdGendoc) << " exit  TimeManagement::timeAdvance" << std::endl;
 }
@@ -703,7 +720,7 @@ void TimeManagement::nextEventAdvance(bool& msg_restant, Exception::Type& e)
         _avancee_en_cours = PAS_D_AVANCEE;
     }
     
-    sendTimeStateUpdate();
+    updateTimeState();
     
     Debug(G, pdGendoc) << " exit  TimeManagement::nextEventAdvance" << std::endl;
 }
@@ -725,7 +742,7 @@ void TimeManagement::timeAdvanceGrant(FederationTime logical_time, Exception::Ty
     comm->requestFederateService(&req);
 
     _heure_courante = logical_time;
-    sendTimeStateUpdate();
+    updateTimeState();
 }
 
 void TimeManagement::flushQueueRequest(FederationTime heure_logique, Exception::Type& e)
@@ -812,22 +829,7 @@ bool TimeManagement::executeFederateService(NetworkMessage& msg)
 
     case NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES: {
         NM_Reflect_Attribute_Values& RAV = static_cast<NM_Reflect_Attribute_Values&>(msg);
-        if (msg.isDated())
-            om->reflectAttributeValues(RAV.getObject(),
-                                       RAV.getAttributes(),
-                                       RAV.getValues(),
-                                       RAV.getAttributesSize(),
-                                       msg.getDate(),
-                                       msg.getLabel(),
-                                       msg.eventRetraction,
-                                       msg.getRefException());
-        else
-            om->reflectAttributeValues(RAV.getObject(),
-                                       RAV.getAttributes(),
-                                       RAV.getValues(),
-                                       RAV.getAttributesSize(),
-                                       msg.getLabel(),
-                                       msg.getRefException());
+        om->reflectAttributeValues(RAV, msg.getRefException());
         break;
     }
 
@@ -1008,6 +1010,15 @@ void TimeManagement::sendNullMessage(FederationTime logical_time)
         msg.setFederate(fm->getFederateHandle());
         msg.setDate(logical_time);
 
+        if (my_updateRate != std::chrono::seconds(0)) {
+            auto state = currentTimeState();
+            if (!isSameTimeState(state, my_reportedTimeState)) {
+                msg.setTimeState(state);
+                my_reportedTimeState = state;
+                my_timeStateDeadline = std::chrono::steady_clock::time_point::max();
+            }
+        }
+
         comm->sendMessage(&msg);
         _lastNullMessageDate = logical_time;
         Debug(DNULL, pdDebug) << "NULL message sent, Time = " << logical_time.getTime() << std::endl;
@@ -1076,44 +1087,53 @@ void TimeManagement::timeConstrainedEnabled(FederationTime logical_time, Excepti
     comm->requestFederateService(&req);
 }
 
-void TimeManagement::sendTimeStateUpdate()
+NM_Time_State TimeManagement::currentTimeState()
 {
-    if(my_updateRate == std::chrono::seconds(0)) {
-        // mom disabled or no periodic update, do nothing
+    NM_Time_State state;
+    state.setTime(_heure_courante.getTime());
+    state.setLookahead(_lookahead_courant.getTime());
+    state.setState(_avancee_en_cours == TAR);
+    state.setGalt(_LBTS.getTime());
+    state.setLits(requestMinNextEventTime().getTime());
+    return state;
+}
+
+void TimeManagement::updateTimeState()
+{
+    if (my_updateRate == std::chrono::seconds(0)
+        || my_timeStateDeadline != std::chrono::steady_clock::time_point::max()) {
+        // mom disabled, or a report is already pending
         return;
     }
-    
-    static std::chrono::time_point<std::chrono::system_clock> my_lastUpdate{};
-    static NM_Time_State_Update last_msg{};
-    NM_Time_State_Update msg;
 
-    msg.setFederation(fm->getFederationHandle().get());
-    msg.setFederate(fm->getFederateHandle());
-    msg.setDate(_heure_courante);
+    if (!isSameTimeState(currentTimeState(), my_reportedTimeState)) {
+        my_timeStateDeadline = std::chrono::steady_clock::now() + my_updateRate;
+    }
+}
 
-    msg.setLookahead(_lookahead_courant.getTime());
-    msg.setState(_avancee_en_cours == TAR);
-    msg.setGalt(_LBTS.getTime());
-    msg.setLits(requestMinNextEventTime().getTime());
-    
-    if(msg.getDate() == last_msg.getDate()
-        && msg.getLookahead() == last_msg.getLookahead()
-        && msg.getState() == last_msg.getState()
-        && msg.getGalt() == last_msg.getGalt()
-        && msg.getLits() == last_msg.getLits()) {
-        // nothing changed, do nothing
+void TimeManagement::sendTimeStateUpdate(const std::chrono::steady_clock::time_point now)
+{
+    if (now < my_timeStateDeadline) {
         return;
     }
+    my_timeStateDeadline = std::chrono::steady_clock::time_point::max();
 
-    auto now = std::chrono::system_clock::now();
-    
-    if(now - my_lastUpdate >= my_updateRate) {
-        comm->sendMessage(&msg);
-        last_msg = msg;
-        my_lastUpdate = now;
-        
-        Debug(DTUS, pdDebug) << "Time State Update sent" << std::endl;
+    // The state may have changed back since
+    auto state = currentTimeState();
+    if (isSameTimeState(state, my_reportedTimeState)) {
+        return;
     }
+
+    NM_Time_State_Update msg;
+    msg.setFederation(fm->getFederationHandle().get());
+    msg.setFederate(fm->getFederateHandle());
+    msg.setDate(_heure_courante);
+    msg.setTimeState(state);
+
+    comm->sendMessage(&msg);
+    my_reportedTimeState = state;
+
+    Debug(DTUS, pdDebug) << "Time State Update sent" << std::endl;
 }
 }
 } // namespaces
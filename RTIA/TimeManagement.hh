@@ -31,6 +31,7 @@
 
 #include <libCERTI/LBTS.hh>
 #include <libCERTI/Message.hh>
+#include <libCERTI/NM_Classes.hh>
 #include <libCERTI/PrettyDebug.hh>
 
 #include "Communications.hh"
@@ -121,6 +122,15 @@ public:
     
     void setMomUpdateRate(const std::chrono::seconds updateRate);
 
+    /**
+     * The time state of the federate is reported to the MOM of the RTIG by the
+     * NULL messages sent when it changed. A change which no NULL message carried
+     * within a report period is sent on its own by @ref sendTimeStateUpdate, when
+     * the RTIA main loop reaches this deadline (max if nothing is pending).
+     */
+    std::chrono::steady_clock::time_point getTimeStateDeadline() const;
+    void sendTimeStateUpdate(const std::chrono::steady_clock::time_point now);
+
     /**
      * The different tick state values.
      * The @tick method is the method that will be called
@@ -151,8 +161,18 @@ public:
     bool _tick_result; // tick() return value
 
     TickTime _tick_timeout;
+    /// End of the ongoing blocking tick, time_point::max() if it has no timeout.
+    std::chrono::steady_clock::time_point _tick_deadline{std::chrono::steady_clock::time_point::max()};
     TickTime _tick_max_tick;
     uint64_t _tick_clock_start;
+
+    /**
+     * Budget of the callback batches of the ongoing tick, the callbacks are
+     * sent one by one if the count is 0. No bound on the size if it is 0.
+     */
+    uint32_t _tick_batch_count{0};
+    uint32_t _tick_batch_bytes{0};
+
     /**
      * Is asynchronous delivery enabled/disabled.
      */
@@ -211,7 +231,9 @@ private:
     void timeRegulationEnabled(FederationTime logical_time, Exception::Type& e);
     void timeConstrainedEnabled(FederationTime logical_time, Exception::Type& e);
     
-    void sendTimeStateUpdate();
+    /// Check whether the time state changed, and if so schedule its report.
+    void updateTimeState();
+    NM_Time_State currentTimeState();
 
     // Other RTIA Objects
     Communications* comm;
@@ -241,6 +263,8 @@ private:
     bool _is_constrained{false};
     
     std::chrono::seconds my_updateRate{0};
+    NM_Time_State my_reportedTimeState;
+    std::chrono::steady_clock::time_point my_timeStateDeadline{std::chrono::steady_clock::time_point::max()};
 };
 }
 } // namespace certi/rtia
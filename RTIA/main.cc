@@ -95,7 +95,10 @@ int main(int argc, char** argv)
             rtia_fd = args.fd_arg;
         }
 
-        RTIA rtia(rtia_port, rtia_fd);
+        // Set by libRTI when the federate created a shared memory channel for us
+        const char* shm_channel = getenv("CERTI_SHM_CHANNEL");
+
+        RTIA rtia(rtia_port, rtia_fd, shm_channel ? shm_channel : "");
 
         PrettyDebug::setFederateName("RTIA::UnknownFederate");
 
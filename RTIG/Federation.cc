@@ -72,17 +72,6 @@ using std::list;
 using std::cerr;
 using std::vector;
 
-// Definitions
-#ifdef HAVE_XML
-// #include <libxml/xmlmemory.h>
-#include "libxml/xmlstring.h"
-#include <libxml/parser.h>
-// #include <libxml/tree.h>
-#define ROOT_NODE (const xmlChar*) "rtigSaveData"
-#define NODE_FEDERATION (const xmlChar*) "federation"
-#define NODE_FEDERATE (const xmlChar*) "federate"
-#endif // HAVE_XML
-
 #if defined(_WIN32) && !defined(__MINGW32__)
 #define strcasecmp stricmp
 #endif
@@ -98,6 +87,8 @@ static PrettyDebug D("FEDERATION", __FILE__);
 static PrettyDebug G("GENDOC", __FILE__);
 static PrettyDebug DNULL("RTIG_NULLMSG", "[RTIG NULL MSG]");
 
+constexpr std::chrono::milliseconds Federation::the_save_check_period;
+
 #ifdef FEDERATION_USES_MULTICAST
 Federation::Federation(const string& federation_name,
                        const FederationHandle federation_handle,
@@ -161,6 +152,8 @@ Federation::Federation(const string& federation_name,
     else { // only one fdd
         openFomModules({fom_modules.front()});
     }
+    // No federate has joined yet, they will all get the whole FOM
+    my_fom_delta = NM_Additional_Fom_Module();
     my_min_NERx.setZero();
 
     Debug(G, pdGendoc) << "exit Federation::Federation" << endl;
@@ -333,12 +326,16 @@ std::pair<FederateHandle, Responses> Federation::add(const string& federate_name
     
     auto rep = make_unique<NM_Join_Federation_Execution>();
     getFOM(*rep);
-    
-    auto fom_rep = make_unique<NM_Additional_Fom_Module>();
-    getFOM(*fom_rep);
-    
-    auto fom_resp = respondToAll(std::move(fom_rep), federate_handle);
-    responses.insert(end(responses), make_move_iterator(begin(fom_resp)), make_move_iterator(end(fom_resp)));
+
+    // The other federates only need what was merged since the last broadcast, if anything
+    if (my_fom_delta.getRoutingSpacesSize() > 0 || my_fom_delta.getObjectClassesSize() > 0
+        || my_fom_delta.getInteractionClassesSize() > 0) {
+        auto fom_rep = make_unique<NM_Additional_Fom_Module>(std::move(my_fom_delta));
+        my_fom_delta = NM_Additional_Fom_Module();
+
+        auto fom_resp = respondToAll(std::move(fom_rep), federate_handle);
+        responses.insert(end(responses), make_move_iterator(begin(fom_resp)), make_move_iterator(end(fom_resp)));
+    }
     
     // Prepare answer about JoinFederationExecution
     rep->setFederationExecutionName(getName());
@@ -471,6 +468,13 @@ Responses Federation::addRegulator(FederateHandle federate_handle, FederationTim
 
     // It may throw RTIinternalError if Federate was regulator.
     my_regulators.insert(federate_handle, time);
+    if (federate.isUsingNERx()) {
+        my_NERx_regulators.insert(federate_handle, federate.getLastNERxValue());
+        ++my_NERx_count;
+    }
+    else {
+        my_NERx_regulators.insert(federate_handle, time);
+    }
     federate.setRegulator(true);
 
     Debug(D, pdTerm) << "Federation " << my_handle << ": Federate " << federate_handle
@@ -521,6 +525,9 @@ Responses Federation::updateRegulator(FederateHandle federate_handle,
         Debug(D, pdDebug) << "Federation " << my_handle << ": Federate " << federate_handle << "'s new time is "
                           << time.getTime() << endl;
         my_regulators.update(federate_handle, time);
+        if (!federate.isUsingNERx()) {
+            my_NERx_regulators.set(federate_handle, my_regulators.get(federate_handle));
+        }
     }
 
     auto msg = make_unique<NM_Message_Null>();
@@ -550,6 +557,10 @@ Responses Federation::removeRegulator(FederateHandle federate_handle)
 
     // It may throw RTIinternalError if Federate was not regulator.
     my_regulators.remove(federate_handle);
+    my_NERx_regulators.remove(federate_handle);
+    if (federate.isUsingNERx()) {
+        --my_NERx_count;
+    }
 
     federate.setRegulator(false);
 
@@ -606,16 +617,12 @@ Responses Federation::updateTimeState(FederateHandle federate_handle,
     Responses responses;
 
     if (my_mom) {
-        responses = my_mom->updateLogicalTime(federate_handle, time);
-        auto resp = my_mom->updateLookahead(federate_handle, lookahead);
-        responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
-        auto resp2 = my_mom->updateTimeManagerState(
+        my_mom->updateLogicalTime(federate_handle, time);
+        my_mom->updateLookahead(federate_handle, lookahead);
+        my_mom->updateGALT(federate_handle, galt);
+        my_mom->updateLITS(federate_handle, lits);
+        responses = my_mom->updateTimeManagerState(
             federate_handle, time_manager_state ? Mom::TimeState::TimeAdvancing : Mom::TimeState::TimeGranted);
-        responses.insert(end(responses), make_move_iterator(begin(resp2)), make_move_iterator(end(resp2)));
-        auto resp3 = my_mom->updateGALT(federate_handle, galt);
-        responses.insert(end(responses), make_move_iterator(begin(resp3)), make_move_iterator(end(resp3)));
-        auto resp4 = my_mom->updateLITS(federate_handle, lits);
-        responses.insert(end(responses), make_move_iterator(begin(resp4)), make_move_iterator(end(resp4)));
     }
 
     return responses;
@@ -908,10 +915,58 @@ Responses Federation::federateSaveStatus(FederateHandle federate_handle, bool st
         }
     }
 
-    // Save RTIG Data for future restoration.
+    // Save RTIG Data for future restoration, the snapshot is written while the federation goes on.
+    // The save only ends once it is written, see provideSaveResult.
     if (my_save_status) {
-        my_save_status = saveXmlData();
+        if (!my_snapshot_writer) {
+            my_snapshot_writer = make_unique<SnapshotWriter>(my_name);
+        }
+        my_snapshot_writer->save(my_save_label, captureSnapshot());
+
+        my_save_federate = federate_handle;
+        my_next_save_check = std::chrono::steady_clock::now();
+
+        Debug(G, pdGendoc) << "exit  Federation::federateSaveStatus snapshot being written" << endl;
+        return responses;
+    }
+
+    auto resp = endSave(federate_handle);
+    responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
+
+    Debug(G, pdGendoc) << "exit  Federation::federateSaveStatus" << endl;
+
+    return responses;
+}
+
+std::chrono::steady_clock::time_point Federation::getNextSaveCheckTime() const
+{
+    return my_next_save_check;
+}
+
+Responses Federation::provideSaveResult(const std::chrono::steady_clock::time_point now)
+{
+    if (my_next_save_check == std::chrono::steady_clock::time_point::max()) {
+        return {};
+    }
+
+    bool succeeded{false};
+    if (!my_snapshot_writer->poll(succeeded)) {
+        my_next_save_check = now + the_save_check_period;
+        return {};
     }
+    my_next_save_check = std::chrono::steady_clock::time_point::max();
+
+    if (!succeeded) {
+        Debug(D, pdError) << "The snapshot of federation " << my_name << " could not be written" << endl;
+        my_save_status = false;
+    }
+
+    return endSave(my_save_federate);
+}
+
+Responses Federation::endSave(FederateHandle federate_handle)
+{
+    Responses responses;
 
     // Send end save message.
     std::unique_ptr<NetworkMessage> msg(NM_Factory::create(
@@ -920,8 +975,7 @@ Responses Federation::federateSaveStatus(FederateHandle federate_handle, bool st
     msg->setFederate(federate_handle);
     msg->setFederation(my_handle.get());
 
-    auto resp = respondToAll(std::move(msg));
-    responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
+    responses = respondToAll(std::move(msg));
 
     Debug(G, pdGendoc) << "            =======> broadcast F_S or F_N_S" << endl;
 
@@ -937,8 +991,6 @@ Responses Federation::federateSaveStatus(FederateHandle federate_handle, bool st
         responses.insert(end(responses), make_move_iterator(begin(resp2)), make_move_iterator(end(resp2)));
     }
 
-    Debug(G, pdGendoc) << "exit  Federation::federateSaveStatus" << endl;
-
     return responses;
 }
 
@@ -952,18 +1004,12 @@ Responses Federation::requestFederationRestore(FederateHandle federate_handle, c
     if (my_is_restore_in_progress) {
         throw RestoreInProgress("Already in restoring state.");
     }
+    if (my_is_save_in_progress) {
+        throw SaveInProgress("The federation is being saved.");
+    }
 
-// Informs sending federate of success/failure in restoring.
-// At this point, only verify that file is present.
-#ifdef HAVE_XML
-    string filename = my_name + "_" + the_label + ".xcs";
-    bool success = restoreXmlData(filename);
-#else
-    bool success = false;
-#endif // HAVE_XML
-
-    // JYR Note : forcing success to true to skip xmlParseFile (not compliant ?)
-    success = true;
+    // Informs sending federate of success/failure in restoring.
+    bool success = restoreSnapshot(the_label);
 
     std::unique_ptr<NetworkMessage> msg(
         NM_Factory::create(success ? NetworkMessage::Type::REQUEST_FEDERATION_RESTORE_SUCCEEDED
@@ -1329,10 +1375,8 @@ Federation::registerObject(FederateHandle federate, ObjectClassHandle class_hand
     responses.emplace_back(my_server->getSocketLink(federate), std::move(rep));
 
     if (my_mom) {
-        auto resp = my_mom->updateObjectInstancesThatCanBeDeleted(federate);
-        responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
-        auto resp2 = my_mom->updateObjectInstancesRegistered(federate);
-        responses.insert(end(responses), make_move_iterator(begin(resp2)), make_move_iterator(end(resp2)));
+        my_mom->updateObjectInstancesThatCanBeDeleted(federate);
+        my_mom->updateObjectInstancesRegistered(federate);
         // TODO should updateObjectInstancesDiscovered
     }
 
@@ -1364,10 +1408,8 @@ Responses Federation::deleteObject(FederateHandle federate_handle,
     responses.emplace_back(my_server->getSocketLink(federate_handle), std::move(rep));
 
     if (my_mom) {
-        auto resp = my_mom->updateObjectInstancesThatCanBeDeleted(federate_handle, -1);
-        responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
-        auto resp2 = my_mom->updateObjectInstancesDeleted(federate_handle);
-        responses.insert(end(responses), make_move_iterator(begin(resp2)), make_move_iterator(end(resp2)));
+        my_mom->updateObjectInstancesThatCanBeDeleted(federate_handle, -1);
+        my_mom->updateObjectInstancesDeleted(federate_handle);
     }
 
     return responses;
@@ -1394,11 +1436,8 @@ Responses Federation::deleteObject(FederateHandle federate_handle, ObjectHandle
     responses.emplace_back(my_server->getSocketLink(federate_handle), std::move(rep));
 
     if (my_mom) {
-        auto resp = my_mom->updateObjectInstancesThatCanBeDeleted(federate_handle, -1);
-        responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
-
-        auto resp2 = my_mom->updateObjectInstancesDeleted(federate_handle);
-        responses.insert(end(responses), make_move_iterator(begin(resp2)), make_move_iterator(end(resp2)));
+        my_mom->updateObjectInstancesThatCanBeDeleted(federate_handle, -1);
+        my_mom->updateObjectInstancesDeleted(federate_handle);
 
         // TODO should updateObjectInstancesRemoved
     }
@@ -1509,34 +1548,18 @@ Responses Federation::updateAttributeValues(FederateHandle federate,
     responses = my_root_object->ObjectClasses->updateAttributeValues(federate, object, attributes, values, time, tag);
 
     if (my_mom && federate != my_mom->getHandle()) {
-        std::map<FederateHandle, int> reflections;
+        my_mom->registerUpdate(federate, object->getClass(), object_handle);
+
         for (const auto& rep : responses) {
-            for (const auto& socket : rep.sockets()) {
-                if (rep.message()->getMessageType() == NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES) {
-                    ++reflections[my_server->getFederateHandle(socket)];
+            if (rep.message()->getMessageType() == NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES) {
+                for (const auto& socket : rep.sockets()) {
+                    if (socket) {
+                        my_mom->registerReflection(
+                            my_server->getFederateHandle(socket), object->getClass(), object_handle);
+                    }
                 }
             }
         }
-
-        my_mom->registerUpdate(federate, object->getClass());
-
-        my_mom->registerObjectInstanceUpdated(federate, object->getClass(), object_handle);
-        auto resp = my_mom->updateUpdatesSent(federate);
-        responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
-
-        auto resp2 = my_mom->updateObjectInstancesUpdated(federate);
-        responses.insert(end(responses), make_move_iterator(begin(resp2)), make_move_iterator(end(resp2)));
-
-        for (const auto& r : reflections) {
-            my_mom->registerReflection(r.first, object->getClass());
-
-            my_mom->registerObjectInstanceReflected(r.first, object->getClass(), object_handle);
-            auto resp3 = my_mom->updateReflectionsReceived(r.first, r.second);
-            responses.insert(end(responses), make_move_iterator(begin(resp3)), make_move_iterator(end(resp3)));
-
-            auto resp4 = my_mom->updateObjectInstancesReflected(r.first);
-            responses.insert(end(responses), make_move_iterator(begin(resp4)), make_move_iterator(end(resp4)));
-        }
     }
 
     Debug(D, pdRegister) << "Federation " << my_handle << ": Federate " << federate << " updated attributes of Object "
@@ -1563,34 +1586,18 @@ Responses Federation::updateAttributeValues(FederateHandle federate,
     responses = my_root_object->ObjectClasses->updateAttributeValues(federate, object, attributes, values, tag);
 
     if (my_mom && federate != my_mom->getHandle()) {
-        std::map<FederateHandle, int> reflections;
+        my_mom->registerUpdate(federate, object->getClass(), object_handle);
+
         for (const auto& rep : responses) {
-            for (const auto& socket : rep.sockets()) {
-                if (rep.message()->getMessageType() == NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES) {
-                    ++reflections[my_server->getFederateHandle(socket)];
+            if (rep.message()->getMessageType() == NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES) {
+                for (const auto& socket : rep.sockets()) {
+                    if (socket) {
+                        my_mom->registerReflection(
+                            my_server->getFederateHandle(socket), object->getClass(), object_handle);
+                    }
                 }
             }
         }
-
-        my_mom->registerUpdate(federate, object->getClass());
-
-        my_mom->registerObjectInstanceUpdated(federate, object->getClass(), object_handle);
-        auto resp = my_mom->updateUpdatesSent(federate);
-        responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
-
-        auto resp2 = my_mom->updateObjectInstancesUpdated(federate);
-        responses.insert(end(responses), make_move_iterator(begin(resp2)), make_move_iterator(end(resp2)));
-
-        for (const auto& r : reflections) {
-            my_mom->registerReflection(r.first, object->getClass());
-
-            my_mom->registerObjectInstanceReflected(r.first, object->getClass(), object_handle);
-            auto resp3 = my_mom->updateReflectionsReceived(r.first, r.second);
-            responses.insert(end(responses), make_move_iterator(begin(resp3)), make_move_iterator(end(resp3)));
-
-            auto resp4 = my_mom->updateObjectInstancesReflected(r.first);
-            responses.insert(end(responses), make_move_iterator(begin(resp4)), make_move_iterator(end(resp4)));
-        }
     }
 
     Debug(D, pdRegister) << "Federation " << my_handle << ": Federate " << federate << " updated attributes of Object "
@@ -1630,6 +1637,17 @@ Responses Federation::publishInteraction(FederateHandle federate_handle,
     return responses;
 }
 
+void Federation::checkPublishing(FederateHandle federate_handle, InteractionClassHandle interaction_class_handle)
+{
+    check(federate_handle);
+
+    // It may throw InteractionClassNotDefined
+    if (!my_root_object->getInteractionClass(interaction_class_handle)->isPublishing(federate_handle)) {
+        throw InteractionClassNotPublished("Interaction #" + std::to_string(interaction_class_handle)
+                                           + " is not published by federate #" + std::to_string(federate_handle));
+    }
+}
+
 Responses Federation::subscribeInteraction(FederateHandle federate_handle,
                                            InteractionClassHandle interaction_class_handle,
                                            bool subscribe_or_unsubscribe)
@@ -1699,25 +1717,19 @@ Responses Federation::broadcastInteraction(FederateHandle federate_handle,
     }
 
     if (my_mom) {
-        std::map<FederateHandle, int> interactions;
+        my_mom->registerInteractionSent(federate_handle, interaction_class_handle);
+
         for (const auto& rep : responses) {
-            for (const auto& socket : rep.sockets()) {
-                if (socket && rep.message()->getMessageType() == NetworkMessage::Type::RECEIVE_INTERACTION) {
-                    ++interactions[my_server->getFederateHandle(socket)];
+            if (rep.message()->getMessageType() == NetworkMessage::Type::RECEIVE_INTERACTION) {
+                for (const auto& socket : rep.sockets()) {
+                    if (socket) {
+                        my_mom->registerInteractionReceived(my_server->getFederateHandle(socket),
+                                                            interaction_class_handle);
+                    }
                 }
             }
         }
 
-        my_mom->registerInteractionSent(federate_handle, interaction_class_handle);
-        auto resp = my_mom->updateInteractionsSent(federate_handle);
-        responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
-
-        for (const auto& i : interactions) {
-            my_mom->registerInteractionReceived(i.first, interaction_class_handle);
-            auto resp2 = my_mom->updateInteractionsReceived(i.first);
-            responses.insert(end(responses), make_move_iterator(begin(resp2)), make_move_iterator(end(resp2)));
-        }
-
         if (my_root_object->Interactions->getObjectFromHandle(interaction_class_handle)
                 ->isSubscribed(my_mom->getHandle())) {
             auto mom_responses = my_mom->processInteraction(
@@ -1768,25 +1780,19 @@ Responses Federation::broadcastInteraction(FederateHandle federate_handle,
     }
 
     if (my_mom) {
-        std::map<FederateHandle, int> interactions;
+        my_mom->registerInteractionSent(federate_handle, interaction_class_handle);
+
         for (const auto& rep : responses) {
-            for (const auto& socket : rep.sockets()) {
-                if (rep.message()->getMessageType() == NetworkMessage::Type::RECEIVE_INTERACTION) {
-                    ++interactions[my_server->getFederateHandle(socket)];
+            if (rep.message()->getMessageType() == NetworkMessage::Type::RECEIVE_INTERACTION) {
+                for (const auto& socket : rep.sockets()) {
+                    if (socket) {
+                        my_mom->registerInteractionReceived(my_server->getFederateHandle(socket),
+                                                            interaction_class_handle);
+                    }
                 }
             }
         }
 
-        my_mom->registerInteractionSent(federate_handle, interaction_class_handle);
-        auto resp = my_mom->updateInteractionsSent(federate_handle);
-        responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
-
-        for (const auto& i : interactions) {
-            my_mom->registerInteractionReceived(i.first, interaction_class_handle);
-            auto resp2 = my_mom->updateInteractionsReceived(i.first);
-            responses.insert(end(responses), make_move_iterator(begin(resp2)), make_move_iterator(end(resp2)));
-        }
-
         if (my_root_object->Interactions->getObjectFromHandle(interaction_class_handle)
                 ->isSubscribed(my_mom->getHandle())) {
             auto mom_responses = my_mom->processInteraction(
@@ -1811,6 +1817,25 @@ bool Federation::isOwner(FederateHandle federate_handle, ObjectHandle object_han
     return my_root_object->objects->isAttributeOwnedByFederate(federate_handle, object_handle, attribute_handle);
 }
 
+void Federation::checkOwned(FederateHandle federate_handle,
+                            ObjectHandle object_handle,
+                            const vector<AttributeHandle>& attributes)
+{
+    check(federate_handle);
+
+    // It may throw ObjectNotKnown
+    Object* object = my_root_object->objects->getObject(object_handle);
+
+    for (const auto& attribute : attributes) {
+        // It may throw AttributeNotDefined
+        if (!object->isAttributeOwnedByFederate(federate_handle, attribute)) {
+            throw AttributeNotOwned("Attribute #" + std::to_string(attribute) + " of object #"
+                                    + std::to_string(object_handle) + " is not owned by federate #"
+                                    + std::to_string(federate_handle));
+        }
+    }
+}
+
 void Federation::queryAttributeOwnership(FederateHandle federate_handle,
                                          ObjectHandle object_handle,
                                          AttributeHandle attribute_handle)
@@ -2075,14 +2100,33 @@ Responses Federation::updateAsynchronousDelivery(FederateHandle federate_handle,
     return {};
 }
 
+namespace {
+template <typename Message>
+void copyFom(const NM_Additional_Fom_Module& fom, Message& message)
+{
+    message.setRoutingSpacesSize(fom.getRoutingSpacesSize());
+    for (uint32_t i = 0; i < fom.getRoutingSpacesSize(); ++i) {
+        message.getRoutingSpaces(i) = fom.getRoutingSpaces(i);
+    }
+    message.setObjectClassesSize(fom.getObjectClassesSize());
+    for (uint32_t i = 0; i < fom.getObjectClassesSize(); ++i) {
+        message.getObjectClasses(i) = fom.getObjectClasses(i);
+    }
+    message.setInteractionClassesSize(fom.getInteractionClassesSize());
+    for (uint32_t i = 0; i < fom.getInteractionClassesSize(); ++i) {
+        message.getInteractionClasses(i) = fom.getInteractionClasses(i);
+    }
+}
+}
+
 void Federation::getFOM(NM_Join_Federation_Execution& object_model_data)
 {
-    my_root_object->convertToSerializedFOM(object_model_data);
+    copyFom(my_serialized_fom, object_model_data);
 }
 
 void Federation::getFOM(NM_Additional_Fom_Module& object_model_data)
 {
-    my_root_object->convertToSerializedFOM(object_model_data);
+    copyFom(my_serialized_fom, object_model_data);
 }
 
 bool Federation::updateLastNERxForFederate(FederateHandle federate_handle, FederationTime date)
@@ -2091,6 +2135,12 @@ bool Federation::updateLastNERxForFederate(FederateHandle federate_handle, Feder
     FederationTime newMin;
     Federate& f = getFederate(federate_handle);
 
+    if (my_NERx_regulators.exists(federate_handle)) {
+        my_NERx_regulators.set(federate_handle, date);
+        if (!f.isUsingNERx()) {
+            ++my_NERx_count;
+        }
+    }
     f.setLastNERxValue(date);
     Debug(D, pdDebug) << "Federate <" << f.getName() << "> has new NERx value=" << date.getTime() << endl;
     newMin = computeMinNERx();
@@ -2103,14 +2153,17 @@ bool Federation::updateLastNERxForFederate(FederateHandle federate_handle, Feder
 		 *            after that a NERing Federate which remains in its NERing loop should
 		 *            send a new NULL PRIME message.
 		 */
-        //         for (HandleFederateMap::iterator i = _handleFederateMap.begin(); i != _handleFederateMap.end(); ++i) {
         for (const auto& kv : my_federates) {
             if (kv.second->isUsingNERx()) {
                 kv.second->setLastNERxValue(FedTime(0.0)); // not needed
                 kv.second->setIsUsingNERx(false);
+                if (my_NERx_regulators.exists(kv.first)) {
+                    my_NERx_regulators.set(kv.first, my_regulators.get(kv.first));
+                }
                 Debug(D, pdDebug) << "Federate <" << kv.second->getName() << "> not NERing anymore." << endl;
             }
         }
+        my_NERx_count = 0;
     }
     return retval;
 }
@@ -2118,36 +2171,14 @@ bool Federation::updateLastNERxForFederate(FederateHandle federate_handle, Feder
 FederationTime Federation::computeMinNERx()
 {
     FederationTime retval;
-    uint32_t nbFed;
-    LBTS NER_regulators;
-    vector<LBTS::FederateClock> clocks;
-    retval.setZero();
-    nbFed = 0;
-    my_regulators.get(clocks);
-
-    /* Build a set of clocks */
-    for (const auto& clock : clocks) {
-        FederateHandle h = clock.first;
-        //         HandleFederateMap::iterator f = federate.find(h);
-        Federate& f = getFederate(h);
-        if (f.isUsingNERx()) {
-            nbFed++;
-            NER_regulators.insert(h, f.getLastNERxValue());
-        }
-        else {
-            NER_regulators.insert(h, clock.second);
-        }
-    }
-
-    /* compute the new NERx LBTS (minimum) */
-    NER_regulators.compute();
-    retval = NER_regulators.getLBTSValue();
-    Debug(D, pdDebug) << "MinNERx =" << retval.getTime() << endl;
 
     /* the minimum is different from 0 iff more than 2 federate use NERx */
-    if (nbFed < 2) {
+    if (my_NERx_count < 2) {
         retval.setZero();
     }
+    else {
+        retval = my_NERx_regulators.getLBTSValue();
+    }
 
     Debug(D, pdDebug) << "computeMinNERx =" << retval.getTime() << endl;
     return retval;
@@ -2189,11 +2220,7 @@ Responses Federation::respondToAll(std::unique_ptr<NetworkMessage> message, cons
     std::vector<Socket*> sockets;
     for (const auto& pair : my_federates) {
         if (pair.first != except) {
-#ifdef HLA_USES_UDP
-            sockets.push_back(my_server->getSocketLink(pair.first, BEST_EFFORT));
-#else
             sockets.push_back(my_server->getSocketLink(pair.first));
-#endif
         }
     }
 
@@ -2209,11 +2236,7 @@ Responses Federation::respondToSome(std::unique_ptr<NetworkMessage> message,
 
     std::vector<Socket*> sockets;
     for (const auto& fed : recipients) {
-#ifdef HLA_USES_UDP
-        sockets.push_back(server->getSocketLink(fed, BEST_EFFORT));
-#else
         sockets.push_back(my_server->getSocketLink(fed));
-#endif
     }
 
     responses.emplace_back(sockets, std::move(message));
@@ -2254,6 +2277,22 @@ Responses Federation::enableMomIfAvailable()
     return responses;
 }
 
+std::chrono::steady_clock::time_point Federation::getNextMomReportTime() const
+{
+    if (!my_mom) {
+        return std::chrono::steady_clock::time_point::max();
+    }
+    return my_mom->getNextReportTime();
+}
+
+Responses Federation::provideMomReports(const std::chrono::steady_clock::time_point now)
+{
+    if (!my_mom) {
+        return {};
+    }
+    return my_mom->provideReports(now);
+}
+
 Responses Federation::setAutoProvide(const bool value)
 {
     my_auto_provide = value;
@@ -23,6 +23,7 @@
 #ifndef _CERTI_RTIG_FEDERATION_HH
 #define _CERTI_RTIG_FEDERATION_HH
 
+#include <chrono>
 #include <cstdint>
 #include <map>
 #include <set>
@@ -41,9 +42,11 @@
 #include <libCERTI/HandleManager.hh>
 #include <libCERTI/LBTS.hh>
 #include <libCERTI/MessageEvent.hh>
+#include <libCERTI/NM_Classes.hh>
 #include <libHLA/MessageBuffer.hh>
 
 #include "Federate.hh"
+#include "FederationSnapshot.hh"
 #include "Mom.hh"
 
 #ifdef FEDERATION_USES_MULTICAST
@@ -135,6 +138,18 @@ public:
 
     Responses enableMomIfAvailable();
 
+    /// Time at which provideMomReports has something to send, time_point::max() if none.
+    std::chrono::steady_clock::time_point getNextMomReportTime() const;
+
+    /// Report the MOM periodic attributes of the federates whose report period elapsed.
+    Responses provideMomReports(const std::chrono::steady_clock::time_point now);
+
+    /// Time at which provideSaveResult checks the snapshot being written, time_point::max() if none.
+    std::chrono::steady_clock::time_point getNextSaveCheckTime() const;
+
+    /// End the save once its snapshot is written, FEDERATION_NOT_SAVED if it could not be.
+    Responses provideSaveResult(const std::chrono::steady_clock::time_point now);
+
     // -------------------------
     // -- Federate Management --
     // -------------------------
@@ -353,6 +368,9 @@ public:
                                    InteractionClassHandle interaction_class_handle,
                                    bool subscribe_or_unsubscribe);
 
+    /// Throw unless the federate publishes the interaction class, before it changes its transport.
+    void checkPublishing(FederateHandle federate_handle, InteractionClassHandle interaction_class_handle);
+
     /// broadcastInteraction with time
     Responses broadcastInteraction(FederateHandle federate_handle,
                                    InteractionClassHandle interaction_class_handle,
@@ -376,6 +394,11 @@ public:
 
     bool isOwner(FederateHandle federate_handle, ObjectHandle object_handle, AttributeHandle attribute_handle);
 
+    /// Throw unless the federate owns every attribute, before it changes their transport.
+    void checkOwned(FederateHandle federate_handle,
+                    ObjectHandle object_handle,
+                    const std::vector<AttributeHandle>& attributes);
+
     void queryAttributeOwnership(FederateHandle federate_handle,
                                  ObjectHandle object_handle,
                                  AttributeHandle attribute_handle);
@@ -463,6 +486,7 @@ public:
     /**
      * Compute the minimum of all NERx messsage date
      * for all Federates using NERx messages.
+     * The minimum is maintained as regulators and NERx dates are updated, so this is O(1).
      * @return the minimum if at least one federate is using NERx, 0 otherwise
      */
     FederationTime computeMinNERx();
@@ -487,8 +511,17 @@ private:
 
     void openFomModules(std::vector<std::string> modules, const bool is_mim = false);
 
-    bool saveXmlData();
-    bool restoreXmlData(std::string docFilename);
+    /// Serialize the FOM again after modules were merged, and keep what they added.
+    void updateSerializedFom();
+
+    /// Records of the state saved for the federation.
+    FederationSnapshot::Records captureSnapshot() const;
+
+    /// Apply the state saved under label. @return false if no such snapshot can be read.
+    bool restoreSnapshot(const std::string& label);
+
+    /// Broadcast the end of the save, and reset its state.
+    Responses endSave(FederateHandle federate_handle);
 
     Responses respondToAll(std::unique_ptr<NetworkMessage> message, const FederateHandle except = 0);
     Responses respondToSome(std::unique_ptr<NetworkMessage> message, const std::vector<FederateHandle>& recipients);
@@ -515,6 +548,12 @@ private:
     std::unique_ptr<SecurityServer> my_server;
     std::unique_ptr<RootObject> my_root_object;
 
+    /// The FOM sent to the joining federates, serialized again only when openFomModules merges modules.
+    NM_Additional_Fom_Module my_serialized_fom;
+
+    /// What the modules merged added to my_serialized_fom since it was last sent to the federates already joined.
+    NM_Additional_Fom_Module my_fom_delta;
+
     /// The minimum NERx timestamp for this federation
     FederationTime my_min_NERx{};
 
@@ -524,6 +563,12 @@ private:
 
     LBTS my_regulators{};
 
+    /// Clocks of the regulators, replaced by their last NERx date for those using NERx.
+    LBTS my_NERx_regulators{};
+
+    /// Number of regulators using NERx.
+    uint32_t my_NERx_count{0};
+
     /// Labels and Tags not on synchronization.
     std::map<std::string, std::string> my_synchronization_labels{};
 
@@ -539,6 +584,16 @@ private:
     bool my_restore_status{true}; /// True if restoring was correctly done.
     std::string my_save_label{""}; /// The label associated with the save request.
 
+    /// Writes the snapshots of the saves, created by the first one.
+    std::unique_ptr<SnapshotWriter> my_snapshot_writer;
+
+    /// The last federate which ended the save whose snapshot is being written.
+    FederateHandle my_save_federate{0};
+    std::chrono::steady_clock::time_point my_next_save_check{std::chrono::steady_clock::time_point::max()};
+
+    /// How often the snapshot being written is checked.
+    static constexpr std::chrono::milliseconds the_save_check_period{10};
+
     RtiVersion my_rti_version;
 };
 }
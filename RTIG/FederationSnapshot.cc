@@ -0,0 +1,473 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include "FederationSnapshot.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+
+#ifdef _WIN32
+#include <sstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <libCERTI/Exception.hh>
+#include <libCERTI/PrettyDebug.hh>
+
+namespace certi {
+namespace rtig {
+
+static PrettyDebug D("SNAPSHOT", __FILE__);
+
+namespace {
+static const char the_magic[] = {'C', 'E', 'R', 'T', 'I', 'S', 'N', 'P'};
+
+static constexpr uint32_t the_default_max_deltas{16};
+
+uint32_t readMaxDeltas()
+{
+    const char* value = getenv("CERTI_SAVE_DELTAS");
+    if (!value || !*value) {
+        return the_default_max_deltas;
+    }
+    return static_cast<uint32_t>(strtoul(value, nullptr, 10));
+}
+
+/// Content of a snapshot file, mapped in memory as long as it is alive.
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path)
+    {
+#ifdef _WIN32
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            throw RTIinternalError("Cannot open snapshot " + path);
+        }
+        std::ostringstream content;
+        content << file.rdbuf();
+        my_content = content.str();
+        my_data = my_content.data();
+        my_size = my_content.size();
+#else
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw RTIinternalError("Cannot open snapshot " + path);
+        }
+        struct stat status;
+        if (fstat(fd, &status) != 0) {
+            close(fd);
+            throw RTIinternalError("Cannot read snapshot " + path);
+        }
+        my_size = static_cast<size_t>(status.st_size);
+        if (my_size > 0) {
+            void* address = mmap(nullptr, my_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (address == MAP_FAILED) {
+                close(fd);
+                throw RTIinternalError("Cannot map snapshot " + path);
+            }
+            my_data = static_cast<const char*>(address);
+        }
+        close(fd);
+#endif
+    }
+
+    ~MappedFile()
+    {
+#ifndef _WIN32
+        if (my_data) {
+            munmap(const_cast<char*>(my_data), my_size);
+        }
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const
+    {
+        return my_data;
+    }
+
+    size_t size() const
+    {
+        return my_size;
+    }
+
+private:
+#ifdef _WIN32
+    std::string my_content;
+#endif
+    const char* my_data{nullptr};
+    size_t my_size{0};
+};
+
+void load(const std::string& federation,
+          const std::string& label,
+          const uint64_t identifier,
+          const uint32_t depth,
+          FederationSnapshot::Records& records)
+{
+    if (depth > FederationSnapshot::the_max_chain_length) {
+        throw RTIinternalError("Snapshot " + label + " has a chain of deltas too long");
+    }
+
+    MappedFile file(FederationSnapshot::filename(federation, label));
+    FederationSnapshot::Decoder decoder(file.data(), file.size());
+
+    for (char expected : the_magic) {
+        if (static_cast<char>(decoder.uint8()) != expected) {
+            throw RTIinternalError("Snapshot " + label + " is not a snapshot");
+        }
+    }
+    if (decoder.uint32() != FederationSnapshot::the_version) {
+        throw RTIinternalError("Snapshot " + label + " has an unknown version");
+    }
+    if (decoder.string() != federation || decoder.string() != label) {
+        throw RTIinternalError("Snapshot " + label + " belongs to another save");
+    }
+    if (decoder.uint64() != identifier && identifier != 0) {
+        throw RTIinternalError("Snapshot " + label + " was saved again since its deltas");
+    }
+
+    auto base = decoder.string();
+    auto base_identifier = decoder.uint64();
+    if (!base.empty()) {
+        load(federation, base, base_identifier, depth + 1, records);
+    }
+
+    for (auto count = decoder.uint32(); count > 0; --count) {
+        auto kind = static_cast<FederationSnapshot::Kind>(decoder.uint8());
+        auto id = decoder.uint64();
+        records[{kind, id}] = decoder.string();
+    }
+    for (auto count = decoder.uint32(); count > 0; --count) {
+        auto kind = static_cast<FederationSnapshot::Kind>(decoder.uint8());
+        records.erase({kind, decoder.uint64()});
+    }
+
+    if (!decoder.atEnd()) {
+        throw RTIinternalError("Snapshot " + label + " has trailing bytes");
+    }
+    Debug(D, pdDebug) << "Loaded snapshot " << label << (base.empty() ? "" : " over " + base) << std::endl;
+}
+}
+
+FederationSnapshot::Encoder& FederationSnapshot::Encoder::uint8(const uint8_t value)
+{
+    my_bytes.push_back(static_cast<char>(value));
+    return *this;
+}
+
+FederationSnapshot::Encoder& FederationSnapshot::Encoder::uint32(const uint32_t value)
+{
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        my_bytes.push_back(static_cast<char>((value >> shift) & 0xff));
+    }
+    return *this;
+}
+
+FederationSnapshot::Encoder& FederationSnapshot::Encoder::uint64(const uint64_t value)
+{
+    uint32(static_cast<uint32_t>(value >> 32));
+    return uint32(static_cast<uint32_t>(value));
+}
+
+FederationSnapshot::Encoder& FederationSnapshot::Encoder::real(const double value)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return uint64(bits);
+}
+
+FederationSnapshot::Encoder& FederationSnapshot::Encoder::string(const std::string& value)
+{
+    uint32(static_cast<uint32_t>(value.size()));
+    my_bytes.append(value);
+    return *this;
+}
+
+const std::string& FederationSnapshot::Encoder::bytes() const
+{
+    return my_bytes;
+}
+
+FederationSnapshot::Decoder::Decoder(const std::string& bytes) : Decoder(bytes.data(), bytes.size())
+{
+}
+
+FederationSnapshot::Decoder::Decoder(const char* data, const size_t size) : my_data(data), my_end(data + size)
+{
+}
+
+const char* FederationSnapshot::Decoder::take(const size_t size)
+{
+    if (static_cast<size_t>(my_end - my_data) < size) {
+        throw RTIinternalError("Snapshot record is truncated");
+    }
+    auto data = my_data;
+    my_data += size;
+    return data;
+}
+
+uint8_t FederationSnapshot::Decoder::uint8()
+{
+    return static_cast<uint8_t>(*take(1));
+}
+
+uint32_t FederationSnapshot::Decoder::uint32()
+{
+    auto bytes = reinterpret_cast<const unsigned char*>(take(4));
+    return (static_cast<uint32_t>(bytes[0]) << 24) | (static_cast<uint32_t>(bytes[1]) << 16)
+        | (static_cast<uint32_t>(bytes[2]) << 8) | static_cast<uint32_t>(bytes[3]);
+}
+
+uint64_t FederationSnapshot::Decoder::uint64()
+{
+    uint64_t high = uint32();
+    return (high << 32) | uint32();
+}
+
+double FederationSnapshot::Decoder::real()
+{
+    auto bits = uint64();
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+std::string FederationSnapshot::Decoder::string()
+{
+    auto size = uint32();
+    return std::string(take(size), size);
+}
+
+bool FederationSnapshot::Decoder::atEnd() const
+{
+    return my_data == my_end;
+}
+
+std::string FederationSnapshot::filename(const std::string& federation, const std::string& label)
+{
+    return federation + "_" + label + ".snapshot";
+}
+
+uint64_t FederationSnapshot::write(const std::string& federation,
+                                   const std::string& label,
+                                   const std::string& base,
+                                   const uint64_t baseIdentifier,
+                                   const Records& changed,
+                                   const std::vector<Key>& removed)
+{
+    std::random_device random;
+    uint64_t identifier = 0;
+    while (identifier == 0) {
+        identifier = (static_cast<uint64_t>(random()) << 32) | random();
+    }
+
+    Encoder header;
+    for (char c : the_magic) {
+        header.uint8(static_cast<uint8_t>(c));
+    }
+    header.uint32(the_version).string(federation).string(label).uint64(identifier).string(base).uint64(baseIdentifier);
+    header.uint32(static_cast<uint32_t>(changed.size()));
+
+    auto path = filename(federation, label);
+    auto temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary);
+        file.write(header.bytes().data(), header.bytes().size());
+
+        for (const auto& record : changed) {
+            Encoder encoder;
+            encoder.uint8(static_cast<uint8_t>(record.first.first)).uint64(record.first.second).string(record.second);
+            file.write(encoder.bytes().data(), encoder.bytes().size());
+        }
+
+        Encoder trailer;
+        trailer.uint32(static_cast<uint32_t>(removed.size()));
+        for (const auto& key : removed) {
+            trailer.uint8(static_cast<uint8_t>(key.first)).uint64(key.second);
+        }
+        file.write(trailer.bytes().data(), trailer.bytes().size());
+
+        if (!file.flush()) {
+            Debug(D, pdError) << "Cannot write snapshot to " << temporary << std::endl;
+            std::remove(temporary.c_str());
+            std::remove(path.c_str());
+            return 0;
+        }
+    }
+#ifdef _WIN32
+    std::remove(path.c_str());
+#endif
+    if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+        Debug(D, pdError) << "Cannot write snapshot to " << path << std::endl;
+        std::remove(temporary.c_str());
+        std::remove(path.c_str());
+        return 0;
+    }
+    return identifier;
+}
+
+FederationSnapshot::Records FederationSnapshot::load(const std::string& federation, const std::string& label)
+{
+    Records records;
+    ::certi::rtig::load(federation, label, 0, 0, records);
+    return records;
+}
+
+SnapshotWriter::SnapshotWriter(const std::string& federation) : SnapshotWriter(federation, readMaxDeltas())
+{
+}
+
+SnapshotWriter::SnapshotWriter(const std::string& federation, const uint32_t maxDeltas)
+    : my_federation(federation), my_max_deltas(maxDeltas), my_thread(&SnapshotWriter::run, this)
+{
+    Debug(D, pdInit) << "Snapshots of " << my_federation << " chain up to " << my_max_deltas << " deltas"
+                     << std::endl;
+}
+
+SnapshotWriter::~SnapshotWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(my_mutex);
+        my_is_stopping = true;
+    }
+    my_condition.notify_all();
+    my_thread.join();
+}
+
+void SnapshotWriter::save(const std::string& label, FederationSnapshot::Records records)
+{
+    {
+        std::lock_guard<std::mutex> lock(my_mutex);
+        my_jobs.emplace_back(label, std::move(records));
+    }
+    my_condition.notify_all();
+}
+
+bool SnapshotWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(my_mutex);
+    my_condition.wait(lock, [this] { return my_jobs.empty() && !my_is_writing; });
+    auto succeeded = !my_has_failed;
+    my_has_failed = false;
+    return succeeded;
+}
+
+bool SnapshotWriter::poll(bool& succeeded)
+{
+    std::lock_guard<std::mutex> lock(my_mutex);
+    if (!my_jobs.empty() || my_is_writing) {
+        return false;
+    }
+    succeeded = !my_has_failed;
+    my_has_failed = false;
+    return true;
+}
+
+uint32_t SnapshotWriter::getMaxDeltas() const
+{
+    return my_max_deltas;
+}
+
+void SnapshotWriter::run()
+{
+    std::unique_lock<std::mutex> lock(my_mutex);
+    while (true) {
+        my_condition.wait(lock, [this] { return !my_jobs.empty() || my_is_stopping; });
+        if (my_jobs.empty()) {
+            return;
+        }
+
+        auto job = std::move(my_jobs.front());
+        my_jobs.pop_front();
+        my_is_writing = true;
+        lock.unlock();
+
+        write(job.first, std::move(job.second));
+
+        lock.lock();
+        my_is_writing = false;
+        my_condition.notify_all();
+    }
+}
+
+void SnapshotWriter::write(const std::string& label, FederationSnapshot::Records records)
+{
+    // Overwriting a link of the chain would break the deltas above it
+    const bool full = my_chain.empty() || my_chain.size() > my_max_deltas
+        || std::any_of(begin(my_chain), end(my_chain), [&label](const std::pair<std::string, uint64_t>& link) {
+               return link.first == label;
+           });
+
+    uint64_t written;
+    if (full) {
+        written = FederationSnapshot::write(my_federation, label, "", 0, records, {});
+    }
+    else {
+        FederationSnapshot::Records changed;
+        std::set_difference(begin(records),
+                            end(records),
+                            begin(my_previous),
+                            end(my_previous),
+                            std::inserter(changed, end(changed)));
+
+        std::vector<FederationSnapshot::Key> removed;
+        for (const auto& record : my_previous) {
+            if (records.find(record.first) == end(records)) {
+                removed.push_back(record.first);
+            }
+        }
+
+        written = FederationSnapshot::write(
+            my_federation, label, my_chain.back().first, my_chain.back().second, changed, removed);
+        Debug(D, pdDebug) << "Snapshot " << label << " changes " << changed.size() << " and removes "
+                          << removed.size() << " of " << records.size() << " records" << std::endl;
+    }
+
+    if (written == 0) {
+        // The next snapshot must not depend on this one
+        my_chain.clear();
+        my_previous.clear();
+        std::lock_guard<std::mutex> lock(my_mutex);
+        my_has_failed = true;
+        return;
+    }
+
+    if (full) {
+        my_chain.clear();
+    }
+    my_chain.emplace_back(label, written);
+    my_previous = std::move(records);
+}
+}
+} // namespace certi/rtig
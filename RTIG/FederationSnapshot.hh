@@ -0,0 +1,192 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef _CERTI_RTIG_FEDERATION_SNAPSHOT_HH
+#define _CERTI_RTIG_FEDERATION_SNAPSHOT_HH
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace certi {
+namespace rtig {
+
+/**
+ * State of a federation saved under a label, as records of binary fields.
+ *
+ * A snapshot file holds either every record, or only the records which
+ * changed since the snapshot of another label, its base. Loading a delta
+ * loads its chain of bases first.
+ *
+ * File layout, integers in network byte order:
+ * - magic "CERTISNP", format version (uint32)
+ * - federation name, label, identifier (uint64)
+ * - base label (empty for a full snapshot), identifier of the base (uint64)
+ * - count (uint32), then kind (uint8), id (uint64), bytes of each record added or changed
+ * - count (uint32), then kind (uint8), id (uint64) of each record removed
+ *
+ * Strings and record bytes are prefixed by their length (uint32). A delta
+ * whose base was saved again under the same label cannot be loaded.
+ */
+class FederationSnapshot {
+public:
+    enum class Kind : uint8_t {
+        Federate = 1, ///< by federate handle
+        Object, ///< by object handle
+        ClassAttribute, ///< by object class handle << 32 | attribute handle
+        Interaction, ///< by interaction class handle
+        Region ///< by region handle
+    };
+
+    typedef std::pair<Kind, uint64_t> Key;
+    typedef std::map<Key, std::string> Records;
+
+    /// Append fields to the bytes of a record.
+    class Encoder {
+    public:
+        Encoder& uint8(const uint8_t value);
+        Encoder& uint32(const uint32_t value);
+        Encoder& uint64(const uint64_t value);
+        Encoder& real(const double value);
+        Encoder& string(const std::string& value);
+
+        const std::string& bytes() const;
+
+    private:
+        std::string my_bytes;
+    };
+
+    /// Read back the fields of a record, throw RTIinternalError past its end.
+    class Decoder {
+    public:
+        explicit Decoder(const std::string& bytes);
+        Decoder(const char* data, const size_t size);
+
+        uint8_t uint8();
+        uint32_t uint32();
+        uint64_t uint64();
+        double real();
+        std::string string();
+
+        bool atEnd() const;
+
+    private:
+        const char* take(const size_t size);
+
+        const char* my_data;
+        const char* my_end;
+    };
+
+    /// Name of the file holding the snapshot of a label, in the current directory.
+    static std::string filename(const std::string& federation, const std::string& label);
+
+    /**
+     * Write the snapshot of label, with the records changed or removed since
+     * the snapshot of base, or every record if base is empty.
+     * @return the identifier of the snapshot written, 0 if the file could not be written.
+     * A previous snapshot of label is then removed, it must not be restored instead.
+     */
+    static uint64_t write(const std::string& federation,
+                          const std::string& label,
+                          const std::string& base,
+                          const uint64_t baseIdentifier,
+                          const Records& changed,
+                          const std::vector<Key>& removed);
+
+    /**
+     * Read the records saved under label, following its chain of bases.
+     * The files are memory mapped while they are read.
+     * @throw RTIinternalError if a file of the chain is missing or invalid.
+     */
+    static Records load(const std::string& federation, const std::string& label);
+
+    /// Version of the file format.
+    static constexpr uint32_t the_version{1};
+
+    /// Length of a chain of deltas above which a snapshot is assumed to be corrupt.
+    static constexpr uint32_t the_max_chain_length{1024};
+};
+
+/**
+ * Write snapshots on a thread of its own, so that the event loop only pays
+ * for capturing the records.
+ *
+ * A snapshot is written as a delta against the previous one, unless the
+ * chain of deltas reached CERTI_SAVE_DELTAS (16 by default, 0 to always write
+ * full snapshots), its label is already in the chain, or the previous write
+ * failed.
+ */
+class SnapshotWriter {
+public:
+    explicit SnapshotWriter(const std::string& federation);
+    SnapshotWriter(const std::string& federation, const uint32_t maxDeltas);
+
+    /// Write the snapshots queued, then stop.
+    ~SnapshotWriter();
+
+    SnapshotWriter(const SnapshotWriter&) = delete;
+    SnapshotWriter& operator=(const SnapshotWriter&) = delete;
+
+    void save(const std::string& label, FederationSnapshot::Records records);
+
+    /// Wait until the snapshots queued are written. @return false if one of them failed.
+    bool flush();
+
+    /**
+     * Check without waiting whether the snapshots queued are written.
+     * @return true if they are, succeeded then is false if one of them failed.
+     */
+    bool poll(bool& succeeded);
+
+    uint32_t getMaxDeltas() const;
+
+private:
+    void run();
+
+    void write(const std::string& label, FederationSnapshot::Records records);
+
+    const std::string my_federation;
+    const uint32_t my_max_deltas;
+
+    std::mutex my_mutex;
+    std::condition_variable my_condition;
+    std::deque<std::pair<std::string, FederationSnapshot::Records>> my_jobs;
+    bool my_is_writing{false};
+    bool my_has_failed{false};
+    bool my_is_stopping{false};
+
+    /// Records and labels of the last snapshot written and of its bases, only used by the thread.
+    FederationSnapshot::Records my_previous;
+    std::vector<std::pair<std::string, uint64_t>> my_chain;
+
+    std::thread my_thread;
+};
+}
+} // namespace certi/rtig
+
+#endif // _CERTI_RTIG_FEDERATION_SNAPSHOT_HH
@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include "FederationWorkers.hh"
+
+#include <libCERTI/PrettyDebug.hh>
+
+namespace certi {
+namespace rtig {
+
+static PrettyDebug D("RTIG_WORKERS", __FILE__);
+
+FederationWorkers::FederationWorkers(const unsigned int count, Handler handler) : my_handler{handler}
+{
+    for (auto i(0u); i < count; ++i) {
+        my_queues.emplace_back(new Queue{});
+    }
+    for (auto& queue : my_queues) {
+        my_threads.emplace_back(&FederationWorkers::run, this, std::ref(*queue));
+    }
+    Debug(D, pdInit) << count << " federation workers started" << std::endl;
+}
+
+FederationWorkers::~FederationWorkers()
+{
+    // A null event stops the worker once the events queued before it are processed.
+    for (auto& queue : my_queues) {
+        queue->push(nullptr);
+    }
+    for (auto& thread : my_threads) {
+        thread.join();
+    }
+}
+
+unsigned int FederationWorkers::size() const
+{
+    return my_queues.size();
+}
+
+void FederationWorkers::dispatch(MessageEvent<NetworkMessage>&& event)
+{
+    auto index = event.message()->getFederation() % my_queues.size();
+
+    {
+        std::lock_guard<std::mutex> lock(my_mutex);
+        ++my_pending;
+    }
+
+    my_queues[index]->push(std::unique_ptr<MessageEvent<NetworkMessage>>(
+        new MessageEvent<NetworkMessage>(std::move(event))));
+}
+
+void FederationWorkers::drain()
+{
+    std::unique_lock<std::mutex> lock(my_mutex);
+    my_idle.wait(lock, [this] { return my_pending == 0; });
+}
+
+void FederationWorkers::run(Queue& queue)
+{
+    MessageBuffer buffer;
+
+    while (auto event = queue.pop()) {
+        try {
+            my_handler(std::move(*event), buffer);
+        }
+        // The handler answers the federate, the event must be counted as done anyway
+        catch (Exception& e) {
+            Debug(D, pdError) << "Federation worker dropped an event on Exception " << e.name()
+                              << ", reason: " << e.reason() << std::endl;
+        }
+        catch (std::exception& e) {
+            Debug(D, pdError) << "Federation worker dropped an event on " << e.what() << std::endl;
+        }
+        catch (...) {
+            Debug(D, pdError) << "Federation worker dropped an event on an unknown exception" << std::endl;
+        }
+        event.reset();
+
+        std::lock_guard<std::mutex> lock(my_mutex);
+        if (--my_pending == 0) {
+            my_idle.notify_all();
+        }
+    }
+}
+}
+} // namespace certi/rtig
@@ -0,0 +1,94 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_RTIG_FEDERATION_WORKERS_HH
+#define CERTI_RTIG_FEDERATION_WORKERS_HH
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <libHLA/MessageBuffer.hh>
+
+#include <libCERTI/MessageEvent.hh>
+#include <libCERTI/NetworkMessage.hh>
+
+#include "ConcurentQueue.hh"
+
+namespace certi {
+namespace rtig {
+
+/**
+ * FederationWorkers is a pool of threads processing the messages of the RTIG.
+ *
+ * Each federation is owned by a single worker, chosen from its handle, so
+ * that the messages of a federation are processed in the order they were
+ * received while several federations are processed in parallel.
+ *
+ * Operations touching more than one federation (create, join, destroy,
+ * connections) must not run concurrently with the workers: the RTIG calls
+ * drain() before processing them on its own thread.
+ */
+class FederationWorkers {
+public:
+    /// Process one event with the send buffer owned by the calling worker.
+    using Handler = std::function<void(MessageEvent<NetworkMessage>&& event, MessageBuffer& buffer)>;
+
+    /** Start the workers.
+     *
+     * @param count the number of worker threads
+     * @param handler called by a worker for each event dispatched to it
+     */
+    FederationWorkers(const unsigned int count, Handler handler);
+
+    /// Process pending events, then stop and join every worker.
+    ~FederationWorkers();
+
+    unsigned int size() const;
+
+    /// Queue the event for the worker owning the federation of its message.
+    void dispatch(MessageEvent<NetworkMessage>&& event);
+
+    /// Block until every dispatched event has been processed.
+    void drain();
+
+private:
+    using Queue = ConcurentQueue<std::unique_ptr<MessageEvent<NetworkMessage>>>;
+
+    void run(Queue& queue);
+
+    Handler my_handler;
+
+    std::vector<std::unique_ptr<Queue>> my_queues;
+    std::vector<std::thread> my_threads;
+
+    std::mutex my_mutex;
+    std::condition_variable my_idle;
+    unsigned long my_pending{0};
+};
+}
+} // namespace certi/rtig
+
+#endif // CERTI_RTIG_FEDERATION_WORKERS_HH
@@ -29,8 +29,10 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
 // #include <ext/alloc_traits.h>
 #include <iostream>
+#include <limits>
 #include <list>
 #include <memory>
 #include <set>
@@ -52,6 +54,7 @@
 #include <libCERTI/ObjectClassSet.hh>
 #include <libCERTI/ObjectSet.hh>
 #include <libCERTI/PrettyDebug.hh>
+#include <libCERTI/RTIRegion.hh>
 #include <libCERTI/RootObject.hh>
 #include <libCERTI/SecurityServer.hh>
 #include <libCERTI/SocketTCP.hh>
@@ -68,9 +71,6 @@
 #include "libxml/xmlstring.h"
 #include <libxml/parser.h>
 // #include <libxml/tree.h>
-#define ROOT_NODE (const xmlChar*) "rtigSaveData"
-#define NODE_FEDERATION (const xmlChar*) "federation"
-#define NODE_FEDERATE (const xmlChar*) "federate"
 #endif // HAVE_XML
 
 #if defined(_WIN32) && !defined(__MINGW32__)
@@ -352,6 +352,9 @@ void Federation::openFomModules(std::vector<std::string> modules, const bool is_
 #endif
 
         Debug(D, pdExcept) << "Caught exception " << e.name() << " : " << e.reason() << std::endl;
+
+        // The modules before the failing one were merged, the federates get them with the next broadcast
+        updateSerializedFom();
         throw;
     }
 
@@ -359,138 +362,408 @@ void Federation::openFomModules(std::vector<std::string> modules, const bool is_
         Debug(D, pdDebug) << "ROOT OBJECT" << std::endl;
         my_root_object->display();
 #endif
+
+    if (!modules.empty()) {
+        updateSerializedFom();
+    }
 }
 
-bool Federation::saveXmlData()
+void Federation::updateSerializedFom()
 {
-#ifndef HAVE_XML
-    return false;
-#else
-    xmlDocPtr doc = xmlNewDoc((const xmlChar*) "1.0");
-    doc->children = xmlNewDocNode(doc, NULL, ROOT_NODE, NULL);
+    NM_Additional_Fom_Module fom;
+    my_root_object->convertToSerializedFOM(fom);
 
-    xmlNodePtr federation;
-    federation = xmlNewChild(doc->children, NULL, NODE_FEDERATION, NULL);
+    std::set<SpaceHandle> spaces;
+    for (const auto& space : my_serialized_fom.getRoutingSpaces()) {
+        spaces.insert(space.getSpace());
+    }
+    std::set<ObjectClassHandle> object_classes;
+    for (const auto& object_class : my_serialized_fom.getObjectClasses()) {
+        object_classes.insert(object_class.getHandle());
+    }
+    std::set<InteractionClassHandle> interaction_classes;
+    for (const auto& interaction_class : my_serialized_fom.getInteractionClasses()) {
+        interaction_classes.insert(interaction_class.getInteractionClass());
+    }
 
-    xmlSetProp(federation, (const xmlChar*) "name", (const xmlChar*) my_name.c_str());
+    // The federates already joined have the other ones, see RootObject::rebuildFromSerializedFOM.
+    // What is still pending is kept, it was not broadcast if the merge failed.
+    for (const auto& space : fom.getRoutingSpaces()) {
+        if (!spaces.count(space.getSpace())) {
+            const auto index = my_fom_delta.getRoutingSpacesSize();
+            my_fom_delta.setRoutingSpacesSize(index + 1);
+            my_fom_delta.getRoutingSpaces(index) = space;
+        }
+    }
+    for (const auto& object_class : fom.getObjectClasses()) {
+        if (!object_classes.count(object_class.getHandle())) {
+            const auto index = my_fom_delta.getObjectClassesSize();
+            my_fom_delta.setObjectClassesSize(index + 1);
+            my_fom_delta.getObjectClasses(index) = object_class;
+        }
+    }
+    for (const auto& interaction_class : fom.getInteractionClasses()) {
+        if (!interaction_classes.count(interaction_class.getInteractionClass())) {
+            const auto index = my_fom_delta.getInteractionClassesSize();
+            my_fom_delta.setInteractionClassesSize(index + 1);
+            my_fom_delta.getInteractionClasses(index) = interaction_class;
+        }
+    }
 
-    char t[10];
-    sprintf(t, "%u", my_handle.get());
-    xmlSetProp(federation, (const xmlChar*) "handle", (const xmlChar*) t);
+    my_serialized_fom = std::move(fom);
 
-    xmlNodePtr federateXmlNode;
+    Debug(D, pdDebug) << my_fom_delta.getObjectClassesSize()
+                      << " object classes and " << my_fom_delta.getInteractionClassesSize()
+                      << " interaction classes not sent yet" << std::endl;
+}
 
-    //     for (HandleFederateMap::iterator i = _handleFederateMap.begin(); i != _handleFederateMap.end(); ++i) {
-    for (const auto& kv : my_federates) {
-        federateXmlNode = xmlNewChild(federation, NULL, NODE_FEDERATE, NULL);
+namespace {
+/// Publishers and subscribers of a class attribute or an interaction class, if any.
+bool encodeSubscription(FederationSnapshot::Encoder& encoder,
+                        const std::set<FederateHandle>& publishers,
+                        const std::list<Subscriber>& subscribers)
+{
+    if (publishers.empty() && subscribers.empty()) {
+        return false;
+    }
+    encoder.uint32(static_cast<uint32_t>(publishers.size()));
+    for (const auto& publisher : publishers) {
+        encoder.uint32(publisher);
+    }
+    encoder.uint32(static_cast<uint32_t>(subscribers.size()));
+    for (const auto& subscriber : subscribers) {
+        encoder.uint32(subscriber.getHandle()).uint32(subscriber.getRegion() ? subscriber.getRegion()->getHandle() : 0);
+    }
+    return true;
+}
 
-        xmlSetProp(federateXmlNode, (const xmlChar*) "name", (const xmlChar*) kv.second->getName().c_str());
+/// Compare a saved subscription, if any, with the current one, federates being matched by name.
+bool isSameSubscription(const FederationSnapshot::Records::const_iterator record,
+                        const FederationSnapshot::Records& records,
+                        const std::map<FederateHandle, FederateHandle>& federates,
+                        const std::set<FederateHandle>& publishers,
+                        const std::list<Subscriber>& subscribers)
+{
+    if (record == end(records)) {
+        return publishers.empty() && subscribers.empty();
+    }
 
-        sprintf(t, "%u", kv.second->getHandle());
-        xmlSetProp(federateXmlNode, (const xmlChar*) "handle", (const xmlChar*) t);
+    FederationSnapshot::Decoder decoder(record->second);
+    auto current = [&federates](const FederateHandle saved) {
+        auto it = federates.find(saved);
+        return it == end(federates) ? 0 : it->second;
+    };
 
-        xmlSetProp(federateXmlNode,
-                   (const xmlChar*) "constrained",
-                   (const xmlChar*) ((kv.second->isConstrained()) ? "true" : "false"));
-        xmlSetProp(federateXmlNode,
-                   (const xmlChar*) "regulator",
-                   (const xmlChar*) ((kv.second->isRegulator()) ? "true" : "false"));
+    std::set<FederateHandle> saved_publishers;
+    for (auto count = decoder.uint32(); count > 0; --count) {
+        saved_publishers.insert(current(decoder.uint32()));
     }
 
-    xmlSetDocCompressMode(doc, 9);
-
-    std::string filename = my_name + "_" + my_save_label + ".xcs";
-    xmlSaveFile(filename.c_str(), doc);
+    std::set<std::pair<FederateHandle, RegionHandle>> saved_subscribers;
+    for (auto count = decoder.uint32(); count > 0; --count) {
+        auto federate = current(decoder.uint32());
+        saved_subscribers.emplace(federate, decoder.uint32());
+    }
 
-    // TODO: tests
+    std::set<std::pair<FederateHandle, RegionHandle>> current_subscribers;
+    for (const auto& subscriber : subscribers) {
+        current_subscribers.emplace(subscriber.getHandle(),
+                                    subscriber.getRegion() ? subscriber.getRegion()->getHandle() : 0);
+    }
 
-    return true;
-#endif // HAVE_XML
+    return saved_publishers == publishers && saved_subscribers == current_subscribers;
+}
 }
 
-bool Federation::restoreXmlData(std::string docFilename)
+FederationSnapshot::Records Federation::captureSnapshot() const
 {
-#ifndef HAVE_XML
-    (void) docFilename;
-    return false;
-#else
+    typedef FederationSnapshot::Kind Kind;
+    FederationSnapshot::Records records;
 
-    xmlDocPtr doc = xmlParseFile(docFilename.c_str());
+    for (const auto& kv : my_federates) {
+        const Federate& federate = *kv.second;
+        const bool has_clock = my_regulators.exists(kv.first);
+
+        FederationSnapshot::Encoder encoder;
+        encoder.string(federate.getName())
+            .uint8(federate.isConstrained())
+            .uint8(federate.isRegulator())
+            .uint8(has_clock)
+            .real(has_clock ? my_regulators.get(kv.first).getTime() : 0.0)
+            .uint8(federate.isUsingNERx())
+            .real(federate.getLastNERxValue().getTime())
+            .uint8(federate.isClassRelevanceAdvisorySwitch())
+            .uint8(federate.isInteractionRelevanceAdvisorySwitch())
+            .uint8(federate.isAttributeRelevanceAdvisorySwitch())
+            .uint8(federate.isAttributeScopeAdvisorySwitch())
+            .uint8(federate.isConveyRegionDesignatorSetsSwitch())
+            .uint8(federate.isConveyProducingFederateSwitch())
+            .uint8(federate.isServiceReportingSwitch())
+            .uint8(federate.isExceptionReportingSwitch());
+        records[{Kind::Federate, kv.first}] = encoder.bytes();
+    }
 
-    // Did libXML manage to parse the file ?
-    if (doc == 0) {
-        std::cerr << "XML restore file not parsed successfully" << std::endl;
-        xmlFreeDoc(doc);
-        return false;
+    for (const auto instance : my_root_object->objects->getObjects()) {
+        if (!instance) {
+            continue;
+        }
+        const Object& object = *instance;
+
+        FederationSnapshot::Encoder encoder;
+        encoder.uint32(object.getClass()).string(object.getName()).uint32(object.getOwner());
+        encoder.uint32(static_cast<uint32_t>(object.getAttributes().size()));
+        for (const auto& attribute : object.getAttributes()) {
+            encoder.uint32(attribute.getHandle()).uint32(attribute.getOwner()).uint8(attribute.beingDivested());
+        }
+        records[{Kind::Object, object.getHandle()}] = encoder.bytes();
     }
-    xmlNodePtr cur;
 
-    cur = xmlDocGetRootElement(doc);
-    if (cur == 0) {
-        std::cerr << "XML file is empty" << std::endl;
-        xmlFreeDoc(doc);
-        return false;
+    for (auto it = my_root_object->ObjectClasses->handled_begin(); it != my_root_object->ObjectClasses->handled_end();
+         ++it) {
+        for (const auto& attribute : it->second->getHandleClassAttributeMap()) {
+            FederationSnapshot::Encoder encoder;
+            if (encodeSubscription(encoder, attribute.second->getPublishers(), attribute.second->getSubscribers())) {
+                records[{Kind::ClassAttribute, (static_cast<uint64_t>(it->first) << 32) | attribute.first}]
+                    = encoder.bytes();
+            }
+        }
     }
 
-    // Is this root element an ROOT_NODE ?
-    if (xmlStrcmp(cur->name, ROOT_NODE)) {
-        std::cerr << "Wrong XML file: not the expected root node" << std::endl;
-        return false;
+    for (auto it = my_root_object->Interactions->handled_begin(); it != my_root_object->Interactions->handled_end();
+         ++it) {
+        FederationSnapshot::Encoder encoder;
+        if (encodeSubscription(encoder, it->second->getPublishers(), it->second->getSubscribers())) {
+            records[{Kind::Interaction, it->first}] = encoder.bytes();
+        }
     }
 
-    cur = cur->xmlChildrenNode;
-    if (xmlStrcmp(cur->name, NODE_FEDERATION)) {
-        std::cerr << "Wrong XML file structure" << std::endl;
+    for (const auto region : my_root_object->getRegions()) {
+        FederationSnapshot::Encoder encoder;
+        encoder.uint32(region->getSpaceHandle()).uint32(static_cast<uint32_t>(region->getExtents().size()));
+        for (const auto& extent : region->getExtents()) {
+            encoder.uint32(static_cast<uint32_t>(extent.size()));
+            for (DimensionHandle dimension = 1; dimension <= extent.size(); ++dimension) {
+                encoder.uint32(extent.getRangeLowerBound(dimension)).uint32(extent.getRangeUpperBound(dimension));
+            }
+        }
+        records[{Kind::Region, region->getHandle()}] = encoder.bytes();
+    }
+
+    return records;
+}
+
+bool Federation::restoreSnapshot(const std::string& label)
+{
+    typedef FederationSnapshot::Kind Kind;
+
+    // A snapshot which could not be written must not be replaced by an older one of the same label
+    if (my_snapshot_writer && !my_snapshot_writer->flush()) {
+        Debug(D, pdError) << "Cannot restore federation " << my_name << ": a snapshot could not be written"
+                          << std::endl;
         return false;
     }
 
-    if (strcmp(my_name.c_str(), XmlParser::CleanXmlGetProp(cur, (const xmlChar*) "name")) != 0) {
-        std::cerr << "Wrong federation name" << std::endl;
+    FederationSnapshot::Records records;
+    try {
+        records = FederationSnapshot::load(my_name, label);
+    }
+    catch (RTIinternalError& e) {
+        Debug(D, pdError) << "Cannot restore federation " << my_name << ": " << e.reason() << std::endl;
+        return false;
     }
 
-    cur = cur->xmlChildrenNode;
+    auto recordsOf = [&records](const Kind kind) {
+        return std::make_pair(records.lower_bound({kind, 0}),
+                              records.upper_bound({kind, std::numeric_limits<uint64_t>::max()}));
+    };
 
-    bool status = false;
-    while (cur != NULL) {
-        if ((!xmlStrcmp(cur->name, NODE_FEDERATE))) {
-            //             for (HandleFederateMap::iterator i = _handleFederateMap.begin(); i != _handleFederateMap.end(); ++i) {
-            for (const auto& kv : my_federates) {
-                if (!strcmp(kv.second->getName().c_str(), XmlParser::CleanXmlGetProp(cur, (const xmlChar*) "name"))) {
-                    // Set federate constrained status
-                    status = !strcmp("true", XmlParser::CleanXmlGetProp(cur, (const xmlChar*) "constrained"));
+    // Handles may have changed since the save, federates are known by their names
+    std::map<FederateHandle, FederateHandle> federates;
+    uint32_t mismatches = 0;
 
-                    try {
-                        kv.second->setConstrained(status);
-                    }
-                    catch (RTIinternalError& e) {
-                        Debug(D, pdDebug) << "Federate was already constrained, no issue" << std::endl;
-                    }
+    // Every record is decoded and checked before any change, so a bad one leaves the federation as it was
+    std::vector<std::function<void()>> changes;
 
-                    // Set federate regulating status
-                    status = !strcmp("true", XmlParser::CleanXmlGetProp(cur, (const xmlChar*) "regulator"));
+    try {
+        for (auto range = recordsOf(Kind::Federate); range.first != range.second; ++range.first) {
+            FederationSnapshot::Decoder decoder(range.first->second);
+            auto name = decoder.string();
+
+            auto it = std::find_if(
+                begin(my_federates), end(my_federates), [&name](decltype(my_federates)::value_type& kv) {
+                    return kv.second->getName() == name;
+                });
+            if (it == end(my_federates)) {
+                Debug(D, pdError) << "Saved federate " << name << " is not in the federation" << std::endl;
+                ++mismatches;
+                continue;
+            }
+            Federate& federate = *it->second;
+            federates[static_cast<FederateHandle>(range.first->first.second)] = federate.getHandle();
 
-                    try {
-                        kv.second->setRegulator(status);
-                    }
-                    catch (RTIinternalError& e) {
-                        Debug(D, pdDebug) << "Federate was already regulator, no issue" << std::endl;
+            auto restore = [&decoder, &changes](const bool current, std::function<void(bool)> set) {
+                const bool saved = decoder.uint8();
+                if (saved != current) {
+                    changes.push_back([set, saved] { set(saved); });
+                }
+            };
+
+            restore(federate.isConstrained(), [&federate](bool value) { federate.setConstrained(value); });
+
+            // Becoming regulator or not goes through the time management services, not through a restore
+            const bool regulator = decoder.uint8();
+            const bool has_clock = decoder.uint8();
+            const FederationTime clock = decoder.real();
+            if (regulator != federate.isRegulator()) {
+                Debug(D, pdError) << "Federate " << name << " was " << (regulator ? "" : "not ")
+                                  << "regulator when saved" << std::endl;
+                ++mismatches;
+            }
+            else if (has_clock && my_regulators.exists(federate.getHandle())) {
+                changes.push_back([this, &federate, clock] {
+                    my_regulators.set(federate.getHandle(), clock);
+                    if (!federate.isUsingNERx()) {
+                        my_NERx_regulators.set(federate.getHandle(), clock);
                     }
+                });
+            }
 
-                    try {
-                        kv.second->setHandle(strtol(XmlParser::CleanXmlGetProp(cur, (const xmlChar*) "handle"), 0, 10));
-                    }
-                    catch (RTIinternalError& e) {
-                        Debug(D, pdDebug) << "Federate handle was already set, no issue" << std::endl;
-                    }
-                    break;
+            // NERx state follows the next time advance request
+            decoder.uint8();
+            decoder.real();
+
+            restore(federate.isClassRelevanceAdvisorySwitch(),
+                    [&federate](bool value) { federate.setClassRelevanceAdvisorySwitch(value); });
+            restore(federate.isInteractionRelevanceAdvisorySwitch(),
+                    [&federate](bool value) { federate.setInteractionRelevanceAdvisorySwitch(value); });
+            restore(federate.isAttributeRelevanceAdvisorySwitch(),
+                    [&federate](bool value) { federate.setAttributeRelevanceAdvisorySwitch(value); });
+            restore(federate.isAttributeScopeAdvisorySwitch(),
+                    [&federate](bool value) { federate.setAttributeScopeAdvisorySwitch(value); });
+            restore(federate.isConveyRegionDesignatorSetsSwitch(),
+                    [&federate](bool value) { federate.setConveyRegionDesignatorSetsSwitch(value); });
+            restore(federate.isConveyProducingFederateSwitch(),
+                    [&federate](bool value) { federate.setConveyProducingFederateSwitch(value); });
+            restore(federate.isServiceReportingSwitch(),
+                    [&federate](bool value) { federate.setServiceReportingSwitch(value); });
+            restore(federate.isExceptionReportingSwitch(),
+                    [&federate](bool value) { federate.setExceptionReportingSwitch(value); });
+        }
+
+        auto current = [&federates](const FederateHandle saved) {
+            auto it = federates.find(saved);
+            return it == end(federates) ? 0 : it->second;
+        };
+
+        // Objects are not created again, only the ownership of those left is restored
+        const auto& objects = my_root_object->objects->getObjects();
+        for (auto range = recordsOf(Kind::Object); range.first != range.second; ++range.first) {
+            auto handle = static_cast<ObjectHandle>(range.first->first.second);
+            auto instance = handle < objects.size() ? objects[handle] : nullptr;
+            FederationSnapshot::Decoder decoder(range.first->second);
+            if (!instance || instance->getClass() != decoder.uint32() || instance->getName() != decoder.string()) {
+                Debug(D, pdError) << "Saved object " << range.first->first.second << " is not in the federation"
+                                  << std::endl;
+                ++mismatches;
+                continue;
+            }
+            Object& object = *instance;
+            const auto owner = current(decoder.uint32());
+            changes.push_back([&object, owner] { object.setOwner(owner); });
+            for (auto count = decoder.uint32(); count > 0; --count) {
+                auto attribute = object.getAttribute(decoder.uint32());
+                const auto attribute_owner = current(decoder.uint32());
+                const bool divesting = decoder.uint8();
+                changes.push_back([attribute, attribute_owner, divesting] {
+                    attribute->setOwner(attribute_owner);
+                    attribute->setDivesting(divesting);
+                });
+            }
+        }
+        for (const auto instance : objects) {
+            if (instance && records.find({Kind::Object, instance->getHandle()}) == end(records)) {
+                Debug(D, pdError) << "Object " << instance->getHandle() << " was registered after the save"
+                                  << std::endl;
+                ++mismatches;
+            }
+        }
+
+        for (auto range = recordsOf(Kind::Region); range.first != range.second; ++range.first) {
+            FederationSnapshot::Decoder decoder(range.first->second);
+            auto handle = static_cast<RegionHandle>(range.first->first.second);
+            RTIRegion* region;
+            try {
+                region = my_root_object->getRegion(handle);
+            }
+            catch (RegionNotKnown&) {
+                Debug(D, pdError) << "Saved region " << handle << " is not in the federation" << std::endl;
+                ++mismatches;
+                continue;
+            }
+            if (region->getSpaceHandle() != decoder.uint32()) {
+                Debug(D, pdError) << "Saved region " << handle << " belongs to another routing space" << std::endl;
+                ++mismatches;
+                continue;
+            }
+            std::vector<Extent> extents;
+            for (auto count = decoder.uint32(); count > 0; --count) {
+                extents.emplace_back(decoder.uint32());
+                for (DimensionHandle dimension = 1; dimension <= extents.back().size(); ++dimension) {
+                    extents.back().setRangeLowerBound(dimension, decoder.uint32());
+                    extents.back().setRangeUpperBound(dimension, decoder.uint32());
+                }
+            }
+            if (extents.size() != region->getNumberOfExtents()) {
+                throw InvalidExtents("Saved region " + std::to_string(handle) + " has "
+                                     + std::to_string(extents.size()) + " extents instead of "
+                                     + std::to_string(region->getNumberOfExtents()));
+            }
+            changes.push_back([this, handle, extents] { my_root_object->modifyRegion(handle, extents); });
+        }
+
+        // Declarations are the federates' own to restore, they are only checked here
+        for (auto it = my_root_object->ObjectClasses->handled_begin();
+             it != my_root_object->ObjectClasses->handled_end();
+             ++it) {
+            for (const auto& attribute : it->second->getHandleClassAttributeMap()) {
+                auto record = records.find(
+                    {Kind::ClassAttribute, (static_cast<uint64_t>(it->first) << 32) | attribute.first});
+                if (!isSameSubscription(record,
+                                        records,
+                                        federates,
+                                        attribute.second->getPublishers(),
+                                        attribute.second->getSubscribers())) {
+                    Debug(D, pdDebug) << "Declarations of attribute " << attribute.first << " of class "
+                                      << it->first << " changed since the save" << std::endl;
                 }
             }
         }
-        cur = cur->next;
+        for (auto it = my_root_object->Interactions->handled_begin(); it != my_root_object->Interactions->handled_end();
+             ++it) {
+            auto record = records.find({Kind::Interaction, it->first});
+            if (!isSameSubscription(record,
+                                    records,
+                                    federates,
+                                    it->second->getPublishers(),
+                                    it->second->getSubscribers())) {
+                Debug(D, pdDebug) << "Declarations of interaction class " << it->first << " changed since the save"
+                                  << std::endl;
+            }
+        }
+    }
+    catch (Exception& e) {
+        Debug(D, pdError) << "Cannot restore federation " << my_name << ": " << e.name() << " " << e.reason()
+                          << std::endl;
+        return false;
     }
 
-    return status;
-#endif // HAVE_XML
+    for (const auto& change : changes) {
+        change();
+    }
+
+    Debug(D, pdDebug) << "Restored federation " << my_name << " from " << label << " with " << mismatches
+                      << " mismatches" << std::endl;
+    return true;
 }
 }
 }
@@ -187,6 +187,48 @@ Responses FederationsList::killFederate(const FederationHandle federation, const
     }
 }
 
+std::chrono::steady_clock::time_point FederationsList::getNextMomReportTime() const
+{
+    auto next_report = std::chrono::steady_clock::time_point::max();
+    for (const auto& kv : my_federations) {
+        next_report = std::min(next_report, kv.second->getNextMomReportTime());
+    }
+    return next_report;
+}
+
+Responses FederationsList::provideMomReports(const std::chrono::steady_clock::time_point now)
+{
+    Responses responses;
+    for (const auto& kv : my_federations) {
+        if (kv.second->getNextMomReportTime() <= now) {
+            auto resp = kv.second->provideMomReports(now);
+            responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
+        }
+    }
+    return responses;
+}
+
+std::chrono::steady_clock::time_point FederationsList::getNextSaveCheckTime() const
+{
+    auto next_check = std::chrono::steady_clock::time_point::max();
+    for (const auto& kv : my_federations) {
+        next_check = std::min(next_check, kv.second->getNextSaveCheckTime());
+    }
+    return next_check;
+}
+
+Responses FederationsList::provideSaveResults(const std::chrono::steady_clock::time_point now)
+{
+    Responses responses;
+    for (const auto& kv : my_federations) {
+        if (kv.second->getNextSaveCheckTime() <= now) {
+            auto resp = kv.second->provideSaveResult(now);
+            responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
+        }
+    }
+    return responses;
+}
+
 Federation& FederationsList::searchFederation(const FederationHandle handle)
 {
     auto it = my_federations.find(handle);
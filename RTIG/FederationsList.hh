@@ -23,6 +23,7 @@
 #ifndef _CERTI_RTIG_FEDERATIONS_LIST_HH
 #define _CERTI_RTIG_FEDERATIONS_LIST_HH
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -105,6 +106,22 @@ public:
      */
     Responses killFederate(const FederationHandle federation, const FederateHandle federate) noexcept;
 
+    // ---------
+    // -- MOM --
+    // ---------
+
+    /// Earliest time at which a federation has MOM reports to send, time_point::max() if none.
+    std::chrono::steady_clock::time_point getNextMomReportTime() const;
+
+    /// Provide the MOM reports of every federation which are due at now.
+    Responses provideMomReports(const std::chrono::steady_clock::time_point now);
+
+    /// Earliest time at which a federation checks the snapshot of its save, time_point::max() if none.
+    std::chrono::steady_clock::time_point getNextSaveCheckTime() const;
+
+    /// End the saves of the federations whose snapshot is written.
+    Responses provideSaveResults(const std::chrono::steady_clock::time_point now);
+
     /** Search federation from handle.
      * 
      * @param[in] handle the handle of the search federation
@@ -90,6 +90,8 @@ Responses MessageProcessor::processEvent(MessageEvent<NetworkMessage> request)
         BASIC_CASE(REGISTER_OBJECT, NM_Register_Object);
         BASIC_CASE(DELETE_OBJECT, NM_Delete_Object);
         BASIC_CASE(IS_ATTRIBUTE_OWNED_BY_FEDERATE, NM_Is_Attribute_Owned_By_Federate);
+        BASIC_CASE(CHANGE_ATTRIBUTE_TRANSPORT_TYPE, NM_Change_Attribute_Transport_Type);
+        BASIC_CASE(CHANGE_INTERACTION_TRANSPORT_TYPE, NM_Change_Interaction_Transport_Type);
         BASIC_CASE(QUERY_ATTRIBUTE_OWNERSHIP, NM_Query_Attribute_Ownership);
         BASIC_CASE(NEGOTIATED_ATTRIBUTE_OWNERSHIP_DIVESTITURE, NM_Negotiated_Attribute_Ownership_Divestiture);
         BASIC_CASE(ATTRIBUTE_OWNERSHIP_ACQUISITION_IF_AVAILABLE, NM_Attribute_Ownership_Acquisition_If_Available);
@@ -455,22 +457,23 @@ Responses MessageProcessor::process(MessageEvent<NM_Message_Null>&& request, boo
     Debug(DNULL, pdDebug) << "Rcv NULL MSG (Federate=" << request.message()->getFederate()
                           << ", Time = " << request.message()->getDate().getTime() << ")" << endl;
         
+    Responses responses;
+
     // Catch all exceptions because RTIA does not expect an answer anyway.
     try {
-        return my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
-            .updateRegulator(request.message()->getFederate(),
-                             request.message()->getDate(),
-                             /*request.message()->getLogicalTime(),
-                             request.message()->getLookahead(),
-                             request.message()->getState(),
-                             request.message()->getGalt(),
-                             request.message()->getLits(),*/
-                             anonymous);
+        responses = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
+                        .updateRegulator(request.message()->getFederate(), request.message()->getDate(), anonymous);
     }
     catch (Exception& e) {
     }
 
-    return {};
+    // The time state for the MOM travels with the NULL messages when it changed
+    if (!anonymous && request.message()->hasTimeState()) {
+        auto mom_responses = updateTimeState(*request.message(), request.message()->getTimeState());
+        responses.insert(end(responses), make_move_iterator(begin(mom_responses)), make_move_iterator(end(mom_responses)));
+    }
+
+    return responses;
 }
 
 Responses MessageProcessor::process(MessageEvent<NM_Message_Null_Prime>&& request)
@@ -869,24 +872,37 @@ Responses MessageProcessor::process(MessageEvent<NM_Update_Attribute_Values>&& r
                    << ", Date = " << request.message()->getDate().getTime();
 
     // Forward the call
-    if (request.message()->isDated()) {
-        // UAV with time
-        responses = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
-                        .updateAttributeValues(request.message()->getFederate(),
-                                               request.message()->getObject(),
-                                               request.message()->getAttributes(),
-                                               request.message()->getValues(),
-                                               request.message()->getDate(),
-                                               request.message()->getLabel());
+    try {
+        if (request.message()->isDated()) {
+            // UAV with time
+            responses = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
+                            .updateAttributeValues(request.message()->getFederate(),
+                                                   request.message()->getObject(),
+                                                   request.message()->getAttributes(),
+                                                   request.message()->getValues(),
+                                                   request.message()->getDate(),
+                                                   request.message()->getLabel());
+        }
+        else {
+            // UAV without time
+            responses = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
+                            .updateAttributeValues(request.message()->getFederate(),
+                                                   request.message()->getObject(),
+                                                   request.message()->getAttributes(),
+                                                   request.message()->getValues(),
+                                                   request.message()->getLabel());
+        }
     }
-    else {
-        // UAV without time
-        responses = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
-                        .updateAttributeValues(request.message()->getFederate(),
-                                               request.message()->getObject(),
-                                               request.message()->getAttributes(),
-                                               request.message()->getValues(),
-                                               request.message()->getLabel());
+    catch (Exception& e) {
+        if (!request.message()->hasSequence()) {
+            throw;
+        }
+        return pipelinedFailure(request, e);
+    }
+
+    // A pipelining RTIA did not wait for the answer
+    if (request.message()->hasSequence()) {
+        return responses;
     }
 
     // Building answer (Network Message)
@@ -919,30 +935,43 @@ Responses MessageProcessor::process(MessageEvent<NM_Send_Interaction>&& request)
     // Building Value Array
     my_auditServer << "IntID = " << request.message()->getInteractionClass()
                    << ", date = " << request.message()->getDate().getTime();
-    if (request.message()->isDated()) {
-        responses = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
-                        .broadcastInteraction(request.message()->getFederate(),
-                                              request.message()->getInteractionClass(),
-                                              request.message()->getParameters(),
-                                              request.message()->getValues(),
-                                              request.message()->getDate(),
-                                              request.message()->getRegion(),
-                                              request.message()->getLabel());
+    try {
+        if (request.message()->isDated()) {
+            responses = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
+                            .broadcastInteraction(request.message()->getFederate(),
+                                                  request.message()->getInteractionClass(),
+                                                  request.message()->getParameters(),
+                                                  request.message()->getValues(),
+                                                  request.message()->getDate(),
+                                                  request.message()->getRegion(),
+                                                  request.message()->getLabel());
+        }
+        else {
+            responses = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
+                            .broadcastInteraction(request.message()->getFederate(),
+                                                  request.message()->getInteractionClass(),
+                                                  request.message()->getParameters(),
+                                                  request.message()->getValues(),
+                                                  request.message()->getParametersSize(),
+                                                  request.message()->getRegion(),
+                                                  request.message()->getLabel());
+        }
     }
-    else {
-        responses = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
-                        .broadcastInteraction(request.message()->getFederate(),
-                                              request.message()->getInteractionClass(),
-                                              request.message()->getParameters(),
-                                              request.message()->getValues(),
-                                              request.message()->getParametersSize(),
-                                              request.message()->getRegion(),
-                                              request.message()->getLabel());
+    catch (Exception& e) {
+        if (!request.message()->hasSequence()) {
+            throw;
+        }
+        return pipelinedFailure(request, e);
     }
 
     Debug(D, pdDebug) << "Interaction " << request.message()->getInteractionClass() << " parameters update completed"
                       << endl;
 
+    // A pipelining RTIA did not wait for the answer
+    if (request.message()->hasSequence()) {
+        return responses;
+    }
+
     auto rep = make_unique<NM_Send_Interaction>();
     rep->setFederate(request.message()->getFederate());
     rep->setInteractionClass(request.message()->getInteractionClass());
@@ -962,6 +991,26 @@ Responses MessageProcessor::process(MessageEvent<NM_Send_Interaction>&& request)
     return responses;
 }
 
+template <typename T>
+Responses MessageProcessor::pipelinedFailure(MessageEvent<T>& request, const Exception& e)
+{
+    Responses responses;
+
+    Debug(D, pdExcept) << "Pipelined request " << request.message()->getSequence() << " of federate "
+                       << request.message()->getFederate() << " failed: " << e.name() << " - " << e.reason() << endl;
+
+    my_auditServer << " - failed pipelined request " << request.message()->getSequence() << ": " << e.name();
+
+    auto rep = make_unique<T>();
+    rep->setFederate(request.message()->getFederate());
+    rep->setSequence(request.message()->getSequence());
+    rep->setException(e.type(), e.reason());
+
+    responses.emplace_back(request.sockets().front(), std::move(rep));
+
+    return responses;
+}
+
 Responses MessageProcessor::process(MessageEvent<NM_Delete_Object>&& request)
 {
     Responses responses;
@@ -1184,6 +1233,53 @@ Responses MessageProcessor::process(MessageEvent<NM_Is_Attribute_Owned_By_Federa
     return responses;
 }
 
+Responses MessageProcessor::process(MessageEvent<NM_Change_Attribute_Transport_Type>&& request)
+{
+    Responses responses;
+
+    my_auditServer.setLevel(AuditLine::Level(2));
+
+    Debug(D, pdDebug) << "Transport change of " << request.message()->getAttributesSize() << " attributes of Object "
+                      << request.message()->getObject() << endl;
+
+    my_auditServer << "ObjectHandle = " << request.message()->getObject();
+
+    // The RTIAs keep the transport of the attributes, the RTIG only checks they may change it
+    my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
+        .checkOwned(request.message()->getFederate(), request.message()->getObject(), request.message()->getAttributes());
+
+    auto rep = make_unique<NM_Change_Attribute_Transport_Type>();
+    rep->setFederate(request.message()->getFederate());
+    rep->setObject(request.message()->getObject());
+
+    responses.emplace_back(request.sockets().front(), std::move(rep));
+
+    return responses;
+}
+
+Responses MessageProcessor::process(MessageEvent<NM_Change_Interaction_Transport_Type>&& request)
+{
+    Responses responses;
+
+    my_auditServer.setLevel(AuditLine::Level(2));
+
+    Debug(D, pdDebug) << "Transport change of Interaction " << request.message()->getInteractionClass() << endl;
+
+    my_auditServer << "InteractionClassHandle = " << request.message()->getInteractionClass();
+
+    // The RTIAs keep the transport of the interactions, the RTIG only checks they may change it
+    my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
+        .checkPublishing(request.message()->getFederate(), request.message()->getInteractionClass());
+
+    auto rep = make_unique<NM_Change_Interaction_Transport_Type>();
+    rep->setFederate(request.message()->getFederate());
+    rep->setInteractionClass(request.message()->getInteractionClass());
+
+    responses.emplace_back(request.sockets().front(), std::move(rep));
+
+    return responses;
+}
+
 Responses MessageProcessor::process(MessageEvent<NM_Attribute_Ownership_Release_Response>&& request)
 {
     Responses responses;
@@ -1551,18 +1647,23 @@ Responses MessageProcessor::process(MessageEvent<NM_Disable_Asynchronous_Deliver
 
 Responses MessageProcessor::process(MessageEvent<NM_Time_State_Update>&& request)
 {
-    Debug(DTUS, pdDebug) << "Rcv Time State Update (Federate=" << request.message()->getFederate()
-                          << ", Time = " << request.message()->getDate().getTime() << ")" << endl;
-        
+    return updateTimeState(*request.message(), request.message()->getTimeState());
+}
+
+Responses MessageProcessor::updateTimeState(const NetworkMessage& message, const NM_Time_State& state)
+{
+    Debug(DTUS, pdDebug) << "Rcv Time State Update (Federate=" << message.getFederate()
+                         << ", Time = " << state.getTime() << ")" << endl;
+
     // Catch all exceptions because RTIA does not expect an answer anyway.
     try {
-        return my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
-            .updateTimeState(request.message()->getFederate(),
-                             request.message()->getDate(),
-                             request.message()->getLookahead(),
-                             request.message()->getState(),
-                             request.message()->getGalt(),
-                             request.message()->getLits());
+        return my_federations.searchFederation(FederationHandle(message.getFederation()))
+            .updateTimeState(message.getFederate(),
+                             state.getTime(),
+                             state.getLookahead(),
+                             state.getState(),
+                             state.getGalt(),
+                             state.getLits());
     }
     catch (Exception& e) {
     }
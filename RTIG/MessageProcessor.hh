@@ -100,6 +100,8 @@ private:
     Responses process(MessageEvent<NM_Attribute_Ownership_Acquisition>&& request);
     Responses process(MessageEvent<NM_Cancel_Negotiated_Attribute_Ownership_Divestiture>&& request);
     Responses process(MessageEvent<NM_Is_Attribute_Owned_By_Federate>&& request);
+    Responses process(MessageEvent<NM_Change_Attribute_Transport_Type>&& request);
+    Responses process(MessageEvent<NM_Change_Interaction_Transport_Type>&& request);
     Responses process(MessageEvent<NM_Attribute_Ownership_Release_Response>&& request);
     Responses process(MessageEvent<NM_Cancel_Attribute_Ownership_Acquisition>&& request);
     Responses process(MessageEvent<NM_DDM_Create_Region>&& request);
@@ -118,6 +120,17 @@ private:
     Responses process(MessageEvent<NM_Disable_Asynchronous_Delivery>&& request);
     Responses process(MessageEvent<NM_Time_State_Update>&& request);
 
+    /// Report the time state of the federate sending a message to the MOM of its federation.
+    Responses updateTimeState(const NetworkMessage& message, const NM_Time_State& state);
+
+    /** Answer a pipelined UAV or interaction which failed.
+     *
+     * The RTIA did not wait for the outcome of the request, so the exception is not
+     * thrown back to the RTIG but sent as a message carrying the request sequence number.
+     */
+    template <typename T>
+    Responses pipelinedFailure(MessageEvent<T>& request, const Exception& e);
+
     AuditFile& my_auditServer;
     SocketServer& my_socketServer;
     HandleManager<Handle>& my_federationHandleGenerator;
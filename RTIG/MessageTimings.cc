@@ -0,0 +1,294 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include "MessageTimings.hh"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <memory>
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <signal.h>
+#endif
+
+#include <libCERTI/NM_Classes.hh>
+#include <libCERTI/PrettyDebug.hh>
+
+namespace certi {
+namespace rtig {
+
+static PrettyDebug D("RTIG_TIMINGS", __FILE__);
+
+constexpr size_t MessageTimings::the_stage_count;
+constexpr size_t MessageTimings::Histogram::the_sub_bucket_bits;
+constexpr unsigned MessageTimings::Histogram::the_max_exponent;
+constexpr size_t MessageTimings::Histogram::the_bucket_count;
+
+void MessageTimings::Histogram::record(const uint64_t value)
+{
+    my_buckets[bucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+    my_count.fetch_add(1, std::memory_order_relaxed);
+    my_sum.fetch_add(value, std::memory_order_relaxed);
+
+    auto min = my_min.load(std::memory_order_relaxed);
+    while (value < min && !my_min.compare_exchange_weak(min, value, std::memory_order_relaxed)) {
+    }
+    auto max = my_max.load(std::memory_order_relaxed);
+    while (value > max && !my_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t MessageTimings::Histogram::count() const
+{
+    return my_count.load(std::memory_order_relaxed);
+}
+
+uint64_t MessageTimings::Histogram::min() const
+{
+    return count() == 0 ? 0 : my_min.load(std::memory_order_relaxed);
+}
+
+uint64_t MessageTimings::Histogram::max() const
+{
+    return my_max.load(std::memory_order_relaxed);
+}
+
+uint64_t MessageTimings::Histogram::sum() const
+{
+    return my_sum.load(std::memory_order_relaxed);
+}
+
+uint64_t MessageTimings::Histogram::valueAtQuantile(const double quantile) const
+{
+    // Buckets are read one by one while being recorded, their own total is the reference
+    uint64_t total{0};
+    for (const auto& bucket : my_buckets) {
+        total += bucket.load(std::memory_order_relaxed);
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    auto rank = static_cast<uint64_t>(quantile * total + 0.5);
+    rank = std::max<uint64_t>(1, std::min(rank, total));
+
+    uint64_t seen{0};
+    for (size_t i = 0; i < the_bucket_count; ++i) {
+        seen += my_buckets[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            return std::min(bucketUpperBound(i), max());
+        }
+    }
+    return max();
+}
+
+uint64_t MessageTimings::Histogram::bucketCount(const size_t bucket) const
+{
+    return my_buckets[bucket].load(std::memory_order_relaxed);
+}
+
+size_t MessageTimings::Histogram::bucketOf(const uint64_t value)
+{
+    constexpr uint64_t sub_buckets{1u << the_sub_bucket_bits};
+    if (value < sub_buckets) {
+        return static_cast<size_t>(value);
+    }
+
+#ifdef __GNUC__
+    unsigned exponent = 63 - __builtin_clzll(value);
+#else
+    unsigned exponent = the_sub_bucket_bits;
+    while (exponent < 63 && (value >> (exponent + 1)) != 0) {
+        ++exponent;
+    }
+#endif
+    if (exponent > the_max_exponent) {
+        return the_bucket_count - 1;
+    }
+
+    auto mantissa = (value >> (exponent - the_sub_bucket_bits)) & (sub_buckets - 1);
+    return ((exponent - the_sub_bucket_bits + 1) << the_sub_bucket_bits) + mantissa;
+}
+
+uint64_t MessageTimings::Histogram::bucketUpperBound(const size_t bucket)
+{
+    constexpr uint64_t sub_buckets{1u << the_sub_bucket_bits};
+    if (bucket < sub_buckets) {
+        return bucket;
+    }
+
+    auto exponent = (bucket >> the_sub_bucket_bits) + the_sub_bucket_bits - 1;
+    auto mantissa = bucket & (sub_buckets - 1);
+    return ((sub_buckets + mantissa + 1) << (exponent - the_sub_bucket_bits)) - 1;
+}
+
+MessageTimings::MessageTimings(const std::string& path, const std::chrono::seconds interval)
+    : my_path{path}
+    , my_interval{interval}
+    , my_histograms{new Histogram[NetworkMessage::the_message_type_count * the_stage_count]}
+{
+    Debug(D, pdInit) << "Message timings dumped to " << my_path << std::endl;
+}
+
+MessageTimings::~MessageTimings()
+{
+#ifndef _WIN32
+    if (my_dumper.joinable()) {
+        my_stopping = true;
+        pthread_kill(my_dumper.native_handle(), SIGUSR1);
+        my_dumper.join();
+    }
+#endif
+    dumpToFile();
+}
+
+void MessageTimings::record(const NetworkMessage::Type type, const Stage stage, const Clock::duration duration)
+{
+    auto index = static_cast<size_t>(type);
+    if (index >= NetworkMessage::the_message_type_count) {
+        return;
+    }
+    auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    my_histograms[index * the_stage_count + static_cast<size_t>(stage)].record(
+        static_cast<uint64_t>(std::max<decltype(nanoseconds)>(0, nanoseconds)));
+}
+
+const MessageTimings::Histogram& MessageTimings::histogram(const NetworkMessage::Type type, const Stage stage) const
+{
+    return my_histograms[static_cast<size_t>(type) * the_stage_count + static_cast<size_t>(stage)];
+}
+
+void MessageTimings::dump(std::ostream& stream) const
+{
+    static constexpr double quantiles[] = {0.5, 0.9, 0.99, 0.999};
+    static constexpr const char* quantileNames[] = {"p50", "p90", "p99", "p999"};
+
+    stream << "{\n  \"unit\": \"ns\",\n  \"timestamp\": " << std::time(nullptr) << ",\n  \"timings\": [";
+
+    bool first{true};
+    for (size_t type = 0; type < NetworkMessage::the_message_type_count; ++type) {
+        for (size_t stage = 0; stage < the_stage_count; ++stage) {
+            const auto& h = histogram(static_cast<NetworkMessage::Type>(type), static_cast<Stage>(stage));
+            auto count = h.count();
+            if (count == 0) {
+                continue;
+            }
+
+            std::string name{"unknown"};
+            try {
+                std::unique_ptr<NetworkMessage> message(NM_Factory::create(static_cast<NetworkMessage::Type>(type)));
+                name = message->getMessageName();
+            }
+            catch (Exception&) {
+            }
+
+            stream << (first ? "\n" : ",\n") << "    {\"type\": " << type << ", \"name\": \"" << name
+                   << "\", \"stage\": \"" << stageName(static_cast<Stage>(stage)) << "\", \"count\": " << count
+                   << ", \"min\": " << h.min() << ", \"max\": " << h.max() << ", \"mean\": " << h.sum() / count;
+            for (size_t i = 0; i < sizeof(quantiles) / sizeof(quantiles[0]); ++i) {
+                stream << ", \"" << quantileNames[i] << "\": " << h.valueAtQuantile(quantiles[i]);
+            }
+
+            // Non empty buckets, as [highest value, count] pairs
+            stream << ", \"buckets\": [";
+            bool first_bucket{true};
+            for (size_t bucket = 0; bucket < Histogram::the_bucket_count; ++bucket) {
+                auto bucket_count = h.bucketCount(bucket);
+                if (bucket_count != 0) {
+                    stream << (first_bucket ? "" : ", ") << "[" << Histogram::bucketUpperBound(bucket) << ", "
+                           << bucket_count << "]";
+                    first_bucket = false;
+                }
+            }
+            stream << "]}";
+            first = false;
+        }
+    }
+
+    stream << "\n  ]\n}\n";
+}
+
+bool MessageTimings::dumpToFile() const
+{
+    auto temporary = my_path + ".tmp";
+    {
+        std::ofstream file(temporary);
+        if (!file) {
+            Debug(D, pdError) << "Cannot write message timings to " << temporary << std::endl;
+            return false;
+        }
+        dump(file);
+    }
+    if (std::rename(temporary.c_str(), my_path.c_str()) != 0) {
+        Debug(D, pdError) << "Cannot write message timings to " << my_path << std::endl;
+        return false;
+    }
+    Debug(D, pdDebug) << "Message timings dumped to " << my_path << std::endl;
+    return true;
+}
+
+#ifndef _WIN32
+void MessageTimings::startDumping()
+{
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGUSR1);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    my_dumper = std::thread([this, signals] {
+        while (!my_stopping) {
+            int signal;
+            if (my_interval.count() > 0) {
+                timespec timeout{static_cast<time_t>(my_interval.count()), 0};
+                signal = sigtimedwait(&signals, nullptr, &timeout);
+            }
+            else {
+                signal = sigwaitinfo(&signals, nullptr);
+            }
+
+            // Timeouts are periodic dumps, other errors are interruptions by other signals
+            if (!my_stopping && (signal == SIGUSR1 || (signal < 0 && errno == EAGAIN))) {
+                dumpToFile();
+            }
+        }
+    });
+}
+#endif
+
+const char* MessageTimings::stageName(const Stage stage)
+{
+    switch (stage) {
+    case Stage::Receive:
+        return "receive";
+    case Stage::Process:
+        return "process";
+    case Stage::Send:
+        return "send";
+    }
+    return "unknown";
+}
+}
+} // namespace certi/rtig
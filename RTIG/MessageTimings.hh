@@ -0,0 +1,133 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_RTIG_MESSAGE_TIMINGS_HH
+#define CERTI_RTIG_MESSAGE_TIMINGS_HH
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <thread>
+
+#include <libCERTI/NetworkMessage.hh>
+
+namespace certi {
+namespace rtig {
+
+/**
+ * Latency histograms of the RTIG, per NetworkMessage type and processing stage.
+ *
+ * Recording is lock-free, so that the RTIG thread and the federation workers
+ * record concurrently while the histograms are dumped. Dumps are JSON
+ * documents, written on SIGUSR1, every interval if any, and at destruction.
+ */
+class MessageTimings {
+public:
+    enum class Stage { Receive, Process, Send };
+    static constexpr size_t the_stage_count{3};
+
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Histogram with buckets of logarithmic size, as HDR histograms.
+     * Each power of two is split in 8 buckets, so values are known within 12.5%.
+     */
+    class Histogram {
+    public:
+        static constexpr size_t the_sub_bucket_bits{3};
+        /// Longer durations are recorded in the last bucket (about 18 minutes).
+        static constexpr unsigned the_max_exponent{40};
+        static constexpr size_t the_bucket_count{((the_max_exponent - the_sub_bucket_bits + 2) << the_sub_bucket_bits)};
+
+        void record(const uint64_t value);
+
+        uint64_t count() const;
+        uint64_t min() const;
+        uint64_t max() const;
+        uint64_t sum() const;
+
+        /// Highest value of the bucket holding the given quantile, 0 if nothing was recorded.
+        uint64_t valueAtQuantile(const double quantile) const;
+
+        uint64_t bucketCount(const size_t bucket) const;
+
+        static size_t bucketOf(const uint64_t value);
+        static uint64_t bucketUpperBound(const size_t bucket);
+
+    private:
+        std::array<std::atomic<uint64_t>, the_bucket_count> my_buckets{};
+        std::atomic<uint64_t> my_count{0};
+        std::atomic<uint64_t> my_sum{0};
+        std::atomic<uint64_t> my_min{UINT64_MAX};
+        std::atomic<uint64_t> my_max{0};
+    };
+
+    /**
+     * @param path file receiving the dumps, replaced by each of them
+     * @param interval time between two periodic dumps, none if zero
+     */
+    MessageTimings(const std::string& path, const std::chrono::seconds interval);
+
+    /// Stop dumping, and write a last dump.
+    ~MessageTimings();
+
+    /// Record the duration of one stage for a message type, callable from any thread.
+    void record(const NetworkMessage::Type type, const Stage stage, const Clock::duration duration);
+
+    const Histogram& histogram(const NetworkMessage::Type type, const Stage stage) const;
+
+    /// Write every histogram holding values as a JSON document.
+    void dump(std::ostream& stream) const;
+
+    /// Dump to the file, through a temporary file so that readers never see a partial dump.
+    bool dumpToFile() const;
+
+#ifndef _WIN32
+    /** Dump on SIGUSR1 and every interval from a thread of our own.
+     *
+     * SIGUSR1 is blocked in the calling thread, so this must be called before
+     * any other thread is started for them to inherit the mask.
+     */
+    void startDumping();
+#endif
+
+private:
+    static const char* stageName(const Stage stage);
+
+    std::string my_path;
+    std::chrono::seconds my_interval;
+
+    std::unique_ptr<Histogram[]> my_histograms;
+
+#ifndef _WIN32
+    std::atomic<bool> my_stopping{false};
+    std::thread my_dumper;
+#endif
+};
+}
+} // namespace certi/rtig
+
+#endif // CERTI_RTIG_MESSAGE_TIMINGS_HH
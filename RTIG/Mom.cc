@@ -228,6 +228,25 @@ namespace rtig {
 
 static PrettyDebug D("MOM", __FILE__);
 
+// In the order of Mom::TimeAttribute and Mom::CountAttribute
+static const std::string the_time_attribute_names[]{"HLAlogicalTime", "HLAlookahead", "HLAGALT", "HLALITS"};
+
+static const std::string the_count_attribute_names[]{"HLAROlength",
+                                                     "HLATSOlength",
+                                                     "HLAreflectionsReceived",
+                                                     "HLAupdatesSent",
+                                                     "HLAinteractionsReceived",
+                                                     "HLAinteractionsSent",
+                                                     "HLAobjectInstancesThatCanBeDeleted",
+                                                     "HLAobjectInstancesUpdated",
+                                                     "HLAobjectInstancesReflected",
+                                                     "HLAobjectInstancesDeleted",
+                                                     "HLAobjectInstancesRemoved",
+                                                     "HLAobjectInstancesRegistered",
+                                                     "HLAobjectInstancesDiscovered",
+                                                     "HLAtimeGrantedTime",
+                                                     "HLAtimeAdvancingTime"};
+
 bool Mom::isAvailableInRootObjectAndCompliant(const RootObject& root)
 {
     // Pre check with sizes
@@ -286,8 +305,14 @@ bool Mom::isAvailableInRootObjectAndCompliant(const RootObject& root)
     return true;
 }
 
+constexpr std::size_t Mom::the_time_attributes;
+constexpr std::size_t Mom::the_count_attributes;
+
 Mom::Mom(const FederateHandle handle, Federation& federation, RootObject& root)
-    : my_handle(handle), my_federation(federation), my_root(root)
+    : my_handle(handle)
+    , my_federation(federation)
+    , my_root(root)
+    , my_next_report(std::chrono::steady_clock::time_point::max().time_since_epoch().count())
 {
 }
 
@@ -320,6 +345,14 @@ void Mom::publishObjects()
         my_federation.publishObject(my_handle, object_handle, attributes, true);
     }
 
+    // Periodic attributes are counted by index
+    for (auto index = 0u; index < the_time_attributes; ++index) {
+        my_time_attributes[index] = my_attribute_cache["HLAmanager.HLAfederate." + the_time_attribute_names[index]];
+    }
+    for (auto index = 0u; index < the_count_attributes; ++index) {
+        my_count_attributes[index] = my_attribute_cache["HLAmanager.HLAfederate." + the_count_attribute_names[index]];
+    }
+
     Debug(D, pdGendoc) << "exit  Mom::publishObjects" << endl;
 }
 
@@ -23,8 +23,12 @@
 #ifndef _CERTI_RTIG_MOM_HH
 #define _CERTI_RTIG_MOM_HH
 
+#include <array>
+#include <atomic>
+#include <bitset>
 #include <chrono>
 #include <unordered_map>
+#include <unordered_set>
 
 #include <libCERTI/MessageEvent.hh>
 #include <libCERTI/RootObject.hh>
@@ -94,34 +98,34 @@ public:
     Responses updateTimeManagerState(const FederateHandle federate_handle, const TimeState value);
     Responses updateConveyRegionDesignatorSets(const FederateHandle federate_handle, const bool value);
     Responses updateConveyProducingFederate(const FederateHandle federate_handle, const bool value);
-    // Periodic Attributes
-    Responses updateLogicalTime(const FederateHandle federate_handle, const FederationTime& value);
-    Responses updateLookahead(const FederateHandle federate_handle, const FederationTime& value);
-    Responses
-    updateGALT(const FederateHandle federate_handle,
-               const FederationTime& value); // TODO gathered from RTIA but check if we cannot get them in RTIG
-    Responses updateLITS(const FederateHandle federate_handle, const FederationTime& value); // idem
-    Responses updateRoLenght(const FederateHandle federate_handle,
-                             const int delta = 1); // TODO check if available from queues or not compliant
-    Responses updateTsoLenght(const FederateHandle federate_handle, const int delta = 1); // idem
-    Responses updateReflectionsReceived(const FederateHandle federate_handle, const int delta = 1);
-    Responses updateUpdatesSent(const FederateHandle federate_handle, const int delta = 1);
-    Responses updateInteractionsReceived(const FederateHandle federate_handle, const int delta = 1);
-    Responses updateInteractionsSent(const FederateHandle federate_handle, const int delta = 1);
-    Responses updateObjectInstancesThatCanBeDeleted(const FederateHandle federate_handle, const int delta = 1);
-    Responses updateObjectInstancesUpdated(const FederateHandle federate_handle);
-    Responses updateObjectInstancesReflected(const FederateHandle federate_handle);
-    Responses updateObjectInstancesDeleted(const FederateHandle federate_handle, const int delta = 1);
-    Responses updateObjectInstancesRemoved(const FederateHandle federate_handle, const int delta = 1);
-    Responses updateObjectInstancesRegistered(const FederateHandle federate_handle, const int delta = 1);
-    Responses updateObjectInstancesDiscovered(const FederateHandle federate_handle, const int delta = 1);
-    Responses
-    updateTimeGrantedTime(const FederateHandle federate_handle,
-                          const int value); // TODO this will be resource intensive, check if we want to support it
-    Responses updateTimeAdvancingTime(const FederateHandle federate_handle, const int value); // idem
+    // Periodic Attributes, only sent at the report period of the federate, see provideReports
+    void updateLogicalTime(const FederateHandle federate_handle, const FederationTime& value);
+    void updateLookahead(const FederateHandle federate_handle, const FederationTime& value);
+    void updateGALT(const FederateHandle federate_handle,
+                    const FederationTime& value); // TODO gathered from RTIA but check if we cannot get them in RTIG
+    void updateLITS(const FederateHandle federate_handle, const FederationTime& value); // idem
+    void updateRoLenght(const FederateHandle federate_handle,
+                        const int delta = 1); // TODO check if available from queues or not compliant
+    void updateTsoLenght(const FederateHandle federate_handle, const int delta = 1); // idem
+    void updateObjectInstancesThatCanBeDeleted(const FederateHandle federate_handle, const int delta = 1);
+    void updateObjectInstancesDeleted(const FederateHandle federate_handle, const int delta = 1);
+    void updateObjectInstancesRemoved(const FederateHandle federate_handle, const int delta = 1);
+    void updateObjectInstancesRegistered(const FederateHandle federate_handle, const int delta = 1);
+    void updateObjectInstancesDiscovered(const FederateHandle federate_handle, const int delta = 1);
+    void updateTimeGrantedTime(const FederateHandle federate_handle,
+                               const int value); // TODO this will be resource intensive, check if we want to support it
+    void updateTimeAdvancingTime(const FederateHandle federate_handle, const int value); // idem
+
+    /** Provide the periodic attributes changed since their last report, for every federate whose report
+     * period elapsed at now.
+     */
+    Responses provideReports(const std::chrono::steady_clock::time_point now);
 
-    Responses
-    updateCountAttribute(const FederateHandle& federate_handle, const std::string& attribute_name, const int delta);
+    /** Time at which provideReports has something to send, time_point::max() if none.
+     *
+     * It may be read by another thread than the one counting, which calls provideReports once due.
+     */
+    std::chrono::steady_clock::time_point getNextReportTime() const;
 
     Responses provideAttributeValueUpdate(const ObjectHandle& object, const std::vector<AttributeHandle>& attributes);
 
@@ -227,27 +231,72 @@ public:
     Responses processFederationRequestFOMmoduleData(const int FOMmoduleIndicator);
     Responses processFederationRequestMIMData();
 
-    void registerObjectInstanceUpdated(const FederateHandle federate,
-                                       const ObjectClassHandle object,
-                                       const ObjectHandle instance);
-    void registerObjectInstanceReflected(const FederateHandle federate,
-                                         const ObjectClassHandle object,
-                                         const ObjectHandle instance);
-    void registerUpdate(const FederateHandle federate, const ObjectClassHandle object);
-    void registerReflection(const FederateHandle federate, const ObjectClassHandle object);
+    // Counters of the federate services, called for each of them
+    void registerUpdate(const FederateHandle federate, const ObjectClassHandle object, const ObjectHandle instance);
+    void registerReflection(const FederateHandle federate, const ObjectClassHandle object, const ObjectHandle instance);
     void registerInteractionSent(const FederateHandle federate, const InteractionClassHandle interaction);
     void registerInteractionReceived(const FederateHandle federate, const InteractionClassHandle interaction);
 
 private:
-    struct FederateUpdateSettings {
-        std::chrono::seconds updateRate{0};
-        std::chrono::time_point<std::chrono::system_clock> lastUpdate{};
+    /// Periodic attributes of HLAmanager.HLAfederate holding a time.
+    enum class TimeAttribute { LogicalTime, Lookahead, GALT, LITS, Size };
+
+    /// Periodic attributes of HLAmanager.HLAfederate holding a count.
+    enum class CountAttribute {
+        ROlength,
+        TSOlength,
+        ReflectionsReceived,
+        UpdatesSent,
+        InteractionsReceived,
+        InteractionsSent,
+        ObjectInstancesThatCanBeDeleted,
+        ObjectInstancesUpdated,
+        ObjectInstancesReflected,
+        ObjectInstancesDeleted,
+        ObjectInstancesRemoved,
+        ObjectInstancesRegistered,
+        ObjectInstancesDiscovered,
+        TimeGrantedTime,
+        TimeAdvancingTime,
+        Size
     };
 
-    // Support
-    Responses preparePeriodicAttributeValueUpdate(const ObjectHandle& object,
-                                                  const std::vector<AttributeHandle>& attributes);
-    Responses providePeriodicAttributeValueUpdatesIfApplicable();
+    static constexpr std::size_t the_time_attributes{static_cast<std::size_t>(TimeAttribute::Size)};
+    static constexpr std::size_t the_count_attributes{static_cast<std::size_t>(CountAttribute::Size)};
+
+    /** Periodic attributes and per class counts of a federate.
+     *
+     * They are only encoded when reported, changed attributes are marked until then.
+     */
+    struct FederateCounters {
+        std::array<FederationTime, the_time_attributes> times{};
+        std::array<int, the_count_attributes> counts{};
+        std::bitset<the_time_attributes> changed_times;
+        std::bitset<the_count_attributes> changed_counts;
+
+        // Indexed by class handle
+        std::vector<int> updates_sent;
+        std::vector<int> reflections_received;
+        std::vector<int> interactions_sent;
+        std::vector<int> interactions_received;
+        std::vector<std::unordered_set<ObjectHandle>> object_instances_updated;
+        std::vector<std::unordered_set<ObjectHandle>> object_instances_reflected;
+
+        std::chrono::seconds report_period{0};
+        std::chrono::steady_clock::time_point next_report{};
+    };
+
+    FederateCounters& countersOf(const FederateHandle federate);
+
+    void setTime(FederateCounters& counters, const TimeAttribute attribute, const FederationTime& value);
+    void addCount(FederateCounters& counters, const CountAttribute attribute, const int delta);
+    void setCount(FederateCounters& counters, const CountAttribute attribute, const int value);
+
+    /// Schedule the next report of a federate whose attributes just changed.
+    void scheduleReport(const FederateCounters& counters);
+
+    /// Encode the periodic attributes of a federate in the attribute values cache, the changed ones only if asked.
+    std::vector<AttributeHandle> encodePeriodicAttributes(const FederateHandle federate, const bool changed_only);
 
     void display() const;
 
@@ -272,10 +321,15 @@ private:
     std::unordered_map<std::string, ParameterHandle> my_parameter_cache;
 
     std::map<ObjectHandle, std::map<AttributeHandle, AttributeValue_t>> my_attribute_values_cache;
-    std::map<FederateHandle, std::map<AttributeHandle, int>> my_count_attributes_cache;
 
-    std::map<FederateHandle, FederateUpdateSettings> my_federates_update_settings;
-    std::map<FederateHandle, std::set<AttributeHandle>> my_attributes_to_update_periodically;
+    std::array<AttributeHandle, the_time_attributes> my_time_attributes{};
+    std::array<AttributeHandle, the_count_attributes> my_count_attributes{};
+
+    /// Indexed by federate handle
+    std::vector<FederateCounters> my_counters;
+
+    /// Earliest next report of the federates with changed attributes, as steady_clock ticks.
+    std::atomic<std::chrono::steady_clock::rep> my_next_report;
 
     AttributeValue_t encodeString(const std::string& str);
     AttributeValue_t encodeStringList(const std::vector<std::string>& strs);
@@ -288,6 +342,7 @@ private:
     AttributeValue_t encodeFederateState(const Federate& federate);
     AttributeValue_t encodeVectorHandle(const std::vector<Handle>& data);
     AttributeValue_t encodeHandleBasedCounts(std::map<Handle, int> data);
+    static std::map<Handle, int> handleBasedCounts(const std::vector<int>& counts);
     AttributeValue_t encodeVectorString(const std::vector<std::string>& data);
 
     std::string decodeString(const ParameterValue_t& data);
@@ -301,14 +356,6 @@ private:
     AttributeValue_t encodeMB();
 
     MessageBuffer mb;
-
-    std::map<FederateHandle, std::map<ObjectClassHandle, std::unordered_set<ObjectHandle>>> my_object_instances_updated;
-    std::map<FederateHandle, std::map<ObjectClassHandle, std::unordered_set<ObjectHandle>>>
-        my_object_instances_reflected;
-    std::map<FederateHandle, std::map<ObjectClassHandle, int>> my_updates_sent;
-    std::map<FederateHandle, std::map<ObjectClassHandle, int>> my_reflections_received;
-    std::map<FederateHandle, std::map<InteractionClassHandle, int>> my_interactions_sent;
-    std::map<FederateHandle, std::map<InteractionClassHandle, int>> my_interactions_received;
 };
 }
 } // namespace certi/rtig
@@ -434,13 +434,18 @@ Responses Mom::processFederateSetTiming(const FederateHandle& federate_handle, c
     
     Debug(D, pdGendoc) << "enter Mom::processFederateSetTiming " << federate_handle << ", " << reportPeriod << endl;
 
-    my_federates_update_settings[federate_handle].updateRate = std::chrono::seconds(reportPeriod);
+    auto& counters = countersOf(federate_handle);
+    counters.report_period = std::chrono::seconds(reportPeriod);
+    counters.next_report = std::chrono::steady_clock::now() + counters.report_period;
+    if (counters.changed_times.any() || counters.changed_counts.any()) {
+        scheduleReport(counters);
+    }
     
     auto mom_msg = make_unique<NM_Mom_Status>();
     mom_msg->setFederation(my_federation.getHandle().get());
     mom_msg->setFederate(federate_handle);
     mom_msg->setMomState(true);
-    mom_msg->setUpdatePeriod(my_federates_update_settings[federate_handle].updateRate.count());
+    mom_msg->setUpdatePeriod(counters.report_period.count());
     
     ret.emplace_back(my_federation.my_server->getSocketLink(federate_handle), std::move(mom_msg));
     
@@ -789,9 +794,10 @@ Responses Mom::processFederateRequestObjectInstancesUpdated(const FederateHandle
 
     std::map<ObjectClassHandle, int> objectInstancesCounts;
 
-    for (const auto& pair : my_object_instances_updated[federate_handle]) {
-        if (!pair.second.empty()) {
-            objectInstancesCounts[pair.first] = pair.second.size();
+    const auto& instances = countersOf(federate_handle).object_instances_updated;
+    for (auto object_class = 0u; object_class < instances.size(); ++object_class) {
+        if (!instances[object_class].empty()) {
+            objectInstancesCounts[object_class] = instances[object_class].size();
         }
     }
 
@@ -825,9 +831,10 @@ Responses Mom::processFederateRequestObjectInstancesReflected(const FederateHand
 
     std::map<ObjectClassHandle, int> objectInstancesCounts;
 
-    for (const auto& pair : my_object_instances_reflected[federate_handle]) {
-        if (!pair.second.empty()) {
-            objectInstancesCounts[pair.first] = pair.second.size();
+    const auto& instances = countersOf(federate_handle).object_instances_reflected;
+    for (auto object_class = 0u; object_class < instances.size(); ++object_class) {
+        if (!instances[object_class].empty()) {
+            objectInstancesCounts[object_class] = instances[object_class].size();
         }
     }
 
@@ -865,7 +872,7 @@ Responses Mom::processFederateRequestUpdatesSent(const FederateHandle& federate_
 
     std::vector<AttributeValue_t> values{encodeUInt32(federate_handle),
                                          encodeString("HLAreliable"),
-                                         encodeHandleBasedCounts(my_updates_sent[federate_handle])};
+                                         encodeHandleBasedCounts(handleBasedCounts(countersOf(federate_handle).updates_sent))};
 
     Debug(D, pdGendoc) << "exit  Mom::processFederateRequestUpdatesSent" << endl;
 
@@ -910,7 +917,7 @@ Responses Mom::processFederateRequestInteractionsSent(const FederateHandle& fede
 
     std::vector<AttributeValue_t> values{encodeUInt32(federate_handle),
                                          encodeString("HLAreliable"),
-                                         encodeHandleBasedCounts(my_interactions_sent[federate_handle])};
+                                         encodeHandleBasedCounts(handleBasedCounts(countersOf(federate_handle).interactions_sent))};
 
     Debug(D, pdGendoc) << "exit  Mom::processFederateRequestInteractionsSent" << endl;
 
@@ -955,7 +962,7 @@ Responses Mom::processFederateRequestReflectionsReceived(const FederateHandle& f
 
     std::vector<AttributeValue_t> values{encodeUInt32(federate_handle),
                                          encodeString("HLAreliable"),
-                                         encodeHandleBasedCounts(my_reflections_received[federate_handle])};
+                                         encodeHandleBasedCounts(handleBasedCounts(countersOf(federate_handle).reflections_received))};
 
     Debug(D, pdGendoc) << "exit  Mom::processFederateRequestReflectionsReceived" << endl;
 
@@ -1000,7 +1007,7 @@ Responses Mom::processFederateRequestInteractionsReceived(const FederateHandle&
 
     std::vector<AttributeValue_t> values{encodeUInt32(federate_handle),
                                          encodeString("HLAreliable"),
-                                         encodeHandleBasedCounts(my_interactions_received[federate_handle])};
+                                         encodeHandleBasedCounts(handleBasedCounts(countersOf(federate_handle).interactions_received))};
 
     Debug(D, pdGendoc) << "exit  Mom::processFederateRequestInteractionsReceived" << endl;
 
@@ -1821,38 +1828,15 @@ Responses Mom::processFederationRequestMIMData()
     return my_federation.broadcastInteraction(my_handle, interaction_handle, parameters, values, 0, "");
 }
 
-void Mom::registerObjectInstanceUpdated(const FederateHandle federate,
-                                        const ObjectClassHandle object,
-                                        const ObjectHandle instance)
-{
-    my_object_instances_updated[federate][object].insert(instance);
-}
-
-void Mom::registerObjectInstanceReflected(const FederateHandle federate,
-                                          const ObjectClassHandle object,
-                                          const ObjectHandle instance)
-{
-    my_object_instances_reflected[federate][object].insert(instance);
-}
-
-void Mom::registerUpdate(const FederateHandle federate, const ObjectClassHandle object)
-{
-    ++my_updates_sent[federate][object];
-}
-
-void Mom::registerReflection(const FederateHandle federate, const ObjectClassHandle object)
+std::map<Handle, int> Mom::handleBasedCounts(const std::vector<int>& counts)
 {
-    ++my_reflections_received[federate][object];
-}
-
-void Mom::registerInteractionSent(const FederateHandle federate, const InteractionClassHandle interaction)
-{
-    ++my_interactions_sent[federate][interaction];
-}
-
-void Mom::registerInteractionReceived(const FederateHandle federate, const InteractionClassHandle interaction)
-{
-    ++my_interactions_received[federate][interaction];
+    std::map<Handle, int> result;
+    for (auto handle = 0u; handle < counts.size(); ++handle) {
+        if (counts[handle] != 0) {
+            result[handle] = counts[handle];
+        }
+    }
+    return result;
 }
 
 ParameterHandle Mom::getParameterHandle(const InteractionClassHandle interaction, const std::string& name)
@@ -22,6 +22,7 @@
 
 #include "Mom.hh"
 
+#include <algorithm>
 #include <chrono>
 #include <ctime>
 #include <iomanip>
@@ -219,79 +220,66 @@ Responses Mom::registerFederate(const Federate& federate, SocketTCP* tcp_link, c
     // Periodic
     attribute = my_attribute_cache["HLAmanager.HLAfederate.HLAROlength"];
     attributes.push_back(attribute);
-    my_count_attributes_cache[federate.getHandle()][attribute] = 0;
     my_attribute_values_cache[federate_object][attribute] = encodeUInt32(0);
 
     // Periodic
     attribute = my_attribute_cache["HLAmanager.HLAfederate.HLATSOlength"];
     attributes.push_back(attribute);
-    my_count_attributes_cache[federate.getHandle()][attribute] = 0;
     my_attribute_values_cache[federate_object][attribute] = encodeUInt32(0);
 
     // Periodic
     attribute = my_attribute_cache["HLAmanager.HLAfederate.HLAreflectionsReceived"];
     attributes.push_back(attribute);
-    my_count_attributes_cache[federate.getHandle()][attribute] = 0;
     my_attribute_values_cache[federate_object][attribute] = encodeUInt32(0);
 
     // Periodic
     attribute = my_attribute_cache["HLAmanager.HLAfederate.HLAupdatesSent"];
     attributes.push_back(attribute);
-    my_count_attributes_cache[federate.getHandle()][attribute] = 0;
     my_attribute_values_cache[federate_object][attribute] = encodeUInt32(0);
 
     // Periodic
     attribute = my_attribute_cache["HLAmanager.HLAfederate.HLAinteractionsReceived"];
     attributes.push_back(attribute);
-    my_count_attributes_cache[federate.getHandle()][attribute] = 0;
     my_attribute_values_cache[federate_object][attribute] = encodeUInt32(0);
 
     // Periodic
     attribute = my_attribute_cache["HLAmanager.HLAfederate.HLAinteractionsSent"];
     attributes.push_back(attribute);
-    my_count_attributes_cache[federate.getHandle()][attribute] = 0;
     my_attribute_values_cache[federate_object][attribute] = encodeUInt32(0);
 
     // Periodic
     attribute = my_attribute_cache["HLAmanager.HLAfederate.HLAobjectInstancesThatCanBeDeleted"];
     attributes.push_back(attribute);
-    my_count_attributes_cache[federate.getHandle()][attribute] = 0;
     my_attribute_values_cache[federate_object][attribute] = encodeUInt32(0);
 
     // Periodic
     attribute = my_attribute_cache["HLAmanager.HLAfederate.HLAobjectInstancesUpdated"];
     attributes.push_back(attribute);
-    my_count_attributes_cache[federate.getHandle()][attribute] = 0;
     my_attribute_values_cache[federate_object][attribute] = encodeUInt32(0);
 
     // Periodic
     attribute = my_attribute_cache["HLAmanager.HLAfederate.HLAobjectInstancesReflected"];
     attributes.push_back(attribute);
-    my_count_attributes_cache[federate.getHandle()][attribute] = 0;
     my_attribute_values_cache[federate_object][attribute] = encodeUInt32(0);
 
     // Periodic
     attribute = my_attribute_cache["HLAmanager.HLAfederate.HLAobjectInstancesDeleted"];
     attributes.push_back(attribute);
-    my_count_attributes_cache[federate.getHandle()][attribute] = 0;
     my_attribute_values_cache[federate_object][attribute] = encodeUInt32(0);
 
     // Periodic
     attribute = my_attribute_cache["HLAmanager.HLAfederate.HLAobjectInstancesRemoved"];
     attributes.push_back(attribute);
-    my_count_attributes_cache[federate.getHandle()][attribute] = 0;
     my_attribute_values_cache[federate_object][attribute] = encodeUInt32(0);
 
     // Periodic
     attribute = my_attribute_cache["HLAmanager.HLAfederate.HLAobjectInstancesRegistered"];
     attributes.push_back(attribute);
-    my_count_attributes_cache[federate.getHandle()][attribute] = 0;
     my_attribute_values_cache[federate_object][attribute] = encodeUInt32(0);
 
     // Periodic
     attribute = my_attribute_cache["HLAmanager.HLAfederate.HLAobjectInstancesDiscovered"];
     attributes.push_back(attribute);
-    my_count_attributes_cache[federate.getHandle()][attribute] = 0;
     my_attribute_values_cache[federate_object][attribute] = encodeUInt32(0);
 
     // Periodic
@@ -322,7 +310,7 @@ Responses Mom::registerFederate(const Federate& federate, SocketTCP* tcp_link, c
     mom_msg->setFederation(my_federation.getHandle().get());
     mom_msg->setFederate(federate.getHandle());
     mom_msg->setMomState(true);
-    mom_msg->setUpdatePeriod(my_federates_update_settings[federate.getHandle()].updateRate.count());
+    mom_msg->setUpdatePeriod(countersOf(federate.getHandle()).report_period.count());
     
     responses.emplace_back(tcp_link, std::move(mom_msg));
 
@@ -337,6 +325,9 @@ void Mom::deleteFederate(const FederateHandle federate_handle)
 
     my_federate_objects.erase(federate_handle);
     my_attribute_values_cache.erase(federate_handle);
+
+    // The handle may be given to another federate
+    countersOf(federate_handle) = FederateCounters();
 }
 
 Responses Mom::updateFederatesInFederation()
@@ -536,221 +527,284 @@ Responses Mom::updateConveyProducingFederate(const FederateHandle federate_handl
     return {};
 }
 
-Responses Mom::updateLogicalTime(const FederateHandle federate_handle, const FederationTime& value)
+void Mom::updateLogicalTime(const FederateHandle federate_handle, const FederationTime& value)
 {
-    auto attribute = my_attribute_cache["HLAmanager.HLAfederate.HLAlogicalTime"];
-
-    my_attribute_values_cache[my_federate_objects[federate_handle]][attribute] = encodeTime(value);
-
-    return preparePeriodicAttributeValueUpdate(federate_handle, {attribute});
+    setTime(countersOf(federate_handle), TimeAttribute::LogicalTime, value);
 }
 
-Responses Mom::updateLookahead(const FederateHandle federate_handle, const FederationTime& value)
+void Mom::updateLookahead(const FederateHandle federate_handle, const FederationTime& value)
 {
-    auto attribute = my_attribute_cache["HLAmanager.HLAfederate.HLAlookahead"];
-
-    my_attribute_values_cache[my_federate_objects[federate_handle]][attribute] = encodeTime(value);
-
-    return preparePeriodicAttributeValueUpdate(federate_handle, {attribute});
+    setTime(countersOf(federate_handle), TimeAttribute::Lookahead, value);
 }
 
-Responses Mom::updateGALT(const FederateHandle federate_handle, const FederationTime& value)
+void Mom::updateGALT(const FederateHandle federate_handle, const FederationTime& value)
 {
-    auto attribute = my_attribute_cache["HLAmanager.HLAfederate.HLAGALT"];
-
-    my_attribute_values_cache[my_federate_objects[federate_handle]][attribute] = encodeTime(value);
-
-    return preparePeriodicAttributeValueUpdate(federate_handle, {attribute});
+    setTime(countersOf(federate_handle), TimeAttribute::GALT, value);
 }
 
-Responses Mom::updateLITS(const FederateHandle federate_handle, const FederationTime& value)
+void Mom::updateLITS(const FederateHandle federate_handle, const FederationTime& value)
 {
-    auto attribute = my_attribute_cache["HLAmanager.HLAfederate.HLALITS"];
+    setTime(countersOf(federate_handle), TimeAttribute::LITS, value);
+}
 
-    my_attribute_values_cache[my_federate_objects[federate_handle]][attribute] = encodeTime(value);
+void Mom::updateRoLenght(const FederateHandle federate_handle, const int delta)
+{
+    addCount(countersOf(federate_handle), CountAttribute::ROlength, delta);
+}
 
-    return preparePeriodicAttributeValueUpdate(federate_handle, {attribute});
+void Mom::updateTsoLenght(const FederateHandle federate_handle, const int delta)
+{
+    addCount(countersOf(federate_handle), CountAttribute::TSOlength, delta);
 }
 
-Responses Mom::updateRoLenght(const FederateHandle federate_handle, const int delta)
+void Mom::updateObjectInstancesThatCanBeDeleted(const FederateHandle federate_handle, const int delta)
 {
-    return updateCountAttribute(federate_handle, "HLAmanager.HLAfederate.HLAROlength", delta);
+    addCount(countersOf(federate_handle), CountAttribute::ObjectInstancesThatCanBeDeleted, delta);
 }
 
-Responses Mom::updateTsoLenght(const FederateHandle federate_handle, const int delta)
+void Mom::updateObjectInstancesDeleted(const FederateHandle federate_handle, const int delta)
 {
-    return updateCountAttribute(federate_handle, "HLAmanager.HLAfederate.HLATSOlength", delta);
+    addCount(countersOf(federate_handle), CountAttribute::ObjectInstancesDeleted, delta);
 }
 
-Responses Mom::updateReflectionsReceived(const FederateHandle federate_handle, const int delta)
+void Mom::updateObjectInstancesRemoved(const FederateHandle federate_handle, const int delta)
 {
-    return updateCountAttribute(federate_handle, "HLAmanager.HLAfederate.HLAreflectionsReceived", delta);
+    addCount(countersOf(federate_handle), CountAttribute::ObjectInstancesRemoved, delta);
 }
 
-Responses Mom::updateUpdatesSent(const FederateHandle federate_handle, const int delta)
+void Mom::updateObjectInstancesRegistered(const FederateHandle federate_handle, const int delta)
 {
-    return updateCountAttribute(federate_handle, "HLAmanager.HLAfederate.HLAupdatesSent", delta);
+    addCount(countersOf(federate_handle), CountAttribute::ObjectInstancesRegistered, delta);
 }
 
-Responses Mom::updateInteractionsReceived(const FederateHandle federate_handle, const int delta)
+void Mom::updateObjectInstancesDiscovered(const FederateHandle federate_handle, const int delta)
 {
-    return updateCountAttribute(federate_handle, "HLAmanager.HLAfederate.HLAinteractionsReceived", delta);
+    addCount(countersOf(federate_handle), CountAttribute::ObjectInstancesDiscovered, delta);
 }
 
-Responses Mom::updateInteractionsSent(const FederateHandle federate_handle, const int delta)
+void Mom::updateTimeGrantedTime(const FederateHandle federate_handle, const int value)
 {
-    return updateCountAttribute(federate_handle, "HLAmanager.HLAfederate.HLAinteractionsSent", delta);
+    setCount(countersOf(federate_handle), CountAttribute::TimeGrantedTime, value);
 }
 
-Responses Mom::updateObjectInstancesThatCanBeDeleted(const FederateHandle federate_handle, const int delta)
+void Mom::updateTimeAdvancingTime(const FederateHandle federate_handle, const int value)
 {
-    return updateCountAttribute(federate_handle, "HLAmanager.HLAfederate.HLAobjectInstancesThatCanBeDeleted", delta);
+    setCount(countersOf(federate_handle), CountAttribute::TimeAdvancingTime, value);
 }
 
-Responses Mom::updateObjectInstancesUpdated(const FederateHandle federate_handle)
+void Mom::registerUpdate(const FederateHandle federate, const ObjectClassHandle object, const ObjectHandle instance)
 {
-    int count = 0;
+    auto& counters = countersOf(federate);
 
-    for (const auto& pair : my_object_instances_updated[federate_handle]) {
-        count += pair.second.size();
+    if (counters.updates_sent.size() <= object) {
+        counters.updates_sent.resize(object + 1);
+        counters.object_instances_updated.resize(object + 1);
     }
+    ++counters.updates_sent[object];
+    addCount(counters, CountAttribute::UpdatesSent, 1);
 
-    auto attribute = my_attribute_cache["HLAmanager.HLAfederate.HLAobjectInstancesUpdated"];
-
-    my_attribute_values_cache[my_federate_objects[federate_handle]][attribute] = encodeUInt32(count);
-
-    return preparePeriodicAttributeValueUpdate(federate_handle, {attribute});
+    if (counters.object_instances_updated[object].insert(instance).second) {
+        addCount(counters, CountAttribute::ObjectInstancesUpdated, 1);
+    }
 }
 
-Responses Mom::updateObjectInstancesReflected(const FederateHandle federate_handle)
+void Mom::registerReflection(const FederateHandle federate, const ObjectClassHandle object, const ObjectHandle instance)
 {
-    int count = 0;
+    auto& counters = countersOf(federate);
 
-    for (const auto& pair : my_object_instances_reflected[federate_handle]) {
-        count += pair.second.size();
+    if (counters.reflections_received.size() <= object) {
+        counters.reflections_received.resize(object + 1);
+        counters.object_instances_reflected.resize(object + 1);
     }
+    ++counters.reflections_received[object];
+    addCount(counters, CountAttribute::ReflectionsReceived, 1);
 
-    auto attribute = my_attribute_cache["HLAmanager.HLAfederate.HLAobjectInstancesReflected"];
-
-    my_attribute_values_cache[my_federate_objects[federate_handle]][attribute] = encodeUInt32(count);
-
-    return preparePeriodicAttributeValueUpdate(federate_handle, {attribute});
+    if (counters.object_instances_reflected[object].insert(instance).second) {
+        addCount(counters, CountAttribute::ObjectInstancesReflected, 1);
+    }
 }
 
-Responses Mom::updateObjectInstancesDeleted(const FederateHandle federate_handle, const int delta)
+void Mom::registerInteractionSent(const FederateHandle federate, const InteractionClassHandle interaction)
 {
-    return updateCountAttribute(federate_handle, "HLAmanager.HLAfederate.HLAobjectInstancesDeleted", delta);
-}
+    auto& counters = countersOf(federate);
 
-Responses Mom::updateObjectInstancesRemoved(const FederateHandle federate_handle, const int delta)
-{
-    return updateCountAttribute(federate_handle, "HLAmanager.HLAfederate.HLAobjectInstancesRemoved", delta);
+    if (counters.interactions_sent.size() <= interaction) {
+        counters.interactions_sent.resize(interaction + 1);
+    }
+    ++counters.interactions_sent[interaction];
+    addCount(counters, CountAttribute::InteractionsSent, 1);
 }
 
-Responses Mom::updateObjectInstancesRegistered(const FederateHandle federate_handle, const int delta)
+void Mom::registerInteractionReceived(const FederateHandle federate, const InteractionClassHandle interaction)
 {
-    return updateCountAttribute(federate_handle, "HLAmanager.HLAfederate.HLAobjectInstancesRegistered", delta);
-}
+    auto& counters = countersOf(federate);
 
-Responses Mom::updateObjectInstancesDiscovered(const FederateHandle federate_handle, const int delta)
-{
-    return updateCountAttribute(federate_handle, "HLAmanager.HLAfederate.HLAobjectInstancesDiscovered", delta);
+    if (counters.interactions_received.size() <= interaction) {
+        counters.interactions_received.resize(interaction + 1);
+    }
+    ++counters.interactions_received[interaction];
+    addCount(counters, CountAttribute::InteractionsReceived, 1);
 }
 
-Responses Mom::updateTimeGrantedTime(const FederateHandle federate_handle, const int value)
+Responses Mom::provideAttributeValueUpdate(const ObjectHandle& object, const std::vector<AttributeHandle>& attributes)
 {
-    auto attribute = my_attribute_cache["HLAmanager.HLAfederate.HLAtimeGrantedTime"];
+    Debug(D, pdGendoc) << "enter Mom::provideAttributeValueUpdate" << endl;
 
-    my_attribute_values_cache[my_federate_objects[federate_handle]][attribute] = encodeUInt32(value);
+    // Periodic attributes are only encoded when provided
+    auto is_periodic = [this](const AttributeHandle attribute) {
+        return std::find(begin(my_time_attributes), end(my_time_attributes), attribute) != end(my_time_attributes)
+            || std::find(begin(my_count_attributes), end(my_count_attributes), attribute) != end(my_count_attributes);
+    };
+    if (std::any_of(begin(attributes), end(attributes), is_periodic)) {
+        for (const auto& pair : my_federate_objects) {
+            if (pair.second == object) {
+                encodePeriodicAttributes(pair.first, false);
+                break;
+            }
+        }
+    }
 
-    return preparePeriodicAttributeValueUpdate(federate_handle, {attribute});
-}
+    std::vector<AttributeValue_t> values;
 
-Responses Mom::updateTimeAdvancingTime(const FederateHandle federate_handle, const int value)
-{
-    auto attribute = my_attribute_cache["HLAmanager.HLAfederate.HLAtimeAdvancingTime"];
+    for (const auto& attribute : attributes) {
+        values.push_back(my_attribute_values_cache[object][attribute]);
+    }
+
+    auto responses = my_federation.updateAttributeValues(my_handle, object, attributes, values, "");
 
-    my_attribute_values_cache[my_federate_objects[federate_handle]][attribute] = encodeUInt32(value);
+    Debug(D, pdGendoc) << "exit  Mom::provideAttributeValueUpdate" << endl;
 
-    return preparePeriodicAttributeValueUpdate(federate_handle, {attribute});
+    return responses;
 }
 
-Responses
-Mom::updateCountAttribute(const FederateHandle& federate_handle, const std::string& attribute_name, const int delta)
+Responses Mom::provideReports(const std::chrono::steady_clock::time_point now)
 {
-    auto attribute = my_attribute_cache[attribute_name];
+    Debug(D, pdGendoc) << "enter Mom::provideReports" << endl;
 
-    my_count_attributes_cache[federate_handle][attribute] += delta;
+    Responses responses;
 
-    my_attribute_values_cache[my_federate_objects[federate_handle]][attribute]
-        = encodeUInt32(my_count_attributes_cache[federate_handle][attribute]);
+    auto next_report = std::chrono::steady_clock::time_point::max();
 
-    return preparePeriodicAttributeValueUpdate(federate_handle, {attribute});
-}
+    for (auto federate = 0u; federate < my_counters.size(); ++federate) {
+        auto& counters = my_counters[federate];
+        if (counters.report_period == std::chrono::seconds(0)
+            || (counters.changed_times.none() && counters.changed_counts.none())) {
+            continue;
+        }
 
-Responses Mom::provideAttributeValueUpdate(const ObjectHandle& object, const std::vector<AttributeHandle>& attributes)
-{
-    Debug(D, pdGendoc) << "enter Mom::provideAttributeValueUpdate" << endl;
+        if (counters.next_report <= now) {
+            auto object = my_federate_objects.find(federate);
+            if (object != end(my_federate_objects)) {
+                auto attributes = encodePeriodicAttributes(federate, true);
 
-    std::vector<AttributeValue_t> values;
+                std::vector<AttributeValue_t> values;
+                for (const auto& attribute : attributes) {
+                    values.push_back(my_attribute_values_cache[object->second][attribute]);
+                }
 
-    for (const auto& attribute : attributes) {
-        values.push_back(my_attribute_values_cache[object][attribute]);
+                auto resp = my_federation.updateAttributeValues(my_handle, object->second, attributes, values, "");
+                responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
+            }
+
+            counters.changed_times.reset();
+            counters.changed_counts.reset();
+            counters.next_report = now + counters.report_period;
+        }
+        else {
+            next_report = std::min(next_report, counters.next_report);
+        }
     }
 
-    auto responses = my_federation.updateAttributeValues(my_handle, object, attributes, values, "");
+    my_next_report = next_report.time_since_epoch().count();
 
-    Debug(D, pdGendoc) << "exit  Mom::provideAttributeValueUpdate" << endl;
+    Debug(D, pdGendoc) << "exit  Mom::provideReports" << endl;
 
     return responses;
 }
 
-Responses Mom::preparePeriodicAttributeValueUpdate(const FederateHandle& federate,
-                                                   const std::vector<AttributeHandle>& attributes)
+std::chrono::steady_clock::time_point Mom::getNextReportTime() const
 {
-    Debug(D, pdGendoc) << "enter Mom::preparePeriodicAttributeValueUpdate" << endl;
+    return std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(my_next_report.load()));
+}
 
-    if (federate == my_handle) {
-        return Responses();
+Mom::FederateCounters& Mom::countersOf(const FederateHandle federate)
+{
+    if (my_counters.size() <= federate) {
+        my_counters.resize(federate + 1);
     }
+    return my_counters[federate];
+}
 
-    for (const auto& attribute : attributes) {
-        my_attributes_to_update_periodically[federate].insert(attribute);
+void Mom::setTime(FederateCounters& counters, const TimeAttribute attribute, const FederationTime& value)
+{
+    const auto index = static_cast<std::size_t>(attribute);
+
+    counters.times[index] = value;
+    if (!counters.changed_times[index]) {
+        if (counters.changed_times.none() && counters.changed_counts.none()) {
+            scheduleReport(counters);
+        }
+        counters.changed_times.set(index);
     }
+}
 
-    auto responses = providePeriodicAttributeValueUpdatesIfApplicable();
+void Mom::addCount(FederateCounters& counters, const CountAttribute attribute, const int delta)
+{
+    setCount(counters, attribute, counters.counts[static_cast<std::size_t>(attribute)] + delta);
+}
 
-    Debug(D, pdGendoc) << "exit  Mom::preparePeriodicAttributeValueUpdate" << endl;
+void Mom::setCount(FederateCounters& counters, const CountAttribute attribute, const int value)
+{
+    const auto index = static_cast<std::size_t>(attribute);
 
-    return responses;
+    counters.counts[index] = value;
+    if (!counters.changed_counts[index]) {
+        if (counters.changed_times.none() && counters.changed_counts.none()) {
+            scheduleReport(counters);
+        }
+        counters.changed_counts.set(index);
+    }
 }
 
-Responses Mom::providePeriodicAttributeValueUpdatesIfApplicable()
+void Mom::scheduleReport(const FederateCounters& counters)
 {
-    Debug(D, pdGendoc) << "enter Mom::providePeriodicAttributeValueUpdatesIfApplicable" << endl;
+    if (counters.report_period == std::chrono::seconds(0)) {
+        return;
+    }
 
-    Responses responses;
+    const auto next_report = counters.next_report.time_since_epoch().count();
+    if (next_report < my_next_report.load()) {
+        my_next_report = next_report;
+    }
+}
 
-    auto now = std::chrono::system_clock::now();
+std::vector<AttributeHandle> Mom::encodePeriodicAttributes(const FederateHandle federate, const bool changed_only)
+{
+    std::vector<AttributeHandle> attributes;
 
-    for (auto& kv : my_attributes_to_update_periodically) {
-        auto& settings = my_federates_update_settings[kv.first];
+    auto object = my_federate_objects.find(federate);
+    if (object == end(my_federate_objects)) {
+        return attributes;
+    }
 
-        if (settings.updateRate != std::chrono::seconds(0)) {
-            if (now - settings.lastUpdate >= settings.updateRate) {
-                auto resp
-                    = provideAttributeValueUpdate(my_federate_objects[kv.first], {begin(kv.second), end(kv.second)});
-                responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
+    auto& values = my_attribute_values_cache[object->second];
+    const auto& counters = countersOf(federate);
 
-                kv.second.clear();
-                settings.lastUpdate = now;
-            }
+    for (auto index = 0u; index < the_time_attributes; ++index) {
+        if (!changed_only || counters.changed_times[index]) {
+            attributes.push_back(my_time_attributes[index]);
+            values[my_time_attributes[index]] = encodeTime(counters.times[index]);
         }
     }
 
-    Debug(D, pdGendoc) << "exit  Mom::providePeriodicAttributeValueUpdatesIfApplicable" << endl;
+    for (auto index = 0u; index < the_count_attributes; ++index) {
+        if (!changed_only || counters.changed_counts[index]) {
+            attributes.push_back(my_count_attributes[index]);
+            values[my_count_attributes[index]] = encodeUInt32(counters.counts[index]);
+        }
+    }
 
-    return responses;
+    return attributes;
 }
 }
 }
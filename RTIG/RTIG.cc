@@ -24,10 +24,12 @@
 
 #include <algorithm>
 #include <cerrno>
+#include <chrono>
 #include <csignal>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <string>
 
@@ -38,16 +40,9 @@
 
 #ifdef _WIN32
 #include <signal.h>
-#endif
-
-//#define LOG_MESSAGE_PROCESSING_TIMINGS
-#ifdef LOG_MESSAGE_PROCESSING_TIMINGS
-
-#include <chrono>
-#include <numeric>
-
-std::map<certi::NetworkMessage::Type, std::vector<std::chrono::nanoseconds>> the_timings;
-
+#else
+#include <fcntl.h>
+#include <unistd.h>
 #endif
 
 namespace {
@@ -56,6 +51,16 @@ static constexpr auto tcpPortEnvironmentVariable = "CERTI_TCP_PORT";
 
 static constexpr auto defaultUdpPort = PORT_UDP_RTIG;
 static constexpr auto udpPortEnvironmentVariable = "CERTI_UDP_PORT";
+
+static constexpr auto workersEnvironmentVariable = "CERTI_RTIG_WORKERS";
+
+static constexpr size_t defaultOutputQueueCapacity{0};
+static constexpr auto outputQueueEnvironmentVariable = "CERTI_RTIG_OUTPUT_QUEUE";
+
+static constexpr auto slowConsumerEnvironmentVariable = "CERTI_RTIG_SLOW_CONSUMER";
+
+static constexpr auto timingsEnvironmentVariable = "CERTI_RTIG_TIMINGS";
+static constexpr auto timingsIntervalEnvironmentVariable = "CERTI_RTIG_TIMINGS_INTERVAL";
 }
 
 namespace certi {
@@ -79,10 +84,80 @@ RTIG::RTIG()
 {
     my_NM_msgBufSend.reset();
     my_NM_msgBufReceive.reset();
+
+    auto timings_path = getenv(timingsEnvironmentVariable);
+    if (timings_path) {
+        my_timings.reset(new MessageTimings(timings_path, inferTimingsInterval()));
+#ifndef _WIN32
+        // Before the workers are started, so that SIGUSR1 is only taken by the dumper
+        my_timings->startDumping();
+#endif
+    }
+
+#ifndef _WIN32
+    auto outputQueueCapacity = inferOutputQueueCapacity();
+    my_socketServer.setOutputQueue(outputQueueCapacity, inferSlowConsumerPolicy());
+
+    my_wakeUpPipe[0] = my_wakeUpPipe[1] = -1;
+#endif
+
+    auto workers = inferWorkerCount();
+    if (workers > 0) {
+#ifndef _WIN32
+        if (outputQueueCapacity > 0) {
+            if (pipe(my_wakeUpPipe) != 0) {
+                throw RTIinternalError("Cannot create the workers wake up pipe: " + std::string(strerror(errno)));
+            }
+            fcntl(my_wakeUpPipe[0], F_SETFL, O_NONBLOCK);
+            fcntl(my_wakeUpPipe[1], F_SETFL, O_NONBLOCK);
+        }
+#endif
+        my_workers.reset(new FederationWorkers(workers, [this](MessageEvent<NetworkMessage>&& msg, MessageBuffer& buffer) {
+            auto link = msg.sockets().front();
+            std::vector<Socket*> written;
+            try {
+                processMessage(std::move(msg), buffer, &written);
+            }
+            catch (NetworkError& e) {
+                // The connection is dropped by the RTIG thread on its next read.
+                Debug(D, pdExcept) << "Worker caught Network Error on socket " << link->returnSocket()
+                                   << ", reason: " << e.reason() << std::endl;
+            }
+            catch (Exception& e) {
+                // Only the answer of an exception may throw, the worker must go on anyway
+                Debug(D, pdExcept) << "Worker caught Exception " << e.name() << " on socket " << link->returnSocket()
+                                   << ", reason: " << e.reason() << std::endl;
+            }
+            catch (std::exception& e) {
+                Debug(D, pdExcept) << "Worker caught " << e.what() << " on socket " << link->returnSocket()
+                                   << std::endl;
+            }
+#ifndef _WIN32
+            if (my_wakeUpPipe[1] >= 0) {
+                // Only the links of this worker federation, the others may be written by their own worker.
+                // Broken connections and what the sockets did not take are left to the RTIG thread
+                std::vector<Socket*> broken;
+                if (my_socketServer.flushOutput(written, broken) || !broken.empty()) {
+                    wakeUp();
+                }
+            }
+#endif
+        }));
+    }
 }
 
 RTIG::~RTIG()
 {
+    my_workers.reset();
+    my_timings.reset();
+
+#ifndef _WIN32
+    if (my_wakeUpPipe[0] >= 0) {
+        close(my_wakeUpPipe[0]);
+        close(my_wakeUpPipe[1]);
+    }
+#endif
+
     my_tcpSocketServer.close();
     my_udpSocketServer.close();
 
@@ -108,10 +183,18 @@ int Epollfd;
 my_socketServer.createEpollFd();
 int fdtcp = my_tcpSocketServer.returnSocket();
 my_socketServer.addElementEpoll(fdtcp);
+my_socketServer.addElementEpoll(my_udpSocketServer.returnSocket());
 Epollfd = my_socketServer.getEpollDescriptor();
+if (my_wakeUpPipe[0] >= 0) {
+    my_socketServer.addElementEpoll(my_wakeUpPipe[0]);
+}
 #endif
 
     while (!terminate) {
+        provideTimedResponses();
+#ifndef _WIN32
+        flushOutput();
+#endif
 #if _WIN32
         result = 0;
 
@@ -119,6 +202,7 @@ Epollfd = my_socketServer.getEpollDescriptor();
             // Initialize fd_set structure with all opened sockets.
             FD_ZERO(&fd);
             FD_SET(my_tcpSocketServer.returnSocket(), &fd);
+            FD_SET(my_udpSocketServer.returnSocket(), &fd);
 
             int highest_fd = my_socketServer.addToFDSet(&fd);
             int server_socket = my_tcpSocketServer.returnSocket();
@@ -181,25 +265,47 @@ Epollfd = my_socketServer.getEpollDescriptor();
             Debug(D, pdCom) << "New client" << std::endl;
             openConnection();
         }
+
+        // Or a datagram ?
+        if (FD_ISSET(my_udpSocketServer.returnSocket(), &fd)) {
+            processIncomingDatagram();
+        }
 #else
 
 #ifdef CERTI_RTIG_USE_SELECT
         FD_ZERO(&fd);
         FD_SET(my_tcpSocketServer.returnSocket(), &fd);
+        FD_SET(my_udpSocketServer.returnSocket(), &fd);
 
         int fd_max = my_socketServer.addToFDSet(&fd);
         fd_max = std::max(my_tcpSocketServer.returnSocket(), fd_max);
+        fd_max = std::max(my_udpSocketServer.returnSocket(), fd_max);
+
+        if (my_wakeUpPipe[0] >= 0) {
+            FD_SET(my_wakeUpPipe[0], &fd);
+            fd_max = std::max(my_wakeUpPipe[0], fd_max);
+        }
+
+        // Connections with queued output wait for room in their socket
+        fd_set write_fd;
+        FD_ZERO(&write_fd);
+        fd_max = std::max(my_socketServer.addToWriteFDSet(&write_fd), fd_max);
 
-        // Wait for an incoming message.
-        result = select(fd_max + 1, &fd, nullptr, nullptr, nullptr);
+        // Wait for an incoming message, the next MOM report or the end of a save.
+        const auto timeout_ms = getTimedResponsesTimeout();
+        timeval timeout;
+        timeout.tv_sec = timeout_ms / 1000;
+        timeout.tv_usec = (timeout_ms % 1000) * 1000;
+        result = select(fd_max + 1, &fd, &write_fd, nullptr, timeout_ms < 0 ? nullptr : &timeout);
 
         if ((result == -1) && (errno == EINTR)) {
             break;
         }
-		link = my_socketServer.getActiveSocket(&fd);
 
-        // Is it a message from an already opened connection?
-        if (link) {
+        // Every active connection is served before their answers are flushed, so that
+        // messages bound to the same federate are written together.
+        while ((link = my_socketServer.getActiveSocket(&fd))) {
+            FD_CLR(link->returnSocket(), &fd);
             Debug(D, pdCom) << "Incoming message on socket " << link->returnSocket() << std::endl;
 
             try {
@@ -228,6 +334,11 @@ Epollfd = my_socketServer.getEpollDescriptor();
             Debug(D, pdCom) << "New client" << std::endl;
             openConnection();
         }
+
+        // Or a datagram ?
+        if (FD_ISSET(my_udpSocketServer.returnSocket(), &fd)) {
+            processIncomingDatagram();
+        }
 #endif
 #ifdef CERTI_RTIG_USE_POLL
         std::vector<struct pollfd> SocketVector;
@@ -236,16 +347,26 @@ Epollfd = my_socketServer.getEpollDescriptor();
         tcp_server.fd = my_tcpSocketServer.returnSocket();
         tcp_server.events = POLLIN;
         my_socketServer.addElementPollList(tcp_server);
+        struct pollfd udp_server;
+        udp_server.fd = my_udpSocketServer.returnSocket();
+        udp_server.events = POLLIN;
+        my_socketServer.addElementPollList(udp_server);
+        if (my_wakeUpPipe[0] >= 0) {
+            struct pollfd wake_up;
+            wake_up.fd = my_wakeUpPipe[0];
+            wake_up.events = POLLIN;
+            my_socketServer.addElementPollList(wake_up);
+        }
         SocketVector = my_socketServer.getSocketVector();
         // blocking call (SHOULD IT BE THIS WAY ??)
-        result = ::poll(&SocketVector[0], SocketVector.size(), -1);
+        result = ::poll(&SocketVector[0], SocketVector.size(), getTimedResponsesTimeout());
         if ((result == -1) && (errno == EINTR)) {
             break;
         }
         for (std::vector<struct pollfd>::iterator it = SocketVector.begin() ; it != SocketVector.end(); ++it)
 		{
 			short revents = it->revents;
-			if (revents == POLLIN)
+			if (revents & POLLIN)
 			{
 				link = my_socketServer.getSocketFromFileDescriptor(it->fd);
 				if (link) {
@@ -275,20 +396,24 @@ Epollfd = my_socketServer.getEpollDescriptor();
 					Debug(D, pdCom) << "New client" << std::endl;
 					openConnection();
 				}
+				if (my_udpSocketServer.returnSocket() == it->fd) {
+					processIncomingDatagram();
+				}
 			}
 		}
         my_socketServer.resetSocketVector();
 #endif
 #ifdef CERTI_RTIG_USE_EPOLL
+		my_socketServer.updateEpollOutput();
 		struct epoll_event pevents[ 200 ];
-		result = epoll_wait( Epollfd, pevents, 200, -1 );
+		result = epoll_wait( Epollfd, pevents, 200, getTimedResponsesTimeout() );
 		if ((result == -1) && (errno == EINTR)) 
 		{
 				break;
 		}
 		for ( int i = 0; i < result; i++ )
 		{
-			if (pevents[i].events == EPOLLIN)
+			if (pevents[i].events & EPOLLIN)
 			{
 				link = my_socketServer.getSocketFromFileDescriptor(pevents[i].data.fd);
 				 if (link) {
@@ -318,6 +443,9 @@ Epollfd = my_socketServer.getEpollDescriptor();
 						Debug(D, pdCom) << "New client" << std::endl;
 						openConnection();
 					}
+					if (my_udpSocketServer.returnSocket() == pevents[i].data.fd) {
+						processIncomingDatagram();
+					}
 			}		
 		}
 
@@ -329,42 +457,6 @@ Epollfd = my_socketServer.getEpollDescriptor();
 
 void RTIG::signalHandler(int sig)
 {
-#ifdef LOG_MESSAGE_PROCESSING_TIMINGS
-    std::cerr << "//////////////////////" << std::endl;
-    std::cerr << "/////  TIMINGS  //////" << std::endl;
-    std::cerr << "//////////////////////" << std::endl;
-
-    for (auto& kv : the_timings) {
-        auto message = NM_Factory::create(static_cast<NetworkMessage::Type>(kv.first));
-        std::cerr << static_cast<std::underlying_type<NetworkMessage::Type>::type>(kv.first) << " - "
-                  << message->getMessageName() << std::endl;
-        delete message;
-
-        auto& values = kv.second;
-        std::sort(begin(values), end(values));
-
-        std::cerr << "\tcount: " << values.size() << std::endl;
-        std::cerr << "\tmin: " << values.front().count() << " ns" << std::endl;
-        std::cerr << "\tmax: " << values.back().count() << " ns" << std::endl;
-        std::cerr << "\taverage: "
-                  << std::accumulate(begin(values), end(values), std::chrono::nanoseconds{}).count() / values.size()
-                  << " ns" << std::endl;
-        std::cerr << "\tmedian: " << values.at(values.size() / 2).count() << " ns" << std::endl;
-
-#if 0
-        std::cerr << "\t\t";
-        for (auto& time : values) {
-            std::cerr << time.count() << " ";
-        }
-        std::cerr << std::endl;
-#endif
-    }
-
-    std::cerr << "//////////////////////" << std::endl;
-    std::cerr << "/////  TIMINGS  //////" << std::endl;
-    std::cerr << "//////////////////////" << std::endl;
-#endif
-
     Debug(D, pdError) << "Received Signal: " << sig << std::endl;
 
     if (sig == SIGINT) {
@@ -406,19 +498,86 @@ Socket* RTIG::processIncomingMessage(Socket* link)
 {
     Debug(G, pdGendoc) << "enter RTIG::processIncomingMessage" << std::endl;
 
-#ifdef LOG_MESSAGE_PROCESSING_TIMINGS
-    auto start = std::chrono::high_resolution_clock::now();
-#endif
-
     if (!link) {
         Debug(D, pdError) << "No socket in processIncomingMessage" << std::endl;
         return nullptr;
     }
 
-    auto msg = MessageEvent<NetworkMessage>(link, std::unique_ptr<NetworkMessage>(NM_Factory::receive(link)));
+    auto start = my_timings ? MessageTimings::Clock::now() : MessageTimings::Clock::time_point{};
+
+    auto msg = MessageEvent<NetworkMessage>(link, std::unique_ptr<NetworkMessage>(NM_Factory::receive(link, my_NM_msgBufReceive)));
+
+    if (my_timings) {
+        my_timings->record(msg.message()->getMessageType(),
+                           MessageTimings::Stage::Receive,
+                           MessageTimings::Clock::now() - start);
+    }
+
+    if (my_workers) {
+        if (isFederationLocal(*msg.message())) {
+            my_workers->dispatch(std::move(msg));
+            Debug(G, pdGendoc) << "exit  RTIG::processIncomingMessage" << std::endl;
+            return link;
+        }
+        my_workers->drain();
+    }
+
+    return processMessage(std::move(msg), my_NM_msgBufSend);
+}
+
+void RTIG::processIncomingDatagram()
+{
+    std::unique_ptr<NetworkMessage> message(NetworkMessage::receiveDatagram(&my_udpSocketServer, my_NM_msgBufReceive));
+    if (!message) {
+        return;
+    }
+
+    const auto type = message->getMessageType();
+    if ((type != NetworkMessage::Type::UPDATE_ATTRIBUTE_VALUES && type != NetworkMessage::Type::SEND_INTERACTION)
+        || message->isDated()) {
+        Debug(D, pdExcept) << "Dropped datagram holding <" << message->getMessageName() << ">" << std::endl;
+        return;
+    }
+
+    auto link = my_socketServer.getLinkOfDatagram(FederationHandle(message->getFederation()),
+                                                  message->getFederate(),
+                                                  my_udpSocketServer.getSourceAddr(),
+                                                  my_udpSocketServer.getSourcePort());
+    if (!link) {
+        Debug(D, pdExcept) << "Dropped datagram of federate " << message->getFederate() << " from unknown peer "
+                           << Socket::addr2string(my_udpSocketServer.getSourceAddr()) << ":"
+                           << ntohs(my_udpSocketServer.getSourcePort()) << std::endl;
+        return;
+    }
+
+    Debug(D, pdCom) << "Incoming datagram of federate " << message->getFederate() << std::endl;
+    auto msg = MessageEvent<NetworkMessage>(link, std::move(message), BEST_EFFORT);
+
+    try {
+        if (my_workers) {
+            my_workers->dispatch(std::move(msg));
+        }
+        else {
+            processMessage(std::move(msg), my_NM_msgBufSend);
+        }
+    }
+    catch (NetworkError& e) {
+        // A broken link is found and closed by its next read
+        Debug(D, pdExcept) << "Catching Network Error while forwarding a datagram, reason: " << e.reason()
+                           << std::endl;
+    }
+}
+
+Socket* RTIG::processMessage(MessageEvent<NetworkMessage>&& msg, MessageBuffer& buffer, std::vector<Socket*>* written)
+{
+    auto link = msg.sockets().front();
 
     auto federate = msg.message()->getFederate();
     auto messageType = msg.message()->getMessageType();
+    // What a datagram causes is forwarded as datagrams
+    const bool bestEffort = msg.transport() == BEST_EFFORT;
+
+    auto start = my_timings ? MessageTimings::Clock::now() : MessageTimings::Clock::time_point{};
 
     my_auditServer.startLine(
         msg.message()->getFederation(),
@@ -441,6 +600,11 @@ Socket* RTIG::processIncomingMessage(Socket* link)
         else {
             auto responses = my_processor.processEvent(std::move(msg));
 
+            auto processed = my_timings ? MessageTimings::Clock::now() : MessageTimings::Clock::time_point{};
+            if (my_timings) {
+                my_timings->record(messageType, MessageTimings::Stage::Process, processed - start);
+            }
+
             Debug(D, pdDebug) << responses.size() << " responses" << std::endl;
             for (auto& response : responses) {
                 Debug(D, pdDebug) << "Send back " << response.message()->getMessageName() << " to " << response.sockets().size() << " federates" << std::endl;
@@ -452,18 +616,31 @@ Socket* RTIG::processIncomingMessage(Socket* link)
                         Debug(D, pdDebug) << "to nullptr" << std::endl;
                     }
                 }
-                response.message()->send(response.sockets(), my_NM_msgBufSend); // send answer to RTIA
+                if (written) {
+                    const auto recipients = response.sockets();
+                    written->insert(end(*written), begin(recipients), end(recipients));
+                }
+                // What comes of a best effort request is best effort too
+                response.message()->setBestEffort(bestEffort);
+                if (response.message()->isDroppable()) {
+                    auto sockets = response.sockets();
+                    for (auto& socket : sockets) {
+                        socket = my_socketServer.getBestEffortLink(socket);
+                    }
+                    response.message()->send(sockets, buffer);
+                }
+                else {
+                    response.message()->send(response.sockets(), buffer); // send answer to RTIA
+                }
+            }
+
+            if (my_timings) {
+                my_timings->record(messageType, MessageTimings::Stage::Send, MessageTimings::Clock::now() - processed);
             }
         }
 
         my_auditServer.endLine(AuditLine::Status(Exception::Type::NO_EXCEPTION), " - OK");
 
-#ifdef LOG_MESSAGE_PROCESSING_TIMINGS
-        auto end = std::chrono::high_resolution_clock::now();
-
-        the_timings[messageType].push_back(end - start);
-#endif
-
         Debug(G, pdGendoc) << "exit  RTIG::processIncomingMessage" << std::endl;
         return link;
     }
@@ -477,37 +654,87 @@ Socket* RTIG::processIncomingMessage(Socket* link)
 
     // Default Handler
     catch (Exception& e) {
-        Debug(D, pdExcept) << "Caught Exception: " << e.name() << " - " << e.reason() << std::endl;
-        Debug(G, pdGendoc) << "Caught Exception: " << e.name() << " - " << e.reason() << std::endl;
+        sendException(link, messageType, federate, e, start, buffer, written);
 
-        // Server Answer(only if an exception is raised)
-        auto response = std::unique_ptr<NetworkMessage>(NM_Factory::create(messageType));
-        response->setFederate(federate);
-        response->setException(e.type(), e.reason());
-
-        my_auditServer.setLevel(AuditLine::Level(10));
-        my_auditServer.endLine(AuditLine::Status(e.type()), e.reason() + " - Exception");
-
-        if (link) {
-            Debug(G, pdGendoc) << "            processIncomingMessage ===> send exception back to RTIA" << std::endl;
-            response->send(link, my_NM_msgBufSend);
-            Debug(D, pdExcept) << "RTIG caught exception " << static_cast<long>(e.type())
-                               << " and sent it back to federate " << federate << std::endl;
-        }
+        Debug(G, pdGendoc) << "exit  RTIG::processIncomingMessage" << std::endl;
+        return link;
+    }
 
-#ifdef LOG_MESSAGE_PROCESSING_TIMINGS
-        auto end = std::chrono::high_resolution_clock::now();
+    // Whatever the cause, the federate gets an answer and the RTIG goes on
+    catch (std::exception& e) {
+        sendException(link, messageType, federate, RTIinternalError(e.what()), start, buffer, written);
 
-        the_timings[messageType].push_back(end - start);
-#endif
+        Debug(G, pdGendoc) << "exit  RTIG::processIncomingMessage" << std::endl;
+        return link;
+    }
+    catch (...) {
+        Debug(D, pdError) << "Unknown exception while processing <" << NetworkMessage::to_string(messageType)
+                          << "> of federate " << federate << std::endl;
+        sendException(link, messageType, federate, RTIinternalError("Unknown exception"), start, buffer, written);
 
         Debug(G, pdGendoc) << "exit  RTIG::processIncomingMessage" << std::endl;
         return link;
     }
 }
 
+void RTIG::sendException(Socket* link,
+                         NetworkMessage::Type messageType,
+                         FederateHandle federate,
+                         const Exception& e,
+                         MessageTimings::Clock::time_point start,
+                         MessageBuffer& buffer,
+                         std::vector<Socket*>* written)
+{
+    Debug(D, pdExcept) << "Caught Exception: " << e.name() << " - " << e.reason() << std::endl;
+    Debug(G, pdGendoc) << "Caught Exception: " << e.name() << " - " << e.reason() << std::endl;
+
+    auto processed = my_timings ? MessageTimings::Clock::now() : MessageTimings::Clock::time_point{};
+    if (my_timings) {
+        my_timings->record(messageType, MessageTimings::Stage::Process, processed - start);
+    }
+
+    // Server Answer(only if an exception is raised)
+    auto response = std::unique_ptr<NetworkMessage>(NM_Factory::create(messageType));
+    response->setFederate(federate);
+    response->setException(e.type(), e.reason());
+
+    my_auditServer.setLevel(AuditLine::Level(10));
+    my_auditServer.endLine(AuditLine::Status(e.type()), e.reason() + " - Exception");
+
+    if (link) {
+        Debug(G, pdGendoc) << "            processIncomingMessage ===> send exception back to RTIA" << std::endl;
+        if (written) {
+            written->push_back(link);
+        }
+        response->send(link, buffer);
+        Debug(D, pdExcept) << "RTIG caught exception " << static_cast<long>(e.type())
+                           << " and sent it back to federate " << federate << std::endl;
+
+        if (my_timings) {
+            my_timings->record(messageType, MessageTimings::Stage::Send, MessageTimings::Clock::now() - processed);
+        }
+    }
+}
+
+bool RTIG::isFederationLocal(const NetworkMessage& msg)
+{
+    switch (msg.getMessageType()) {
+    case NetworkMessage::Type::CLOSE_CONNEXION:
+    case NetworkMessage::Type::CREATE_FEDERATION_EXECUTION:
+    case NetworkMessage::Type::JOIN_FEDERATION_EXECUTION:
+    case NetworkMessage::Type::DESTROY_FEDERATION_EXECUTION:
+        return false;
+    default:
+        return msg.getFederation() != 0;
+    }
+}
+
 void RTIG::openConnection()
 {
+    if (my_workers) {
+        my_workers->drain();
+    }
+
     try {
         my_socketServer.open();
         Debug(D, pdInit) << "Accepting new connection" << std::endl;
@@ -517,12 +744,94 @@ void RTIG::openConnection()
     }
 }
 
+#ifndef _WIN32
+void RTIG::flushOutput()
+{
+    if (my_wakeUpPipe[0] >= 0) {
+        char wake_ups[64];
+        while (read(my_wakeUpPipe[0], wake_ups, sizeof(wake_ups)) > 0) {
+        }
+    }
+
+    std::vector<Socket*> broken;
+    my_socketServer.flushOutput(broken);
+
+    // Killing a federate notifies the others, which may in turn be found broken
+    while (!broken.empty()) {
+        for (auto link : broken) {
+            std::cout << "RTIG dropping client connection " << link->returnSocket() << '.' << std::endl;
+            closeConnection(link, true);
+        }
+        broken.clear();
+        my_socketServer.flushOutput(broken);
+    }
+}
+
+void RTIG::wakeUp()
+{
+    const char wake_up = 0;
+    // A full pipe already holds enough wake ups
+    if (write(my_wakeUpPipe[1], &wake_up, 1) < 0) {
+        Debug(D, pdDebug) << "Wake up pipe is full" << std::endl;
+    }
+}
+#endif
+
+void RTIG::provideTimedResponses()
+{
+    const auto now = std::chrono::steady_clock::now();
+    if (my_federations.getNextMomReportTime() > now && my_federations.getNextSaveCheckTime() > now) {
+        return;
+    }
+
+    if (my_workers) {
+        my_workers->drain();
+    }
+
+    auto responses = my_federations.provideMomReports(now);
+    auto saves = my_federations.provideSaveResults(now);
+    responses.insert(end(responses), make_move_iterator(begin(saves)), make_move_iterator(end(saves)));
+
+    for (auto& response : responses) {
+        try {
+            response.message()->send(response.sockets(), my_NM_msgBufSend);
+        }
+        catch (NetworkError& e) {
+            // A broken link is found and closed by its next read
+            Debug(D, pdExcept) << "Catching Network Error while sending a timed response, reason: " << e.reason()
+                               << std::endl;
+        }
+    }
+}
+
+int RTIG::getTimedResponsesTimeout() const
+{
+    const auto next_report
+        = std::min(my_federations.getNextMomReportTime(), my_federations.getNextSaveCheckTime());
+    if (next_report == std::chrono::steady_clock::time_point::max()) {
+        return -1;
+    }
+
+    const auto remaining = next_report - std::chrono::steady_clock::now();
+    auto timeout = std::chrono::duration_cast<std::chrono::milliseconds>(remaining);
+    if (timeout < remaining) {
+        // Rounded up, not to wake up just before the report is due
+        timeout += std::chrono::milliseconds(1);
+    }
+    return static_cast<int>(std::min<std::chrono::milliseconds::rep>(
+        std::max<std::chrono::milliseconds::rep>(timeout.count(), 0), std::numeric_limits<int>::max()));
+}
+
 void RTIG::closeConnection(Socket* link, bool emergency)
 {
     FederationHandle federation(0);
     FederateHandle federate(0);
 
     Debug(G, pdGendoc) << "enter RTIG::closeConnection" << std::endl;
+    if (my_workers) {
+        my_workers->drain();
+    }
+
     try {
         my_socketServer.close(link->returnSocket(), federation, federate);
     }
@@ -562,6 +871,58 @@ int RTIG::inferUdpPort()
         return std::stoi(defaultUdpPort);
     }
 }
+
+std::chrono::seconds RTIG::inferTimingsInterval()
+{
+    auto interval_s = getenv(timingsIntervalEnvironmentVariable);
+    if (interval_s) {
+        return std::chrono::seconds(std::max(0, std::stoi(interval_s)));
+    }
+    else {
+        return std::chrono::seconds(0);
+    }
+}
+
+unsigned int RTIG::inferWorkerCount()
+{
+    auto workers_s = getenv(workersEnvironmentVariable);
+    if (workers_s) {
+        return std::max(0, std::stoi(workers_s));
+    }
+    else {
+        return 0;
+    }
+}
+
+#ifndef _WIN32
+size_t RTIG::inferOutputQueueCapacity()
+{
+    auto capacity_s = getenv(outputQueueEnvironmentVariable);
+    if (capacity_s) {
+        return std::max(0ll, std::stoll(capacity_s));
+    }
+    else {
+        return defaultOutputQueueCapacity;
+    }
+}
+
+SocketTCP::SlowConsumerPolicy RTIG::inferSlowConsumerPolicy()
+{
+    auto policy_s = getenv(slowConsumerEnvironmentVariable);
+    if (!policy_s || std::string(policy_s) == "block") {
+        return SocketTCP::SlowConsumerPolicy::Block;
+    }
+    else if (std::string(policy_s) == "drop") {
+        return SocketTCP::SlowConsumerPolicy::DropBestEffort;
+    }
+    else if (std::string(policy_s) == "disconnect") {
+        return SocketTCP::SlowConsumerPolicy::Disconnect;
+    }
+    std::cout << "Unknown " << slowConsumerEnvironmentVariable << " <" << policy_s
+              << ">, expected block, drop or disconnect. Using block." << std::endl;
+    return SocketTCP::SlowConsumerPolicy::Block;
+}
+#endif
 }
 } // namespace certi/rtig
 
@@ -25,6 +25,7 @@
 
 // #include <netinet/in.h>
 #include <string>
+#include <vector>
 
 #include <include/certi.hh>
 
@@ -39,8 +40,10 @@
 #include <libCERTI/SocketTCP.hh>
 #include <libCERTI/SocketUDP.hh>
 
+#include "FederationWorkers.hh"
 #include "FederationsList.hh"
 #include "MessageProcessor.hh"
+#include "MessageTimings.hh"
 
 namespace certi {
 
@@ -90,8 +93,64 @@ private:
          */
     Socket* processIncomingMessage(Socket*);
 
+    /** Read a datagram on the UDP server socket and process its message.
+         *
+         * Only receive order updates and interactions are accepted, from the
+         * address and port their federate joined with. They are processed as
+         * if read on the federate reliable link, but what they cause is
+         * forwarded as datagrams. Anything else is dropped.
+         */
+    void processIncomingDatagram();
+
+    /** Process a received message and send the responses using buffer.
+         *
+         * Called by processIncomingMessage, or by a federation worker for
+         * messages which only involve the federation they belong to.
+         * 
+         * Exceptions other than NetworkError are sent back to the federate.
+         * 
+         * @param written if not null, filled with the links the responses were written to
+         * @return the socket, because it may have been closed & deleted in the meantime
+         */
+    Socket* processMessage(MessageEvent<NetworkMessage>&& msg,
+                           MessageBuffer& buffer,
+                           std::vector<Socket*>* written = nullptr);
+
+    /// Send the exception raised by a message back to its federate.
+    void sendException(Socket* link,
+                       NetworkMessage::Type messageType,
+                       FederateHandle federate,
+                       const Exception& e,
+                       MessageTimings::Clock::time_point start,
+                       MessageBuffer& buffer,
+                       std::vector<Socket*>* written);
+
+    /** Messages which can be handed to the worker owning their federation.
+         *
+         * Create, join, destroy and close connection stay on the RTIG thread
+         * since they alter the federations list or the socket server.
+         */
+    static bool isFederationLocal(const NetworkMessage& msg);
+
     void openConnection();
 
+#ifndef _WIN32
+    /** Write the queued output of every connection, and close the ones found
+     * broken or given up as too slow by the slow consumer policy.
+     */
+    void flushOutput();
+
+    /// Called by a worker which left output queued, so that the RTIG thread waits for it to be writable.
+    void wakeUp();
+#endif
+
+    /** Send the MOM reports and the ends of saves which are due, after the workers processed what they were given.
+     */
+    void provideTimedResponses();
+
+    /// Milliseconds until the next MOM report or save check, -1 if none is scheduled.
+    int getTimedResponsesTimeout() const;
+
     /** closeConnection
          * 
          * If a connection is closed in emergency, KillFederate will be called on
@@ -102,6 +161,12 @@ private:
 private:
     static int inferTcpPort();
     static int inferUdpPort();
+    static unsigned int inferWorkerCount();
+    static std::chrono::seconds inferTimingsInterval();
+#ifndef _WIN32
+    static size_t inferOutputQueueCapacity();
+    static SocketTCP::SlowConsumerPolicy inferSlowConsumerPolicy();
+#endif
 
     int my_tcpPort;
     int my_udpPort;
@@ -119,6 +184,18 @@ private:
     MessageBuffer my_NM_msgBufReceive;
     
     MessageProcessor my_processor;
+
+    /** Latency histograms, only when CERTI_RTIG_TIMINGS names the file receiving them. */
+    std::unique_ptr<MessageTimings> my_timings;
+
+    /** Federation workers, only when CERTI_RTIG_WORKERS is set, otherwise
+     * every message is processed by the RTIG thread. */
+    std::unique_ptr<FederationWorkers> my_workers;
+
+#ifndef _WIN32
+    /** Pipe on which workers wake up the RTIG thread, only with workers and output queues. */
+    int my_wakeUpPipe[2];
+#endif
 };
 }
 } // namespaces
@@ -91,6 +91,8 @@ void NewHandler() throw(MemoryExhausted)
  * to satify HLA request coming from the Federate.
  * In particular RTIG is responsible for giving to the Federate (through its RTIA)
  * the FOM file needed to create or join the federation.
+ * The RTIG audits the messages it processes in the binary file RTIG.audit
+ * of its working directory, which CertiAuditDecode prints as text.
  * \copydoc certi_FOM_FileSearch
  * @ingroup certi_executable
  */
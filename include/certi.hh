@@ -158,6 +158,19 @@ typedef std::string ObjectName_t ;
 typedef std::vector<char> AttributeValue_t;
 typedef std::vector<char> ParameterValue_t;
 
+/** Bytes of an attribute or parameter value owned by the caller of a message
+ * setter, serialized without being copied into the message first.
+ */
+struct ValueView {
+    ValueView() = default;
+    ValueView(const void* bytes, uint32_t length) : data(static_cast<const char*>(bytes)), size(length)
+    {
+    }
+
+    const char* data{nullptr};
+    uint32_t size{0};
+};
+
 enum ResignAction {
     RELEASE_ATTRIBUTES = 1,
     DELETE_OBJECTS,
@@ -229,15 +242,15 @@ typedef basic_stringize<wchar_t> wstringize;
 // You can comment the next line out if you don't want to use Multicast.
 // #define FEDERATION_USES_MULTICAST
 
-// If this macro is defined, some messages will be sent on UDP sockets
-// by the RTIG to the RTIAs. Some messages types are NULL messages, and
-// all Reflect Attributes Values messages, and Receive Interaction messages,
-// even those with data asking for a "RELIABLE" service level.
-// #define HLA_USES_UDP
+// HLA_USES_UDP is set by the HLA_USES_UDP CMake option. The RTIAs then send
+// the receive order updates and interactions whose attributes or interaction
+// class are "BEST_EFFORT" as UDP datagrams, and the RTIG forwards them the
+// same way. Messages larger than a datagram still go through TCP.
 
 // The next macro must contain the path name of the Audit File. It should
 // be an absolute path, but it may be a relative path for testing reasons.
-#define RTIG_AUDIT_FILENAME "RTIG.log"
+// The file is binary, CertiAuditDecode prints it as text.
+#define RTIG_AUDIT_FILENAME "RTIG.audit"
 
 // Define the lower audit level you need, from AUDIT_MIN_LEVEL(0, all)
 // to AUDIT_MAX_LEVEL(10, min audit logging).
@@ -44,6 +44,7 @@
 #endif
 
 class RTIambPrivateRefs ;
+class RTIambExtensions ;
 struct RTIambPrivateData ;
 
 /**
@@ -73,6 +74,7 @@ public:
 	RTIambPrivateData *privateData ;
     private:
 	RTIambPrivateRefs* privateRefs ;
+	friend class ::RTIambExtensions ;
     };
 
     /**
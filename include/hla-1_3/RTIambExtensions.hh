@@ -0,0 +1,34 @@
+// HLA 1.3 Header "RTIambExtensions.hh"
+// CERTI extensions of the HLA 1.3 RTI ambassador, not part of the standard API.
+
+#ifndef RTIambExtensions_hh
+#define RTIambExtensions_hh
+
+#include "RTI.hh"
+
+/**
+ * CERTI extensions of the HLA 1.3 RTI ambassador.
+ * @ingroup libRTI
+ */
+class RTI_EXPORT RTIambExtensions
+{
+public:
+    /**
+     * Query the oldest failure of a pipelined update or interaction.
+     * With CERTI_PIPELINED_UPDATES set, updateAttributeValues and sendInteraction
+     * return before the RTIG has checked them. Their failures are kept by the RTIA,
+     * in order, until they are queried.
+     * @param[in] rtiAmbassador the ambassador which made the calls
+     * @param[out] exceptionType the type of the exception raised by the RTIG,
+     *                           e.g. RTI::AttributeNotOwned::type
+     * @param[out] reason the reason of the exception, to be freed with delete[],
+     *                    or NULL if no failure is pending
+     * @return the rank of the failed call among the updateAttributeValues and
+     *         sendInteraction calls of the federate, counted from 1, or 0 if no
+     *         failure is pending
+     */
+    static RTI::ULong queryPipelinedFailure(RTI::RTIambassador& rtiAmbassador, long& exceptionType, char*& reason)
+        throw(RTI::FederateNotExecutionMember, RTI::ConcurrentAccessAttempted, RTI::RTIinternalError);
+};
+
+#endif
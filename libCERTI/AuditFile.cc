@@ -23,7 +23,10 @@
 
 #include "AuditFile.hh"
 
+#include <algorithm>
+#include <chrono>
 #include <cstdarg>
+#include <cstring>
 #include <iostream>
 #include <sstream>
 
@@ -33,27 +36,35 @@ static const auto AuditMaxLevel = certi::AuditLine::Level{10};
 
 static const auto StartAudit = certi::AuditLine::Type{128};
 static const auto StopAudit = certi::AuditLine::Type{129};
+static const auto AuditLost = certi::AuditLine::Type{130};
 
 static const auto NormalStatus = certi::AuditLine::Status(certi::Exception::Type::NO_EXCEPTION);
+
+/// The writer thread wakes up this often, or when the ring buffer is half full.
+static constexpr std::chrono::milliseconds the_write_interval{100};
 }
 
 namespace certi {
 
-AuditFile::AuditFile(const std::string& log_file_name) : my_audit_file{log_file_name, std::ios::app}
+constexpr std::size_t AuditFile::the_default_buffer_size;
+constexpr char AuditFile::the_magic[8];
+
+AuditFile::AuditFile(const std::string& log_file_name, const std::size_t buffer_size)
+    : my_audit_file{log_file_name, std::ios::app | std::ios::binary}, my_buffer(buffer_size)
 {
     if (!my_audit_file.is_open()) {
         std::cerr << "Could not open Audit file: " << log_file_name << std::endl;
         throw RTIinternalError("Could not open Audit file.");
     }
 
-    // Put legend
-    my_audit_file << "date\t"
-                  << "fed-o\t"
-                  << "fed\t"
-                  << "type\t"
-                  << "level\t"
-                  << "status\t"
-                  << "comment" << std::endl;
+    // A new file starts with the magic bytes, the records of each run follow
+    my_audit_file.seekp(0, std::ios::end);
+    if (my_audit_file.tellp() == 0) {
+        my_audit_file.write(the_magic, sizeof(the_magic));
+        my_audit_file.flush();
+    }
+
+    my_writer = std::thread(&AuditFile::writeLines, this);
 
     // Put a Start delimiter in the Audit File
     putLine(StartAudit, AuditMaxLevel, NormalStatus, "");
@@ -63,6 +74,13 @@ AuditFile::~AuditFile()
 {
     endLine(NormalStatus, "");
     putLine(StopAudit, AuditMaxLevel, NormalStatus, "");
+
+    {
+        std::lock_guard<std::mutex> lock(my_mutex);
+        my_stopping = true;
+    }
+    my_writer_wakeup.notify_one();
+    my_writer.join();
     my_audit_file.close();
 }
 
@@ -70,35 +88,41 @@ void AuditFile::startLine(const Handle federation_handle,
                           const FederateHandle federate_handle,
                           const AuditLine::Type type)
 {
+    std::lock_guard<std::mutex> lock(my_mutex);
+    auto& line = currentLine();
+
     // Check already valid opened line
-    if (my_current_line.started()) {
+    if (line.started()) {
         std::cerr << "Audit Error : Current line already valid !" << std::endl;
         return;
     }
 
-    my_current_line = AuditLine(type, AuditMinLevel, NormalStatus, "");
-    my_current_line.setFederation(federation_handle);
-    my_current_line.setFederate(federate_handle);
+    line = AuditLine(type, AuditMinLevel, NormalStatus, "");
+    line.setFederation(federation_handle);
+    line.setFederate(federate_handle);
 }
 
 void AuditFile::setLevel(const AuditLine::Level level)
 {
-    my_current_line.setLevel(level);
+    std::lock_guard<std::mutex> lock(my_mutex);
+    currentLine().setLevel(level);
 }
 
 void AuditFile::endLine(const AuditLine::Status status, const std::string& reason)
 {
-    if (my_current_line.started()) {
-        my_current_line.end(status, reason);
+    std::lock_guard<std::mutex> lock(my_mutex);
+    auto& line = currentLine();
+
+    if (line.started()) {
+        line.end(status, reason);
     }
 
     // Log depending on level and non-zero status.
-    if (my_current_line.getLevel().get() >= AUDIT_CURRENT_LEVEL
-        || my_current_line.getStatus().get() != Exception::Type::NO_EXCEPTION) {
-        my_current_line.write(my_audit_file);
+    if (line.getLevel().get() >= AUDIT_CURRENT_LEVEL || line.getStatus().get() != Exception::Type::NO_EXCEPTION) {
+        push(line);
     }
 
-    my_current_line = AuditLine();
+    my_current_lines.erase(std::this_thread::get_id());
 }
 
 void AuditFile::putLine(const AuditLine::Type type,
@@ -108,21 +132,24 @@ void AuditFile::putLine(const AuditLine::Type type,
 {
     if (level.get() >= AUDIT_CURRENT_LEVEL) {
         AuditLine line(type, level, status, reason);
-        line.write(my_audit_file);
+        std::lock_guard<std::mutex> lock(my_mutex);
+        push(line);
     }
 }
 
 AuditFile& AuditFile::operator<<(const char* s)
 {
     if (s) {
-        my_current_line.addComment(s);
+        std::lock_guard<std::mutex> lock(my_mutex);
+        currentLine().addComment(s);
     }
     return *this;
 }
 
 AuditFile& AuditFile::operator<<(const std::string& s)
 {
-    my_current_line.addComment(s);
+    std::lock_guard<std::mutex> lock(my_mutex);
+    currentLine().addComment(s);
     return *this;
 }
 
@@ -150,4 +177,117 @@ AuditFile& AuditFile::operator<<(const double n)
 {
     return (*this << std::to_string(n));
 }
+
+AuditLine& AuditFile::currentLine()
+{
+    return my_current_lines[std::this_thread::get_id()];
+}
+
+void AuditFile::flush()
+{
+    std::unique_lock<std::mutex> lock(my_mutex);
+    my_flushing = true;
+    my_writer_wakeup.notify_one();
+    my_written.wait(lock, [this] { return my_used == 0; });
+}
+
+uint64_t AuditFile::getDroppedLines()
+{
+    std::lock_guard<std::mutex> lock(my_mutex);
+    return my_dropped_lines;
+}
+
+void AuditFile::push(const AuditLine& line)
+{
+    my_record.clear();
+    line.encode(my_record);
+
+    const auto size = my_buffer.size();
+    if (my_record.size() > size - my_used) {
+        ++my_dropped_lines;
+        return;
+    }
+
+    const auto end = (my_begin + my_used) % size;
+    const auto first = std::min(my_record.size(), size - end);
+    std::memcpy(&my_buffer[end], my_record.data(), first);
+    std::memcpy(&my_buffer[0], my_record.data() + first, my_record.size() - first);
+
+    const bool half_full = my_used < size / 2 && my_used + my_record.size() >= size / 2;
+    my_used += my_record.size();
+    if (half_full) {
+        my_writer_wakeup.notify_one();
+    }
+}
+
+void AuditFile::writeLines()
+{
+    uint64_t reported_drops{0};
+    std::string lost_record;
+
+    std::unique_lock<std::mutex> lock(my_mutex);
+    while (true) {
+        my_writer_wakeup.wait_for(lock, the_write_interval, [this] {
+            return my_stopping || my_flushing || my_used >= my_buffer.size() / 2;
+        });
+        my_flushing = false;
+
+        const auto begin = my_begin;
+        const auto used = my_used;
+        const auto dropped = my_dropped_lines;
+        const bool stopping = my_stopping;
+
+        if (used > 0 || dropped != reported_drops) {
+            // The producers only append after my_begin + my_used, this part is left alone
+            lock.unlock();
+
+            const auto first = std::min(used, my_buffer.size() - begin);
+            my_audit_file.write(&my_buffer[begin], first);
+            my_audit_file.write(&my_buffer[0], used - first);
+
+            if (dropped != reported_drops) {
+                lost_record.clear();
+                AuditLine(AuditLost,
+                          AuditMaxLevel,
+                          NormalStatus,
+                          std::to_string(dropped - reported_drops) + " audit lines lost")
+                    .encode(lost_record);
+                my_audit_file.write(lost_record.data(), lost_record.size());
+                reported_drops = dropped;
+            }
+            my_audit_file.flush();
+
+            lock.lock();
+            my_begin = (begin + used) % my_buffer.size();
+            my_used -= used;
+        }
+        my_written.notify_all();
+
+        if (stopping && my_used == 0) {
+            return;
+        }
+    }
+}
+
+void AuditFile::decode(std::istream& audit_file, std::ostream& output)
+{
+    char magic[sizeof(the_magic)];
+    if (!audit_file.read(magic, sizeof(magic)) || std::memcmp(magic, the_magic, sizeof(magic)) != 0) {
+        throw RTIinternalError("Not an audit file.");
+    }
+
+    // Put legend
+    output << "date\t"
+           << "fed-o\t"
+           << "fed\t"
+           << "type\t"
+           << "level\t"
+           << "status\t"
+           << "comment" << std::endl;
+
+    AuditLine line;
+    while (line.decode(audit_file)) {
+        line.write(output);
+    }
+}
 }
@@ -28,8 +28,14 @@
 #include "Exception.hh"
 #include <include/certi.hh>
 
+#include <condition_variable>
+#include <cstdint>
 #include <fstream>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace certi {
 
@@ -45,6 +51,15 @@ namespace certi {
  * adds the parameter string to the current line. Then a last call to EndLine
  * will set the line's status (or Result) and flush the line into the Audit
  * file.
+ * Each thread builds its own current line, so that RTIG worker threads can
+ * audit the messages they process concurrently.
+ *
+ * The lines are stored as binary records (see AuditLine::encode) in a ring
+ * buffer of fixed size, which a writer thread drains to the file in batches,
+ * so that the calling threads never wait for the disk. When the writer falls
+ * behind and the ring is full, new lines are dropped; the writer then records
+ * how many were lost in a line of type AuditLost. The file starts with the
+ * magic bytes the_magic, CertiAuditDecode (or decode) prints it as text.
  */
 class CERTI_EXPORT AuditFile {
 public:
@@ -52,7 +67,8 @@ public:
      * 
      * Audit file is used to store information about actions taken by the RTIG
      */
-    AuditFile(const std::string& log_file_name); // Open LogFileName for writing.
+    AuditFile(const std::string& log_file_name,
+              const std::size_t buffer_size = the_default_buffer_size); // Open LogFileName for writing.
 
     /** delete an AuditFile instance.
      * 
@@ -106,9 +122,45 @@ public:
         return (*this << ss.str());
     }
 
+    /// Wait until the lines ended so far are written to the file.
+    void flush();
+
+    /// Number of lines dropped because the ring buffer was full.
+    uint64_t getDroppedLines();
+
+    /** Print an audit file as text, one tab separated line per record.
+     * 
+     * Throws RTIinternalError if the stream is not an audit file or is truncated.
+     */
+    static void decode(std::istream& audit_file, std::ostream& output);
+
+    static constexpr std::size_t the_default_buffer_size{1024 * 1024};
+    static constexpr char the_magic[8]{'C', 'E', 'R', 'T', 'I', 'A', 'U', '1'};
+
 protected:
-    std::ofstream my_audit_file; /// Stream pointer to output file.
-    AuditLine my_current_line; /// Line currently being processed.
+    /// Line currently being processed by the calling thread, my_mutex must be held.
+    AuditLine& currentLine();
+
+    /// Copy the record of a line into the ring buffer, or drop it, my_mutex must be held.
+    void push(const AuditLine& line);
+
+    /// Body of the writer thread.
+    void writeLines();
+
+    std::ofstream my_audit_file; /// Stream pointer to output file, only used by the writer thread.
+    std::mutex my_mutex; /// Protects the ring buffer and the current lines.
+    std::unordered_map<std::thread::id, AuditLine> my_current_lines; /// Lines currently being processed.
+
+    std::vector<char> my_buffer; /// Ring buffer of the records not written yet.
+    std::size_t my_begin{0}; /// Position of the first record in the ring buffer.
+    std::size_t my_used{0}; /// Bytes of the ring buffer in use.
+    std::string my_record; /// Scratch record, my_mutex must be held.
+    uint64_t my_dropped_lines{0};
+    bool my_flushing{false};
+    bool my_stopping{false};
+    std::condition_variable my_writer_wakeup;
+    std::condition_variable my_written;
+    std::thread my_writer;
 };
 
 } // namespace certi
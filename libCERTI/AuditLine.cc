@@ -25,8 +25,30 @@
 
 #include "certi.hh"
 
+#include <cstdint>
 #include <string>
 
+namespace {
+// Fields after the record size, before the comment
+static constexpr std::size_t the_fixed_size{8 + 4 + 4 + 2 + 2 + 1};
+
+void encodeInteger(std::string& record, const uint64_t value, const int bytes)
+{
+    for (int shift = (bytes - 1) * 8; shift >= 0; shift -= 8) {
+        record.push_back(static_cast<char>((value >> shift) & 0xff));
+    }
+}
+
+uint64_t decodeInteger(const char*& data, const int bytes)
+{
+    uint64_t value{0};
+    for (int i = 0; i < bytes; ++i) {
+        value = (value << 8) | static_cast<unsigned char>(*data++);
+    }
+    return value;
+}
+}
+
 namespace certi {
 
 AuditLine::AuditLine(const AuditLine::Type type,
@@ -53,9 +75,52 @@ void AuditLine::write(std::ostream& audit_file)
 {
     audit_file << my_date << '\t' << my_federation << '\t' << my_federate << '\t' << my_type.get() << '\t'
                << my_level.get() << '\t' << static_cast<unsigned int>(my_status.get()) << '\t' << my_comment
-               << std::endl;
+               << '\n';
+}
 
-    audit_file.flush();
+void AuditLine::encode(std::string& record) const
+{
+    encodeInteger(record, the_fixed_size + my_comment.size(), 4);
+    encodeInteger(record, static_cast<uint64_t>(static_cast<int64_t>(my_date)), 8);
+    encodeInteger(record, my_federation, 4);
+    encodeInteger(record, my_federate, 4);
+    encodeInteger(record, my_type.get(), 2);
+    encodeInteger(record, my_level.get(), 2);
+    encodeInteger(record, static_cast<uint8_t>(my_status.get()), 1);
+    record += my_comment;
+}
+
+bool AuditLine::decode(std::istream& stream)
+{
+    char size_bytes[4];
+    if (!stream.read(size_bytes, sizeof(size_bytes))) {
+        if (stream.gcount() == 0) {
+            return false;
+        }
+        throw RTIinternalError("Truncated audit record size");
+    }
+
+    const char* data = size_bytes;
+    const auto size = decodeInteger(data, 4);
+    if (size < the_fixed_size) {
+        throw RTIinternalError("Invalid audit record size");
+    }
+
+    std::string record(size, '\0');
+    if (!stream.read(&record[0], size)) {
+        throw RTIinternalError("Truncated audit record");
+    }
+
+    data = record.data();
+    my_date = static_cast<time_t>(static_cast<int64_t>(decodeInteger(data, 8)));
+    my_federation = decodeInteger(data, 4);
+    my_federate = decodeInteger(data, 4);
+    my_type = Type(decodeInteger(data, 2));
+    my_level = Level(decodeInteger(data, 2));
+    my_status = Status(static_cast<Exception::Type>(decodeInteger(data, 1)));
+    my_comment.assign(data, record.data() + size);
+    my_is_modified = true;
+    return true;
 }
 
 AuditLine::Level AuditLine::getLevel() const
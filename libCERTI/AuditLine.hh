@@ -31,6 +31,7 @@
 #include "StrongType.hh"
 
 #include <ctime>
+#include <istream>
 #include <ostream>
 #include <string>
 
@@ -59,6 +60,17 @@ public:
      */
     void write(std::ostream&);
 
+    /** Append the binary record of the line to a buffer.
+     * 
+     * The record is the size of what follows, then the date, federation,
+     * federate, type, level, status and comment, in network byte order. This
+     * is what AuditFile stores, write gives the text form back.
+     */
+    void encode(std::string& record) const;
+
+    /// Read the next binary record of a stream, false at its end. Throws RTIinternalError if truncated.
+    bool decode(std::istream& stream);
+
     /// Add str at the end of comment.
     void addComment(const std::string& str);
 
@@ -0,0 +1,113 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+// ----------------------------------------------------------------------------
+
+#include "FomNameCache.hh"
+
+#include "M_Classes.hh"
+#include "Named.hh"
+#include "PrettyDebug.hh"
+
+namespace certi {
+
+static PrettyDebug D("FOMNAMECACHE", __FILE__);
+
+void FomNameCache::assign(const M_Join_Federation_Execution_V4& answer)
+{
+    clear();
+
+    const auto addAll = [this](const Kind kind, const std::vector<FomName>& names) {
+        for (const auto& name : names) {
+            add(kind, name.getOwner(), name.getHandle(), name.getName());
+        }
+    };
+    addAll(Kind::ObjectClass, answer.getObjectClassNames());
+    addAll(Kind::Attribute, answer.getAttributeNames());
+    addAll(Kind::InteractionClass, answer.getInteractionClassNames());
+    addAll(Kind::Parameter, answer.getParameterNames());
+
+    Debug(D, pdInit) << "Names of " << size(Kind::ObjectClass) << " object classes and "
+                     << size(Kind::InteractionClass) << " interaction classes received" << std::endl;
+}
+
+void FomNameCache::clear()
+{
+    for (auto& table : my_tables) {
+        table.handles.clear();
+        table.names.clear();
+    }
+}
+
+Handle FomNameCache::getHandle(const Kind kind, const std::string& name, const Handle owner) const
+{
+    const auto& handles = my_tables[static_cast<size_t>(kind)].handles;
+
+    auto names = handles.find(owner);
+    if (names == handles.end()) {
+        return 0;
+    }
+    auto it = names->second.find(name);
+    return it == names->second.end() ? 0 : it->second;
+}
+
+const std::string* FomNameCache::getName(const Kind kind, const Handle handle, const Handle owner) const
+{
+    const auto& names = my_tables[static_cast<size_t>(kind)].names;
+
+    auto it = names.find(key(owner, handle));
+    return it == names.end() ? nullptr : &it->second;
+}
+
+void FomNameCache::add(const Kind kind, const Handle owner, const Handle handle, const std::string& name)
+{
+    auto& table = my_tables[static_cast<size_t>(kind)];
+    table.names[key(owner, handle)] = name;
+    table.handles[owner][name] = handle;
+}
+
+void FomNameCache::addHandle(const Kind kind, const Handle owner, const std::string& name, const Handle handle)
+{
+    if (kind == Kind::ObjectClass || kind == Kind::InteractionClass) {
+        // The RTIA ignores the root of a qualified name
+        auto rest = name;
+        const auto prefix = Named::getNextClassName(rest);
+        if (prefix != "ObjectRoot" && prefix != "InteractionRoot" && prefix != "HLAobjectRoot"
+            && prefix != "HLAinteractionRoot") {
+            rest = name;
+        }
+
+        // then looks for a class of that short name if none has the name
+        const auto* known = getName(kind, handle, owner);
+        if (!Named::isQualifiedClassName(rest) && (!known || *known != rest)) {
+            return;
+        }
+    }
+    my_tables[static_cast<size_t>(kind)].handles[owner][name] = handle;
+}
+
+size_t FomNameCache::size(const Kind kind) const
+{
+    return my_tables[static_cast<size_t>(kind)].names.size();
+}
+
+uint64_t FomNameCache::key(const Handle owner, const Handle handle)
+{
+    return (static_cast<uint64_t>(owner) << 32) | handle;
+}
+
+} // namespace certi
@@ -0,0 +1,88 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_FOM_NAME_CACHE_HH
+#define CERTI_FOM_NAME_CACHE_HH
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include <include/certi.hh>
+
+#include "Handle.hh"
+
+namespace certi {
+
+class M_Join_Federation_Execution_V4;
+
+/**
+ * Federate side copy of the names and handles of the federation object model.
+ *
+ * The RTIA sends them in the answer to the join request, the libRTI then
+ * resolves handles and names from here instead of asking the RTIA each time.
+ * Names and handles never change during a federation execution, but modules
+ * merged after the join are not sent: what is not found is asked to the RTIA
+ * as before and its answer is added.
+ *
+ * Only the names the RTIA resolves exactly are kept. The short names of
+ * classes it also accepts are not, since another class of the same leaf name
+ * may be merged later.
+ */
+class CERTI_EXPORT FomNameCache {
+public:
+    enum class Kind { ObjectClass, Attribute, InteractionClass, Parameter };
+
+    /// Replace the names by those of a join answer.
+    void assign(const M_Join_Federation_Execution_V4& answer);
+
+    void clear();
+
+    /**
+     * Handle of a name, 0 if it is not known.
+     * The owner is the class of an attribute or a parameter, 0 for a class.
+     */
+    Handle getHandle(const Kind kind, const std::string& name, const Handle owner = 0) const;
+
+    /// Name of a handle, nullptr if it is not known.
+    const std::string* getName(const Kind kind, const Handle handle, const Handle owner = 0) const;
+
+    /// Add the name of a handle, as given by the RTIA.
+    void add(const Kind kind, const Handle owner, const Handle handle, const std::string& name);
+
+    /// Add the handle the RTIA resolved a name to, if the name is one it resolves exactly.
+    void addHandle(const Kind kind, const Handle owner, const std::string& name, const Handle handle);
+
+    size_t size(const Kind kind) const;
+
+private:
+    struct Table {
+        std::unordered_map<Handle, std::unordered_map<std::string, Handle>> handles;
+        std::unordered_map<uint64_t, std::string> names;
+    };
+
+    static uint64_t key(const Handle owner, const Handle handle);
+
+    std::array<Table, 4> my_tables;
+};
+
+} // namespace certi
+
+#endif // CERTI_FOM_NAME_CACHE_HH
@@ -395,7 +395,7 @@ Interaction::sendInteraction(FederateHandle federate_handle,
         }
 
         Debug(D, pdProtocol) << "Preparing broadcast list." << std::endl;
-        ibList = new InteractionBroadcastList(answer);
+        ibList = new InteractionBroadcastList(std::move(answer));
 
         responses = broadcastInteractionMessage(ibList, region);
     }
@@ -450,7 +450,7 @@ Interaction::sendInteraction(FederateHandle federate_handle,
         }
 
         Debug(D, pdProtocol) << "Preparing broadcast list." << std::endl;
-        ibList = new InteractionBroadcastList(answer);
+        ibList = new InteractionBroadcastList(std::move(answer));
 
         responses = broadcastInteractionMessage(ibList, region);
     }
@@ -205,7 +205,7 @@ public:
     SecurityServer* server;
 
     /*! Interaction messages' Transport Type(Reliable, Best Effort),
-      Currently not used.
+      used by the RTIA of the sender.
      */
     TransportType transport;
 
@@ -214,6 +214,13 @@ public:
 
     bool isPublishing(FederateHandle);
 
+    typedef std::set<FederateHandle> PublishersList;
+
+    const PublishersList& getPublishers() const
+    {
+        return publishers;
+    }
+
 private:
     /*
      * private default constructor with no code
@@ -246,7 +253,6 @@ private:
     //! List of this Interaction Class' Parameters.
     HandleParameterMap _handleParameterMap;
 
-    typedef std::set<FederateHandle> PublishersList;
     PublishersList publishers;
 };
 
@@ -46,7 +46,7 @@ void InteractionBroadcastList::addFederate(FederateHandle federate)
     }
 }
 
-InteractionBroadcastList::InteractionBroadcastList(NM_Receive_Interaction message) : my_message{message}
+InteractionBroadcastList::InteractionBroadcastList(NM_Receive_Interaction message) : my_message{std::move(message)}
 {
     Debug(G, pdGendoc) << "enter InteractionBroadcastList::InteractionBroadcastList" << std::endl;
 
@@ -71,11 +71,7 @@ Responses InteractionBroadcastList::preparePendingMessage(SecurityServer& server
             Debug(D, pdProtocol) << "Broadcasting message to Federate " << pair.first << std::endl;
 
             try {
-#ifdef HLA_USES_UDP
-                sockets.push_back(server.getSocketLink(pair.first, BEST_EFFORT));
-#else
                 sockets.push_back(server.getSocketLink(pair.first));
-#endif
             }
             catch (Exception& e) {
                 Debug(D, pdExcept) << "Reference to a killed Federate while broadcasting." << std::endl;
@@ -46,21 +46,25 @@ LBTS::~LBTS()
 
 void LBTS::compute()
 {
-    FederationTime hl;
-
     // LBTS = + l'infini
     _LBTS.setPositiveInfinity();
 
-    ClockSet::iterator i;
-    for (i = clocks.begin(); i != clocks.end(); ++i) {
-        if (i->first != MyFederateNumber) {
-            hl = i->second;
-            if (hl < _LBTS)
-                _LBTS = hl;
+    // Our own clock is skipped, so at most two clocks are looked at
+    for (ClockOrder::const_iterator i = order.begin(); i != order.end(); ++i) {
+        if (i->second != MyFederateNumber) {
+            _LBTS = i->first;
+            break;
         }
     }
 } /* end of compute */
 
+void LBTS::setClock(ClockSet::iterator clock, FederationTime time)
+{
+    order.erase(clock->second.position);
+    clock->second.time = time;
+    clock->second.position = order.insert(ClockOrder::value_type(time, clock->first));
+}
+
 bool LBTS::exists(FederateHandle federate) const
 {
     return clocks.find(federate) != clocks.end();
@@ -74,9 +78,21 @@ void LBTS::get(std::vector<FederateClock>& v) const
 {
     v.reserve(v.size() + clocks.size());
     // append clocks to v
-    // note, the ClockSet::value_type and FederateClock differ in const-ness
+    // note, the ClockSet::value_type also holds the position of the clock in the time index
     for (ClockSet::const_iterator pos = clocks.begin(); pos != clocks.end(); ++pos)
-        v.push_back(FederateClock(pos->first, pos->second));
+        v.push_back(FederateClock(pos->first, pos->second.time));
+}
+
+// ----------------------------------------------------------------------------
+FederationTime LBTS::get(FederateHandle federate) const
+{
+    ClockSet::const_iterator it = clocks.find(federate);
+
+    if (it == clocks.end()) {
+        throw RTIinternalError("LBTS: Federate <" + std::to_string(federate) + "> not found.");
+    }
+
+    return it->second.time;
 }
 
 // ----------------------------------------------------------------------------
@@ -89,7 +105,22 @@ void LBTS::insert(FederateHandle num_fed, FederationTime time)
         throw RTIinternalError("LBTS: Federate already present.");
 
     // BUG: We should verify that clock time is correct.
-    clocks[num_fed] = time;
+    Clock& clock = clocks[num_fed];
+    clock.time = time;
+    clock.position = order.insert(ClockOrder::value_type(time, num_fed));
+    compute();
+}
+
+// ----------------------------------------------------------------------------
+void LBTS::set(FederateHandle num_fed, FederationTime time)
+{
+    ClockSet::iterator it = clocks.find(num_fed);
+
+    if (it == clocks.end()) {
+        throw RTIinternalError("LBTS: Federate <" + std::to_string(num_fed) + "> not found.");
+    }
+
+    setClock(it, time);
     compute();
 }
 
@@ -123,14 +154,14 @@ void LBTS::update(FederateHandle federateHandle, FederationTime time)
 
     do {
         // Coherence test.
-        if (it->second > time) {
+        if (it->second.time > time) {
             Debug(D, pdDebug) << "LBTS.update: federate " << federateHandle << ", new time lower than oldest one."
                               << std::endl;
         }
         else {
-            Debug(D, pdDebug) << "LBTS.update: federate " << it->first << ", time " << it->second.getTime() << " --> "
-                              << time.getTime() << std::endl;
-            it->second = time;
+            Debug(D, pdDebug) << "LBTS.update: federate " << it->first << ", time " << it->second.time.getTime()
+                              << " --> " << time.getTime() << std::endl;
+            setClock(it, time);
         }
         if (it != itend)
             ++it;
@@ -149,6 +180,7 @@ void LBTS::remove(FederateHandle num_fed)
         throw RTIinternalError("LBTS: Federate <" + std::to_string(num_fed) + "not found.");
     }
 
+    order.erase(it->second.position);
     clocks.erase(it);
     compute();
 }
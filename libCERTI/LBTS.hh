@@ -35,6 +35,10 @@ namespace certi {
 
 /**
  * The Lower Bound on TimeStamp class.
+ *
+ * Clocks are indexed both by federate and by time, so that updating one
+ * clock costs O(log n) and the LBTS, the smallest clock which is not ours,
+ * is read in constant time.
  */
 class CERTI_EXPORT LBTS {
 public:
@@ -53,8 +57,13 @@ public:
      */
     ~LBTS();
 
+    /// The time index refers to our own clocks, it cannot be copied as is.
+    LBTS(const LBTS&) = delete;
+    LBTS& operator=(const LBTS&) = delete;
+
     /**
      *  Compute the LBTS from the federate clocks value.
+     *  The clocks are kept sorted, so this only looks at the smallest ones.
      */
     void compute();
 
@@ -70,7 +79,21 @@ public:
      */
     bool exists(FederateHandle) const;
     void get(std::vector<FederateClock>&) const;
+
+    /**
+     * Return the clock of one federate.
+     * @throw RTIinternalError if the federate is not present.
+     */
+    FederationTime get(FederateHandle) const;
+
     void insert(FederateHandle num_fed, FederationTime the_time);
+
+    /**
+     * Set the clock of one federate, even if the new time is lower than
+     * the current one, unlike update.
+     * @throw RTIinternalError if the federate is not present.
+     */
+    void set(FederateHandle num_fed, FederationTime the_time);
     void remove(FederateHandle num_fed);
     void setFederate(FederateHandle handle)
     {
@@ -119,9 +142,28 @@ protected:
     FederationTime _LastAnonymousUpdateNMP{0.0};
 
 private:
-    typedef std::map<FederateHandle, FederationTime> ClockSet;
+    /// Strict ordering on the raw time, FederationTime comparisons use a tolerance.
+    struct ClockBefore {
+        bool operator()(const FederationTime& lhs, const FederationTime& rhs) const
+        {
+            return lhs.getTime() < rhs.getTime();
+        }
+    };
+
+    typedef std::multimap<FederationTime, FederateHandle, ClockBefore> ClockOrder;
+
+    struct Clock {
+        FederationTime time;
+        ClockOrder::iterator position;
+    };
+
+    typedef std::map<FederateHandle, Clock> ClockSet;
+
+    /** Move one clock to a new time, keeping the time index up to date. */
+    void setClock(ClockSet::iterator clock, FederationTime time);
 
     ClockSet clocks;
+    ClockOrder order;
 };
 }
 
@@ -1,4 +1,5 @@
-// Generated on 2018 April Fri, 13 at 11:41:23 by the CERTI message generator
+// Generated on 2026 October Sun, 18 at 09:22:38 by the CERTI message generator
+#include <memory>
 #include <string>
 #include <vector>
 #include "M_Classes.hh"
@@ -73,6 +74,65 @@ std::ostream& operator<<(std::ostream& os, const EventRetraction& msg)
     return os;
 }
 
+void FomName::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Specific serialization code
+    msgBuffer.write_uint32(owner);
+    msgBuffer.write_uint32(handle);
+    msgBuffer.write_string(name);
+}
+
+void FomName::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Specific deserialization code
+    owner = static_cast<Handle>(msgBuffer.read_uint32());
+    handle = static_cast<Handle>(msgBuffer.read_uint32());
+    msgBuffer.read_string(name);
+}
+
+const Handle& FomName::getOwner() const
+{
+    return owner;
+}
+
+void FomName::setOwner(const Handle& newOwner)
+{
+    owner = newOwner;
+}
+
+const Handle& FomName::getHandle() const
+{
+    return handle;
+}
+
+void FomName::setHandle(const Handle& newHandle)
+{
+    handle = newHandle;
+}
+
+const std::string& FomName::getName() const
+{
+    return name;
+}
+
+void FomName::setName(const std::string& newName)
+{
+    name = newName;
+}
+
+std::ostream& operator<<(std::ostream& os, const FomName& msg)
+{
+    os << "[FomName - Begin]" << std::endl;
+    
+    // Specific display
+    os << "  owner = " << msg.owner << std::endl;
+    os << "  handle = " << msg.handle << std::endl;
+    os << "  name = " << msg.name << std::endl;
+    
+    os << "[FomName - End]" << std::endl;
+    return os;
+}
+
 M_Open_Connexion::M_Open_Connexion()
 {
     this->messageName = "M_Open_Connexion";
@@ -493,6 +553,26 @@ void M_Join_Federation_Execution_V4::serialize(libhla::MessageBuffer& msgBuffer)
     for (uint32_t i = 0; i < additionalFomModulesSize; ++i) {
         msgBuffer.write_string(additionalFomModules[i]);
     }
+    uint32_t objectClassNamesSize = objectClassNames.size();
+    msgBuffer.write_uint32(objectClassNamesSize);
+    for (uint32_t i = 0; i < objectClassNamesSize; ++i) {
+        objectClassNames[i].serialize(msgBuffer);
+    }
+    uint32_t attributeNamesSize = attributeNames.size();
+    msgBuffer.write_uint32(attributeNamesSize);
+    for (uint32_t i = 0; i < attributeNamesSize; ++i) {
+        attributeNames[i].serialize(msgBuffer);
+    }
+    uint32_t interactionClassNamesSize = interactionClassNames.size();
+    msgBuffer.write_uint32(interactionClassNamesSize);
+    for (uint32_t i = 0; i < interactionClassNamesSize; ++i) {
+        interactionClassNames[i].serialize(msgBuffer);
+    }
+    uint32_t parameterNamesSize = parameterNames.size();
+    msgBuffer.write_uint32(parameterNamesSize);
+    for (uint32_t i = 0; i < parameterNamesSize; ++i) {
+        parameterNames[i].serialize(msgBuffer);
+    }
 }
 
 void M_Join_Federation_Execution_V4::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -513,6 +593,26 @@ void M_Join_Federation_Execution_V4::deserialize(libhla::MessageBuffer& msgBuffe
     for (uint32_t i = 0; i < additionalFomModulesSize; ++i) {
         msgBuffer.read_string(additionalFomModules[i]);
     }
+    uint32_t objectClassNamesSize = msgBuffer.read_uint32();
+    objectClassNames.resize(objectClassNamesSize);
+    for (uint32_t i = 0; i < objectClassNamesSize; ++i) {
+        objectClassNames[i].deserialize(msgBuffer);
+    }
+    uint32_t attributeNamesSize = msgBuffer.read_uint32();
+    attributeNames.resize(attributeNamesSize);
+    for (uint32_t i = 0; i < attributeNamesSize; ++i) {
+        attributeNames[i].deserialize(msgBuffer);
+    }
+    uint32_t interactionClassNamesSize = msgBuffer.read_uint32();
+    interactionClassNames.resize(interactionClassNamesSize);
+    for (uint32_t i = 0; i < interactionClassNamesSize; ++i) {
+        interactionClassNames[i].deserialize(msgBuffer);
+    }
+    uint32_t parameterNamesSize = msgBuffer.read_uint32();
+    parameterNames.resize(parameterNamesSize);
+    for (uint32_t i = 0; i < parameterNamesSize; ++i) {
+        parameterNames[i].deserialize(msgBuffer);
+    }
 }
 
 const FederateHandle& M_Join_Federation_Execution_V4::getFederate() const
@@ -606,6 +706,146 @@ void M_Join_Federation_Execution_V4::removeAdditionalFomModules(uint32_t rank)
     additionalFomModules.erase(additionalFomModules.begin() + rank);
 }
 
+uint32_t M_Join_Federation_Execution_V4::getObjectClassNamesSize() const
+{
+    return objectClassNames.size();
+}
+
+void M_Join_Federation_Execution_V4::setObjectClassNamesSize(uint32_t num)
+{
+    objectClassNames.resize(num);
+}
+
+const std::vector<FomName>& M_Join_Federation_Execution_V4::getObjectClassNames() const
+{
+    return objectClassNames;
+}
+
+const FomName& M_Join_Federation_Execution_V4::getObjectClassNames(uint32_t rank) const
+{
+    return objectClassNames[rank];
+}
+
+FomName& M_Join_Federation_Execution_V4::getObjectClassNames(uint32_t rank)
+{
+    return objectClassNames[rank];
+}
+
+void M_Join_Federation_Execution_V4::setObjectClassNames(const FomName& newObjectClassNames, uint32_t rank)
+{
+    objectClassNames[rank] = newObjectClassNames;
+}
+
+void M_Join_Federation_Execution_V4::removeObjectClassNames(uint32_t rank)
+{
+    objectClassNames.erase(objectClassNames.begin() + rank);
+}
+
+uint32_t M_Join_Federation_Execution_V4::getAttributeNamesSize() const
+{
+    return attributeNames.size();
+}
+
+void M_Join_Federation_Execution_V4::setAttributeNamesSize(uint32_t num)
+{
+    attributeNames.resize(num);
+}
+
+const std::vector<FomName>& M_Join_Federation_Execution_V4::getAttributeNames() const
+{
+    return attributeNames;
+}
+
+const FomName& M_Join_Federation_Execution_V4::getAttributeNames(uint32_t rank) const
+{
+    return attributeNames[rank];
+}
+
+FomName& M_Join_Federation_Execution_V4::getAttributeNames(uint32_t rank)
+{
+    return attributeNames[rank];
+}
+
+void M_Join_Federation_Execution_V4::setAttributeNames(const FomName& newAttributeNames, uint32_t rank)
+{
+    attributeNames[rank] = newAttributeNames;
+}
+
+void M_Join_Federation_Execution_V4::removeAttributeNames(uint32_t rank)
+{
+    attributeNames.erase(attributeNames.begin() + rank);
+}
+
+uint32_t M_Join_Federation_Execution_V4::getInteractionClassNamesSize() const
+{
+    return interactionClassNames.size();
+}
+
+void M_Join_Federation_Execution_V4::setInteractionClassNamesSize(uint32_t num)
+{
+    interactionClassNames.resize(num);
+}
+
+const std::vector<FomName>& M_Join_Federation_Execution_V4::getInteractionClassNames() const
+{
+    return interactionClassNames;
+}
+
+const FomName& M_Join_Federation_Execution_V4::getInteractionClassNames(uint32_t rank) const
+{
+    return interactionClassNames[rank];
+}
+
+FomName& M_Join_Federation_Execution_V4::getInteractionClassNames(uint32_t rank)
+{
+    return interactionClassNames[rank];
+}
+
+void M_Join_Federation_Execution_V4::setInteractionClassNames(const FomName& newInteractionClassNames, uint32_t rank)
+{
+    interactionClassNames[rank] = newInteractionClassNames;
+}
+
+void M_Join_Federation_Execution_V4::removeInteractionClassNames(uint32_t rank)
+{
+    interactionClassNames.erase(interactionClassNames.begin() + rank);
+}
+
+uint32_t M_Join_Federation_Execution_V4::getParameterNamesSize() const
+{
+    return parameterNames.size();
+}
+
+void M_Join_Federation_Execution_V4::setParameterNamesSize(uint32_t num)
+{
+    parameterNames.resize(num);
+}
+
+const std::vector<FomName>& M_Join_Federation_Execution_V4::getParameterNames() const
+{
+    return parameterNames;
+}
+
+const FomName& M_Join_Federation_Execution_V4::getParameterNames(uint32_t rank) const
+{
+    return parameterNames[rank];
+}
+
+FomName& M_Join_Federation_Execution_V4::getParameterNames(uint32_t rank)
+{
+    return parameterNames[rank];
+}
+
+void M_Join_Federation_Execution_V4::setParameterNames(const FomName& newParameterNames, uint32_t rank)
+{
+    parameterNames[rank] = newParameterNames;
+}
+
+void M_Join_Federation_Execution_V4::removeParameterNames(uint32_t rank)
+{
+    parameterNames.erase(parameterNames.begin() + rank);
+}
+
 std::ostream& operator<<(std::ostream& os, const M_Join_Federation_Execution_V4& msg)
 {
     os << "[M_Join_Federation_Execution_V4 - Begin]" << std::endl;
@@ -623,6 +863,26 @@ std::ostream& operator<<(std::ostream& os, const M_Join_Federation_Execution_V4&
         os << element;
     }
     os << std::endl;
+    os << "  objectClassNames [] =" << std::endl;
+    for (const auto& element : msg.objectClassNames) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  attributeNames [] =" << std::endl;
+    for (const auto& element : msg.attributeNames) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  interactionClassNames [] =" << std::endl;
+    for (const auto& element : msg.interactionClassNames) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  parameterNames [] =" << std::endl;
+    for (const auto& element : msg.parameterNames) {
+        os << element;
+    }
+    os << std::endl;
     
     os << "[M_Join_Federation_Execution_V4 - End]" << std::endl;
     return os;
@@ -1717,6 +1977,11 @@ void M_Update_Attribute_Values::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //serialize native whose representation is 'repeated' byte 
+        if (i < _valuesViews.size() && _valuesViews[i].data) {
+            msgBuffer.write_uint32(_valuesViews[i].size);
+            msgBuffer.write_bytes(_valuesViews[i].data, _valuesViews[i].size);
+            continue;
+        }
         msgBuffer.write_uint32(values[i].size());
         msgBuffer.write_bytes(&(values[i][0]),values[i].size());
     }
@@ -1740,6 +2005,7 @@ void M_Update_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
     }
     uint32_t valuesSize = msgBuffer.read_uint32();
     values.resize(valuesSize);
+    _valuesViews.clear();
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //deserialize native whose representation is 'repeated' byte 
         values[i].resize(msgBuffer.read_uint32());
@@ -1834,11 +2100,27 @@ AttributeValue_t& M_Update_Attribute_Values::getValues(uint32_t rank)
 void M_Update_Attribute_Values::setValues(const AttributeValue_t& newValues, uint32_t rank)
 {
     values[rank] = newValues;
+    if (rank < _valuesViews.size()) {
+        _valuesViews[rank] = ValueView();
+    }
 }
 
 void M_Update_Attribute_Values::removeValues(uint32_t rank)
 {
     values.erase(values.begin() + rank);
+    if (rank < _valuesViews.size()) {
+        _valuesViews.erase(_valuesViews.begin() + rank);
+    }
+}
+
+void M_Update_Attribute_Values::setValuesView(const void* data, uint32_t size, uint32_t rank)
+{
+    // Views are only allocated by the messages using them
+    if (_valuesViews.size() < values.size()) {
+        _valuesViews.resize(values.size());
+    }
+    values[rank].clear();
+    _valuesViews[rank] = ValueView(data, size);
 }
 
 const EventRetraction& M_Update_Attribute_Values::getEventRetraction() const
@@ -2001,6 +2283,11 @@ void M_Reflect_Attribute_Values::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //serialize native whose representation is 'repeated' byte 
+        if (i < _valuesViews.size() && _valuesViews[i].data) {
+            msgBuffer.write_uint32(_valuesViews[i].size);
+            msgBuffer.write_bytes(_valuesViews[i].data, _valuesViews[i].size);
+            continue;
+        }
         msgBuffer.write_uint32(values[i].size());
         msgBuffer.write_bytes(&(values[i][0]),values[i].size());
     }
@@ -2024,6 +2311,7 @@ void M_Reflect_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
     }
     uint32_t valuesSize = msgBuffer.read_uint32();
     values.resize(valuesSize);
+    _valuesViews.clear();
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //deserialize native whose representation is 'repeated' byte 
         values[i].resize(msgBuffer.read_uint32());
@@ -2118,11 +2406,27 @@ AttributeValue_t& M_Reflect_Attribute_Values::getValues(uint32_t rank)
 void M_Reflect_Attribute_Values::setValues(const AttributeValue_t& newValues, uint32_t rank)
 {
     values[rank] = newValues;
+    if (rank < _valuesViews.size()) {
+        _valuesViews[rank] = ValueView();
+    }
 }
 
 void M_Reflect_Attribute_Values::removeValues(uint32_t rank)
 {
     values.erase(values.begin() + rank);
+    if (rank < _valuesViews.size()) {
+        _valuesViews.erase(_valuesViews.begin() + rank);
+    }
+}
+
+void M_Reflect_Attribute_Values::setValuesView(const void* data, uint32_t size, uint32_t rank)
+{
+    // Views are only allocated by the messages using them
+    if (_valuesViews.size() < values.size()) {
+        _valuesViews.resize(values.size());
+    }
+    values[rank].clear();
+    _valuesViews[rank] = ValueView(data, size);
 }
 
 const EventRetraction& M_Reflect_Attribute_Values::getEventRetraction() const
@@ -2188,6 +2492,11 @@ void M_Send_Interaction::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //serialize native whose representation is 'repeated' byte 
+        if (i < _valuesViews.size() && _valuesViews[i].data) {
+            msgBuffer.write_uint32(_valuesViews[i].size);
+            msgBuffer.write_bytes(_valuesViews[i].data, _valuesViews[i].size);
+            continue;
+        }
         msgBuffer.write_uint32(values[i].size());
         msgBuffer.write_bytes(&(values[i][0]),values[i].size());
     }
@@ -2211,6 +2520,7 @@ void M_Send_Interaction::deserialize(libhla::MessageBuffer& msgBuffer)
     }
     uint32_t valuesSize = msgBuffer.read_uint32();
     values.resize(valuesSize);
+    _valuesViews.clear();
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //deserialize native whose representation is 'repeated' byte 
         values[i].resize(msgBuffer.read_uint32());
@@ -2296,11 +2606,27 @@ ParameterValue_t& M_Send_Interaction::getValues(uint32_t rank)
 void M_Send_Interaction::setValues(const ParameterValue_t& newValues, uint32_t rank)
 {
     values[rank] = newValues;
+    if (rank < _valuesViews.size()) {
+        _valuesViews[rank] = ValueView();
+    }
 }
 
 void M_Send_Interaction::removeValues(uint32_t rank)
 {
     values.erase(values.begin() + rank);
+    if (rank < _valuesViews.size()) {
+        _valuesViews.erase(_valuesViews.begin() + rank);
+    }
+}
+
+void M_Send_Interaction::setValuesView(const void* data, uint32_t size, uint32_t rank)
+{
+    // Views are only allocated by the messages using them
+    if (_valuesViews.size() < values.size()) {
+        _valuesViews.resize(values.size());
+    }
+    values[rank].clear();
+    _valuesViews[rank] = ValueView(data, size);
 }
 
 const RegionHandle& M_Send_Interaction::getRegion() const
@@ -2376,6 +2702,11 @@ void M_Receive_Interaction::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //serialize native whose representation is 'repeated' byte 
+        if (i < _valuesViews.size() && _valuesViews[i].data) {
+            msgBuffer.write_uint32(_valuesViews[i].size);
+            msgBuffer.write_bytes(_valuesViews[i].data, _valuesViews[i].size);
+            continue;
+        }
         msgBuffer.write_uint32(values[i].size());
         msgBuffer.write_bytes(&(values[i][0]),values[i].size());
     }
@@ -2399,6 +2730,7 @@ void M_Receive_Interaction::deserialize(libhla::MessageBuffer& msgBuffer)
     }
     uint32_t valuesSize = msgBuffer.read_uint32();
     values.resize(valuesSize);
+    _valuesViews.clear();
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //deserialize native whose representation is 'repeated' byte 
         values[i].resize(msgBuffer.read_uint32());
@@ -2484,11 +2816,27 @@ ParameterValue_t& M_Receive_Interaction::getValues(uint32_t rank)
 void M_Receive_Interaction::setValues(const ParameterValue_t& newValues, uint32_t rank)
 {
     values[rank] = newValues;
+    if (rank < _valuesViews.size()) {
+        _valuesViews[rank] = ValueView();
+    }
 }
 
 void M_Receive_Interaction::removeValues(uint32_t rank)
 {
     values.erase(values.begin() + rank);
+    if (rank < _valuesViews.size()) {
+        _valuesViews.erase(_valuesViews.begin() + rank);
+    }
+}
+
+void M_Receive_Interaction::setValuesView(const void* data, uint32_t size, uint32_t rank)
+{
+    // Views are only allocated by the messages using them
+    if (_valuesViews.size() < values.size()) {
+        _valuesViews.resize(values.size());
+    }
+    values[rank].clear();
+    _valuesViews[rank] = ValueView(data, size);
 }
 
 const RegionHandle& M_Receive_Interaction::getRegion() const
@@ -8122,6 +8470,8 @@ void M_Tick_Request::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_bool(multiple);
     msgBuffer.write_double(minTickTime);
     msgBuffer.write_double(maxTickTime);
+    msgBuffer.write_uint32(batchCount);
+    msgBuffer.write_uint32(batchBytes);
 }
 
 void M_Tick_Request::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -8132,6 +8482,8 @@ void M_Tick_Request::deserialize(libhla::MessageBuffer& msgBuffer)
     multiple = msgBuffer.read_bool();
     minTickTime = msgBuffer.read_double();
     maxTickTime = msgBuffer.read_double();
+    batchCount = msgBuffer.read_uint32();
+    batchBytes = msgBuffer.read_uint32();
 }
 
 const bool& M_Tick_Request::getMultiple() const
@@ -8164,6 +8516,26 @@ void M_Tick_Request::setMaxTickTime(const double& newMaxTickTime)
     maxTickTime = newMaxTickTime;
 }
 
+const uint32_t& M_Tick_Request::getBatchCount() const
+{
+    return batchCount;
+}
+
+void M_Tick_Request::setBatchCount(const uint32_t& newBatchCount)
+{
+    batchCount = newBatchCount;
+}
+
+const uint32_t& M_Tick_Request::getBatchBytes() const
+{
+    return batchBytes;
+}
+
+void M_Tick_Request::setBatchBytes(const uint32_t& newBatchBytes)
+{
+    batchBytes = newBatchBytes;
+}
+
 std::ostream& operator<<(std::ostream& os, const M_Tick_Request& msg)
 {
     os << "[M_Tick_Request - Begin]" << std::endl;
@@ -8174,6 +8546,8 @@ std::ostream& operator<<(std::ostream& os, const M_Tick_Request& msg)
     os << "  multiple = " << msg.multiple << std::endl;
     os << "  minTickTime = " << msg.minTickTime << std::endl;
     os << "  maxTickTime = " << msg.maxTickTime << std::endl;
+    os << "  batchCount = " << msg.batchCount << std::endl;
+    os << "  batchBytes = " << msg.batchBytes << std::endl;
     
     os << "[M_Tick_Request - End]" << std::endl;
     return os;
@@ -8248,6 +8622,77 @@ M_Reserve_Object_Instance_Name_Failed::M_Reserve_Object_Instance_Name_Failed()
     this->type = Message::RESERVE_OBJECT_INSTANCE_NAME_FAILED;
 }
 
+M_Query_Pipelined_Failure::M_Query_Pipelined_Failure()
+{
+    this->messageName = "M_Query_Pipelined_Failure";
+    this->type = Message::QUERY_PIPELINED_FAILURE;
+}
+
+void M_Query_Pipelined_Failure::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_uint32(sequence);
+    msgBuffer.write_uint32(failure);
+    msgBuffer.write_string(failureReason);
+}
+
+void M_Query_Pipelined_Failure::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    sequence = msgBuffer.read_uint32();
+    failure = msgBuffer.read_uint32();
+    msgBuffer.read_string(failureReason);
+}
+
+const uint32_t& M_Query_Pipelined_Failure::getSequence() const
+{
+    return sequence;
+}
+
+void M_Query_Pipelined_Failure::setSequence(const uint32_t& newSequence)
+{
+    sequence = newSequence;
+}
+
+const uint32_t& M_Query_Pipelined_Failure::getFailure() const
+{
+    return failure;
+}
+
+void M_Query_Pipelined_Failure::setFailure(const uint32_t& newFailure)
+{
+    failure = newFailure;
+}
+
+const std::string& M_Query_Pipelined_Failure::getFailureReason() const
+{
+    return failureReason;
+}
+
+void M_Query_Pipelined_Failure::setFailureReason(const std::string& newFailureReason)
+{
+    failureReason = newFailureReason;
+}
+
+std::ostream& operator<<(std::ostream& os, const M_Query_Pipelined_Failure& msg)
+{
+    os << "[M_Query_Pipelined_Failure - Begin]" << std::endl;
+    
+    os << static_cast<const M_Query_Pipelined_Failure::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  sequence = " << msg.sequence << std::endl;
+    os << "  failure = " << msg.failure << std::endl;
+    os << "  failureReason = " << msg.failureReason << std::endl;
+    
+    os << "[M_Query_Pipelined_Failure - End]" << std::endl;
+    return os;
+}
+
 Message* M_Factory::create(M_Type type) throw (NetworkError ,NetworkSignal) { 
     Message* msg = NULL;
 
@@ -8702,6 +9147,9 @@ Message* M_Factory::create(M_Type type) throw (NetworkError ,NetworkSignal) {
         case Message::Type::RESERVE_OBJECT_INSTANCE_NAME_FAILED:
             msg = new M_Reserve_Object_Instance_Name_Failed();
             break;
+        case Message::Type::QUERY_PIPELINED_FAILURE:
+            msg = new M_Query_Pipelined_Failure();
+            break;
         case Message::Type::LAST:
             throw NetworkError("LAST message type should not be used!!");
             break;
@@ -8710,18 +9158,17 @@ Message* M_Factory::create(M_Type type) throw (NetworkError ,NetworkSignal) {
 } /* end of M_Factory::create */
 
 Message* M_Factory::receive(MStreamType stream) throw (NetworkError ,NetworkSignal) { 
-    // FIXME This is not thread safe
-    static libhla::MessageBuffer msgBuffer;
-    Message  msgGen;
-    Message* msg;
-
-    // receive generic message 
-    msgGen.receive(stream,msgBuffer);
-    // create specific message from type 
-    msg = M_Factory::create(msgGen.getMessageType());
-    msgBuffer.assumeSizeFromReservedBytes();
+    // One buffer per thread, the RTIA may run in the federate process
+    static thread_local libhla::MessageBuffer msgBuffer;
+    return M_Factory::receive(stream, msgBuffer);
+} /* end of M_Factory::receive */ 
+
+Message* M_Factory::receive(MStreamType stream, libhla::MessageBuffer& msgBuffer) throw (NetworkError ,NetworkSignal) { 
+    // receive the message, then decode it once its type is known 
+    Message::receiveBytes(stream, msgBuffer);
+    std::unique_ptr<Message> msg(M_Factory::create(Message::peekType(msgBuffer)));
     msg->deserialize(msgBuffer);
-    return msg;
+    return msg.release();
 } /* end of M_Factory::receive */ 
 
 } // end of namespace certi 
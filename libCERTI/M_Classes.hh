@@ -1,4 +1,4 @@
-// Generated on 2018 April Fri, 13 at 11:41:23 by the CERTI message generator
+// Generated on 2026 October Sun, 18 at 09:22:38 by the CERTI message generator
 #ifndef M_CLASSES_HH
 #define M_CLASSES_HH
 // ****-**** Global System includes ****-****
@@ -83,6 +83,36 @@ protected:
 
 std::ostream& operator<<(std::ostream& os, const EventRetraction& msg);
 
+// A name of the federation object model, sent to the federate
+// at join so that it resolves names and handles locally.
+class CERTI_EXPORT FomName {
+public:
+    FomName() = default;
+    ~FomName() = default;
+    
+    void serialize(libhla::MessageBuffer& msgBuffer);
+    void deserialize(libhla::MessageBuffer& msgBuffer);
+
+    // Attributes accessors and mutators
+    const Handle& getOwner() const;
+    void setOwner(const Handle& newOwner);
+    
+    const Handle& getHandle() const;
+    void setHandle(const Handle& newHandle);
+    
+    const std::string& getName() const;
+    void setName(const std::string& newName);
+    
+    friend std::ostream& operator<<(std::ostream& os, const FomName& msg);
+
+protected:
+    Handle owner {0};// class of an attribute or a parameter, 0 for a class
+    Handle handle {0};
+    std::string name;
+};
+
+std::ostream& operator<<(std::ostream& os, const FomName& msg);
+
 // Connexion initialization message
 class CERTI_EXPORT M_Open_Connexion : public Message {
 public:
@@ -276,6 +306,38 @@ public:
     void setAdditionalFomModules(const std::string& newAdditionalFomModules, uint32_t rank);
     void removeAdditionalFomModules(uint32_t rank);
     
+    uint32_t getObjectClassNamesSize() const;
+    void setObjectClassNamesSize(uint32_t num);
+    const std::vector<FomName>& getObjectClassNames() const;
+    const FomName& getObjectClassNames(uint32_t rank) const;
+    FomName& getObjectClassNames(uint32_t rank);
+    void setObjectClassNames(const FomName& newObjectClassNames, uint32_t rank);
+    void removeObjectClassNames(uint32_t rank);
+    
+    uint32_t getAttributeNamesSize() const;
+    void setAttributeNamesSize(uint32_t num);
+    const std::vector<FomName>& getAttributeNames() const;
+    const FomName& getAttributeNames(uint32_t rank) const;
+    FomName& getAttributeNames(uint32_t rank);
+    void setAttributeNames(const FomName& newAttributeNames, uint32_t rank);
+    void removeAttributeNames(uint32_t rank);
+    
+    uint32_t getInteractionClassNamesSize() const;
+    void setInteractionClassNamesSize(uint32_t num);
+    const std::vector<FomName>& getInteractionClassNames() const;
+    const FomName& getInteractionClassNames(uint32_t rank) const;
+    FomName& getInteractionClassNames(uint32_t rank);
+    void setInteractionClassNames(const FomName& newInteractionClassNames, uint32_t rank);
+    void removeInteractionClassNames(uint32_t rank);
+    
+    uint32_t getParameterNamesSize() const;
+    void setParameterNamesSize(uint32_t num);
+    const std::vector<FomName>& getParameterNames() const;
+    const FomName& getParameterNames(uint32_t rank) const;
+    FomName& getParameterNames(uint32_t rank);
+    void setParameterNames(const FomName& newParameterNames, uint32_t rank);
+    void removeParameterNames(uint32_t rank);
+    
     using Super = Message;
     friend std::ostream& operator<<(std::ostream& os, const M_Join_Federation_Execution_V4& msg);
 
@@ -287,6 +349,10 @@ protected:
     RtiVersion rtiVersion;
     std::string federationExecutionName;
     std::vector<std::string> additionalFomModules;
+    std::vector<FomName> objectClassNames;// in the answer only
+    std::vector<FomName> attributeNames;
+    std::vector<FomName> interactionClassNames;
+    std::vector<FomName> parameterNames;
 };
 
 std::ostream& operator<<(std::ostream& os, const M_Join_Federation_Execution_V4& msg);
@@ -885,6 +951,8 @@ public:
     AttributeValue_t& getValues(uint32_t rank);
     void setValues(const AttributeValue_t& newValues, uint32_t rank);
     void removeValues(uint32_t rank);
+    /// Serialize the value of rank from bytes of the caller, which must outlive the serialization.
+    void setValuesView(const void* data, uint32_t size, uint32_t rank);
     
     const EventRetraction& getEventRetraction() const;
     void setEventRetraction(const EventRetraction& newEventRetraction);
@@ -898,6 +966,7 @@ protected:
     ObjectHandle object;
     std::vector<AttributeHandle> attributes;
     std::vector<AttributeValue_t> values;
+    std::vector<ValueView> _valuesViews;
     EventRetraction eventRetraction;
     bool _hasEventRetraction {false};
 };
@@ -971,6 +1040,8 @@ public:
     AttributeValue_t& getValues(uint32_t rank);
     void setValues(const AttributeValue_t& newValues, uint32_t rank);
     void removeValues(uint32_t rank);
+    /// Serialize the value of rank from bytes of the caller, which must outlive the serialization.
+    void setValuesView(const void* data, uint32_t size, uint32_t rank);
     
     const EventRetraction& getEventRetraction() const;
     void setEventRetraction(const EventRetraction& newEventRetraction);
@@ -984,6 +1055,7 @@ protected:
     ObjectHandle object;
     std::vector<AttributeHandle> attributes;
     std::vector<AttributeValue_t> values;
+    std::vector<ValueView> _valuesViews;
     EventRetraction eventRetraction;
     bool _hasEventRetraction {false};
 };
@@ -1018,6 +1090,8 @@ public:
     ParameterValue_t& getValues(uint32_t rank);
     void setValues(const ParameterValue_t& newValues, uint32_t rank);
     void removeValues(uint32_t rank);
+    /// Serialize the value of rank from bytes of the caller, which must outlive the serialization.
+    void setValuesView(const void* data, uint32_t size, uint32_t rank);
     
     const RegionHandle& getRegion() const;
     void setRegion(const RegionHandle& newRegion);
@@ -1033,6 +1107,7 @@ protected:
     InteractionClassHandle interactionClass;
     std::vector<ParameterHandle> parameters;
     std::vector<ParameterValue_t> values;
+    std::vector<ValueView> _valuesViews;
     RegionHandle region;
     EventRetraction eventRetraction;
     bool _hasEventRetraction {false};
@@ -1068,6 +1143,8 @@ public:
     ParameterValue_t& getValues(uint32_t rank);
     void setValues(const ParameterValue_t& newValues, uint32_t rank);
     void removeValues(uint32_t rank);
+    /// Serialize the value of rank from bytes of the caller, which must outlive the serialization.
+    void setValuesView(const void* data, uint32_t size, uint32_t rank);
     
     const RegionHandle& getRegion() const;
     void setRegion(const RegionHandle& newRegion);
@@ -1083,6 +1160,7 @@ protected:
     InteractionClassHandle interactionClass;
     std::vector<ParameterHandle> parameters;
     std::vector<ParameterValue_t> values;
+    std::vector<ValueView> _valuesViews;
     RegionHandle region;
     EventRetraction eventRetraction;
     bool _hasEventRetraction {false};
@@ -3330,7 +3408,9 @@ public:
     
 };
 
-
+// batchCount is the number of callbacks the RTIA may send at once, each batch being
+// followed by M_Tick_Request_Next when more of them are pending, 0 to send them one by one.
+// batchBytes bounds the size of a batch, 0 for no bound.
 class CERTI_EXPORT M_Tick_Request : public Message {
 public:
     M_Tick_Request();
@@ -3349,6 +3429,12 @@ public:
     const double& getMaxTickTime() const;
     void setMaxTickTime(const double& newMaxTickTime);
     
+    const uint32_t& getBatchCount() const;
+    void setBatchCount(const uint32_t& newBatchCount);
+    
+    const uint32_t& getBatchBytes() const;
+    void setBatchBytes(const uint32_t& newBatchBytes);
+    
     using Super = Message;
     friend std::ostream& operator<<(std::ostream& os, const M_Tick_Request& msg);
 
@@ -3356,6 +3442,8 @@ protected:
     bool multiple;
     double minTickTime;
     double maxTickTime;
+    uint32_t batchCount {0};
+    uint32_t batchBytes {0};
 };
 
 std::ostream& operator<<(std::ostream& os, const M_Tick_Request& msg);
@@ -3414,11 +3502,43 @@ public:
     
 };
 
+// CERTI extension: oldest failure of a pipelined update or interaction (CERTI_PIPELINED_UPDATES)
+// sequence is 0 if no failure is pending, failure holds its Exception::Type.
+class CERTI_EXPORT M_Query_Pipelined_Failure : public Message {
+public:
+    M_Query_Pipelined_Failure();
+    virtual ~M_Query_Pipelined_Failure() = default;
+    
+    virtual void serialize(libhla::MessageBuffer& msgBuffer);
+    virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+
+    // Attributes accessors and mutators
+    const uint32_t& getSequence() const;
+    void setSequence(const uint32_t& newSequence);
+    
+    const uint32_t& getFailure() const;
+    void setFailure(const uint32_t& newFailure);
+    
+    const std::string& getFailureReason() const;
+    void setFailureReason(const std::string& newFailureReason);
+    
+    using Super = Message;
+    friend std::ostream& operator<<(std::ostream& os, const M_Query_Pipelined_Failure& msg);
+
+protected:
+    uint32_t sequence {0};
+    uint32_t failure {0};
+    std::string failureReason;
+};
+
+std::ostream& operator<<(std::ostream& os, const M_Query_Pipelined_Failure& msg);
+
 
 class CERTI_EXPORT M_Factory {
     public:
         static Message* create(M_Type type) throw (NetworkError ,NetworkSignal); 
         static Message* receive(MStreamType stream) throw (NetworkError ,NetworkSignal); 
+        static Message* receive(MStreamType stream, libhla::MessageBuffer& msgBuffer) throw (NetworkError ,NetworkSignal); 
     protected:
     private:
 };
@@ -204,6 +204,7 @@ public:
         RESERVE_OBJECT_INSTANCE_NAME, // HLA1516
         RESERVE_OBJECT_INSTANCE_NAME_SUCCEEDED, // HLA1516
         RESERVE_OBJECT_INSTANCE_NAME_FAILED, // HLA1516
+        QUERY_PIPELINED_FAILURE, // CERTI extension
         
         CREATE_FEDERATION_EXECUTION_V4, // CERTI V4 C++
         JOIN_FEDERATION_EXECUTION_V4, // CERTI V4 C++
@@ -265,6 +266,19 @@ public:
 	 */
     void receive(SocketUN* socket, MessageBuffer& msgBuffer);
 
+    /**
+	 * Receive the bytes of the next message from a socket, without decoding them.
+	 * @param[in] socket the socket used to received the message from
+	 * @param[out] msgBuffer the buffer were the read message will be written
+	 */
+    static void receiveBytes(SocketUN* socket, MessageBuffer& msgBuffer);
+
+    /**
+	 * Type of the message received in the buffer, which is left ready to be deserialized.
+	 * @throw NetworkError if the buffer does not hold a valid type
+	 */
+    static Type peekType(MessageBuffer& msgBuffer);
+
     void setException(const Exception::Type, const std::string& the_reason = "");
     Exception::Type getExceptionType() const
     {
@@ -44,11 +44,16 @@ public:
         : my_sockets(sockets), my_message(std::forward<decltype(my_message)>(message))
     {
     }
+    /// A message received through the given transport, BEST_EFFORT for a datagram.
+    MessageEvent(Socket* socket, std::unique_ptr<NM>&& message, const TransportType transport)
+        : my_sockets({socket}), my_message(std::forward<decltype(my_message)>(message)), my_transport(transport)
+    {
+    }
 
     MessageEvent(const MessageEvent<NM>& other) = delete;
     MessageEvent& operator=(const MessageEvent<NM>& rhs) = delete;
 
-    MessageEvent(MessageEvent<NM>&& other) : my_sockets{other.my_sockets}
+    MessageEvent(MessageEvent<NM>&& other) : my_sockets{other.my_sockets}, my_transport{other.my_transport}
     {
         my_message.swap(other.my_message);
     }
@@ -57,6 +62,7 @@ public:
     {
         my_sockets = other.my_sockets;
         my_message.swap(other.my_message);
+        my_transport = other.my_transport;
         return *this;
     }
 
@@ -64,7 +70,8 @@ public:
     friend class MessageEvent;
 
     template <typename Base>
-    explicit MessageEvent(MessageEvent<Base>&& other) : my_message{static_cast<NM*>(other.my_message.release())}
+    explicit MessageEvent(MessageEvent<Base>&& other)
+        : my_message{static_cast<NM*>(other.my_message.release())}, my_transport{other.my_transport}
     {
         my_sockets = other.my_sockets;
     }
@@ -91,9 +98,15 @@ public:
         return my_message.get();
     }
 
+    inline TransportType transport() const
+    {
+        return my_transport;
+    }
+
 private:
     std::vector<Socket*> my_sockets;
     std::unique_ptr<NM> my_message;
+    TransportType my_transport{RELIABLE};
 };
 
 using Responses = std::vector<MessageEvent<NetworkMessage>>;
@@ -0,0 +1,204 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_MESSAGE_POOL_HH
+#define CERTI_MESSAGE_POOL_HH
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace certi {
+
+/**
+ * Per thread free lists for the messages of type T, which are created and
+ * destroyed at a high rate.
+ *
+ * The memory of a destroyed message is kept for the next one, and so is the
+ * capacity of its vectors: a message takes the vectors kept when it is
+ * constructed and gives them back when it is destroyed. The generator of the
+ * message classes uses it for the messages declared "pooled".
+ *
+ * A message may be destroyed by another thread than the one which created it,
+ * its memory then goes to the free list of the destroying thread. Each list
+ * keeps at most the_capacity entries, and byte buffers larger than
+ * the_max_kept_bytes are released.
+ */
+template <typename T>
+class MessagePool {
+public:
+    static void* allocate(const std::size_t size)
+    {
+        auto* blocks = Spares<void*>::get();
+        if (size == sizeof(T) && blocks && !blocks->empty()) {
+            auto* block = blocks->back();
+            blocks->pop_back();
+            return block;
+        }
+        return ::operator new(size);
+    }
+
+    static void release(void* block, const std::size_t size)
+    {
+        auto* blocks = Spares<void*>::get();
+        if (size == sizeof(T) && blocks && blocks->size() < the_capacity) {
+            blocks->push_back(block);
+            return;
+        }
+        ::operator delete(block);
+    }
+
+    /// Give an empty vector the capacity of one kept.
+    template <typename V>
+    static void take(std::vector<V>& values)
+    {
+        auto* spares = Spares<std::vector<V>>::get();
+        if (spares && !spares->empty()) {
+            values.swap(spares->back());
+            spares->pop_back();
+        }
+    }
+
+    /// Keep the capacity of a vector, which is left empty.
+    template <typename V>
+    static void keep(std::vector<V>& values)
+    {
+        values.clear();
+        keepCleared(values);
+    }
+
+    /// Keep the byte buffers of the values too.
+    template <typename V>
+    static void keep(std::vector<std::vector<V>>& values)
+    {
+        for (auto& value : values) {
+            if (value.capacity() * sizeof(V) <= the_max_kept_bytes) {
+                keep(value);
+            }
+        }
+        values.clear();
+        keepCleared(values);
+    }
+
+    /// Resize a vector of values, the values added take the byte buffers kept.
+    template <typename V>
+    static void resize(std::vector<V>& values, const std::size_t size)
+    {
+        values.resize(size);
+    }
+
+    template <typename V>
+    static void resize(std::vector<std::vector<V>>& values, const std::size_t size)
+    {
+        auto index = values.size();
+        values.resize(size);
+        for (; index < size; ++index) {
+            take(values[index]);
+        }
+    }
+
+    /// Copy values, reusing the buffers of the destination and the ones kept.
+    template <typename V>
+    static void assign(std::vector<V>& values, const std::vector<V>& other)
+    {
+        values = other;
+    }
+
+    template <typename V>
+    static void assign(std::vector<std::vector<V>>& values, const std::vector<std::vector<V>>& other)
+    {
+        if (&values == &other) {
+            return;
+        }
+        while (values.size() > other.size()) {
+            keep(values.back());
+            values.pop_back();
+        }
+        resize(values, other.size());
+        for (std::size_t index = 0; index < other.size(); ++index) {
+            values[index] = other[index];
+        }
+    }
+
+    static constexpr std::size_t the_capacity{256};
+    static constexpr std::size_t the_max_kept_bytes{64 * 1024};
+
+private:
+    template <typename V>
+    static void keepCleared(std::vector<V>& values)
+    {
+        auto* spares = Spares<std::vector<V>>::get();
+        if (values.capacity() > 0 && spares && spares->size() < the_capacity) {
+            spares->push_back(std::move(values));
+        }
+    }
+
+    /// Entries kept by the calling thread, none once the thread is exiting.
+    template <typename E>
+    class Spares {
+    public:
+        static std::vector<E>* get()
+        {
+            static thread_local bool the_destroyed{false};
+            if (the_destroyed) {
+                return nullptr;
+            }
+
+            struct Holder {
+                Holder()
+                {
+                    entries.reserve(the_capacity);
+                }
+
+                ~Holder()
+                {
+                    releaseAll(entries);
+                    the_destroyed = true;
+                }
+
+                std::vector<E> entries;
+            };
+            static thread_local Holder the_holder;
+            return &the_holder.entries;
+        }
+    };
+
+    template <typename E>
+    static void releaseAll(std::vector<E>&)
+    {
+    }
+
+    static void releaseAll(std::vector<void*>& blocks)
+    {
+        for (auto* block : blocks) {
+            ::operator delete(block);
+        }
+    }
+};
+
+template <typename T>
+constexpr std::size_t MessagePool<T>::the_capacity;
+
+template <typename T>
+constexpr std::size_t MessagePool<T>::the_max_kept_bytes;
+
+} // namespace certi
+
+#endif // CERTI_MESSAGE_POOL_HH
@@ -22,6 +22,7 @@
 #include "Message.hh"
 #include <cassert>
 #include <iostream>
+#include <string>
 
 namespace certi {
 
@@ -199,6 +200,7 @@ std::string Message::to_string(const Message::Type& msg_type)
         CASE(Message::RESERVE_OBJECT_INSTANCE_NAME)
         CASE(Message::RESERVE_OBJECT_INSTANCE_NAME_SUCCEEDED)
         CASE(Message::RESERVE_OBJECT_INSTANCE_NAME_FAILED)
+        CASE(Message::QUERY_PIPELINED_FAILURE)
         CASE(Message::CREATE_FEDERATION_EXECUTION_V4)
         CASE(Message::JOIN_FEDERATION_EXECUTION_V4)
     //         CASE(Message::LAST)
@@ -274,6 +276,17 @@ void Message::send(SocketUN* socket, MessageBuffer& msgBuffer)
 void Message::receive(SocketUN* socket, MessageBuffer& msgBuffer)
 {
     Debug(G, pdGendoc) << "enter Message::receive" << std::endl;
+    receiveBytes(socket, msgBuffer);
+    /* 4- deserialize the message
+	 * This is a polymorphic call
+	 * which may specialized in a daughter class
+	 */
+    deserialize(msgBuffer);
+    Debug(G, pdGendoc) << "exit  Message::receive" << std::endl;
+} /* end of receive */
+
+void Message::receiveBytes(SocketUN* socket, MessageBuffer& msgBuffer)
+{
     /* 0- Reset receive buffer */
     /* FIXME this reset may not be necessary since we do
 	 * raw-receive + assume-size
@@ -290,13 +303,18 @@ void Message::receive(SocketUN* socket, MessageBuffer& msgBuffer)
     /* 3- receive the rest of the message */
     socket->receive(static_cast<const unsigned char*>(msgBuffer(msgBuffer.reservedBytes)),
                     msgBuffer.size() - msgBuffer.reservedBytes);
-    /* 4- deserialize the message
-	 * This is a polymorphic call
-	 * which may specialized in a daughter class
-	 */
-    deserialize(msgBuffer);
-    Debug(G, pdGendoc) << "exit  Message::receive" << std::endl;
-} /* end of receive */
+} /* end of receiveBytes */
+
+Message::Type Message::peekType(MessageBuffer& msgBuffer)
+{
+    /* the type comes first, see serialize */
+    const auto type = msgBuffer.read_int32();
+    msgBuffer.seek_read(msgBuffer.reservedBytes);
+    if (type <= NOT_USED || type >= LAST) {
+        throw NetworkError("Invalid message type <" + std::to_string(type) + ">");
+    }
+    return static_cast<Type>(type);
+} /* end of peekType */
 
 /*
 void
@@ -1,7 +1,9 @@
-// Generated on 2018 April Fri, 13 at 11:41:23 by the CERTI message generator
+// Generated on 2026 October Sun, 18 at 09:00:29 by the CERTI message generator
+#include <memory>
 #include <string>
 #include <vector>
 #include "NM_Classes.hh"
+#include "MessagePool.hh"
 // ----------------------------------------------------------------------------
 // CERTI - HLA RunTime Infrastructure
 // Copyright (C) 2002-2008  ONERA
@@ -557,6 +559,91 @@ std::ostream& operator<<(std::ostream& os, const NM_FOM_Interaction_Class& msg)
     return os;
 }
 
+void NM_Time_State::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Specific serialization code
+    msgBuffer.write_double(time);
+    msgBuffer.write_double(lookahead);
+    msgBuffer.write_bool(state);
+    msgBuffer.write_double(galt);
+    msgBuffer.write_double(lits);
+}
+
+void NM_Time_State::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Specific deserialization code
+    time = msgBuffer.read_double();
+    lookahead = msgBuffer.read_double();
+    state = msgBuffer.read_bool();
+    galt = msgBuffer.read_double();
+    lits = msgBuffer.read_double();
+}
+
+const double& NM_Time_State::getTime() const
+{
+    return time;
+}
+
+void NM_Time_State::setTime(const double& newTime)
+{
+    time = newTime;
+}
+
+const double& NM_Time_State::getLookahead() const
+{
+    return lookahead;
+}
+
+void NM_Time_State::setLookahead(const double& newLookahead)
+{
+    lookahead = newLookahead;
+}
+
+const bool& NM_Time_State::getState() const
+{
+    return state;
+}
+
+void NM_Time_State::setState(const bool& newState)
+{
+    state = newState;
+}
+
+const double& NM_Time_State::getGalt() const
+{
+    return galt;
+}
+
+void NM_Time_State::setGalt(const double& newGalt)
+{
+    galt = newGalt;
+}
+
+const double& NM_Time_State::getLits() const
+{
+    return lits;
+}
+
+void NM_Time_State::setLits(const double& newLits)
+{
+    lits = newLits;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Time_State& msg)
+{
+    os << "[NM_Time_State - Begin]" << std::endl;
+    
+    // Specific display
+    os << "  time = " << msg.time << std::endl;
+    os << "  lookahead = " << msg.lookahead << std::endl;
+    os << "  state = " << msg.state << std::endl;
+    os << "  galt = " << msg.galt << std::endl;
+    os << "  lits = " << msg.lits << std::endl;
+    
+    os << "[NM_Time_State - End]" << std::endl;
+    return os;
+}
+
 NM_Close_Connexion::NM_Close_Connexion()
 {
     this->messageName = "NM_Close_Connexion";
@@ -569,6 +656,67 @@ NM_Message_Null::NM_Message_Null()
     this->type = NetworkMessage::Type::MESSAGE_NULL;
 }
 
+void* NM_Message_Null::operator new(std::size_t size)
+{
+    return MessagePool<NM_Message_Null>::allocate(size);
+}
+
+void NM_Message_Null::operator delete(void* block, std::size_t size)
+{
+    MessagePool<NM_Message_Null>::release(block, size);
+}
+
+void NM_Message_Null::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_bool(_hasTimeState);
+    if (_hasTimeState) {
+        timeState.serialize(msgBuffer);
+    }
+}
+
+void NM_Message_Null::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    _hasTimeState = msgBuffer.read_bool();
+    if (_hasTimeState) {
+        timeState.deserialize(msgBuffer);
+    }
+}
+
+const NM_Time_State& NM_Message_Null::getTimeState() const
+{
+    return timeState;
+}
+
+void NM_Message_Null::setTimeState(const NM_Time_State& newTimeState)
+{
+    _hasTimeState = true;
+    timeState = newTimeState;
+}
+
+bool NM_Message_Null::hasTimeState() const
+{
+    return _hasTimeState;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Message_Null& msg)
+{
+    os << "[NM_Message_Null - Begin]" << std::endl;
+    
+    os << static_cast<const NM_Message_Null::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  (opt) timeState =" << msg.timeState << std::endl;
+    
+    os << "[NM_Message_Null - End]" << std::endl;
+    return os;
+}
+
 NM_Create_Federation_Execution::NM_Create_Federation_Execution()
 {
     this->messageName = "NM_Create_Federation_Execution";
@@ -2296,6 +2444,45 @@ NM_Update_Attribute_Values::NM_Update_Attribute_Values()
 {
     this->messageName = "NM_Update_Attribute_Values";
     this->type = NetworkMessage::Type::UPDATE_ATTRIBUTE_VALUES;
+    MessagePool<NM_Update_Attribute_Values>::take(attributes);
+    MessagePool<NM_Update_Attribute_Values>::take(values);
+    MessagePool<NM_Update_Attribute_Values>::take(_valuesViews);
+}
+
+NM_Update_Attribute_Values::NM_Update_Attribute_Values(const NM_Update_Attribute_Values& other) : NM_Update_Attribute_Values()
+{
+    *this = other;
+}
+
+NM_Update_Attribute_Values& NM_Update_Attribute_Values::operator=(const NM_Update_Attribute_Values& other)
+{
+    Super::operator=(other);
+    object = other.object;
+    MessagePool<NM_Update_Attribute_Values>::assign(attributes, other.attributes);
+    MessagePool<NM_Update_Attribute_Values>::assign(values, other.values);
+    _valuesViews = other._valuesViews;
+    event = other.event;
+    _hasEvent = other._hasEvent;
+    sequence = other.sequence;
+    _hasSequence = other._hasSequence;
+    return *this;
+}
+
+NM_Update_Attribute_Values::~NM_Update_Attribute_Values()
+{
+    MessagePool<NM_Update_Attribute_Values>::keep(attributes);
+    MessagePool<NM_Update_Attribute_Values>::keep(values);
+    MessagePool<NM_Update_Attribute_Values>::keep(_valuesViews);
+}
+
+void* NM_Update_Attribute_Values::operator new(std::size_t size)
+{
+    return MessagePool<NM_Update_Attribute_Values>::allocate(size);
+}
+
+void NM_Update_Attribute_Values::operator delete(void* block, std::size_t size)
+{
+    MessagePool<NM_Update_Attribute_Values>::release(block, size);
 }
 
 void NM_Update_Attribute_Values::serialize(libhla::MessageBuffer& msgBuffer)
@@ -2313,12 +2500,21 @@ void NM_Update_Attribute_Values::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //serialize native whose representation is 'repeated' byte 
+        if (i < _valuesViews.size() && _valuesViews[i].data) {
+            msgBuffer.write_uint32(_valuesViews[i].size);
+            msgBuffer.write_bytes(_valuesViews[i].data, _valuesViews[i].size);
+            continue;
+        }
         msgBuffer.write_uint32(values[i].size());
         msgBuffer.write_bytes(&(values[i][0]),values[i].size());
     }
     msgBuffer.write_bool(_hasEvent);
     if (_hasEvent) {
             }
+    msgBuffer.write_bool(_hasSequence);
+    if (_hasSequence) {
+        msgBuffer.write_uint32(sequence);
+    }
 }
 
 void NM_Update_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -2328,12 +2524,13 @@ void NM_Update_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
     // Specific deserialization code
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
-    attributes.resize(attributesSize);
+    MessagePool<NM_Update_Attribute_Values>::resize(attributes, attributesSize);
     for (uint32_t i = 0; i < attributesSize; ++i) {
         attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
     }
     uint32_t valuesSize = msgBuffer.read_uint32();
-    values.resize(valuesSize);
+    MessagePool<NM_Update_Attribute_Values>::resize(values, valuesSize);
+    _valuesViews.clear();
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //deserialize native whose representation is 'repeated' byte 
         values[i].resize(msgBuffer.read_uint32());
@@ -2342,6 +2539,10 @@ void NM_Update_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
     _hasEvent = msgBuffer.read_bool();
     if (_hasEvent) {
             }
+    _hasSequence = msgBuffer.read_bool();
+    if (_hasSequence) {
+        sequence = msgBuffer.read_uint32();
+    }
 }
 
 const ObjectHandle& NM_Update_Attribute_Values::getObject() const
@@ -2361,7 +2562,7 @@ uint32_t NM_Update_Attribute_Values::getAttributesSize() const
 
 void NM_Update_Attribute_Values::setAttributesSize(uint32_t num)
 {
-    attributes.resize(num);
+    MessagePool<NM_Update_Attribute_Values>::resize(attributes, num);
 }
 
 const std::vector<AttributeHandle>& NM_Update_Attribute_Values::getAttributes() const
@@ -2396,7 +2597,7 @@ uint32_t NM_Update_Attribute_Values::getValuesSize() const
 
 void NM_Update_Attribute_Values::setValuesSize(uint32_t num)
 {
-    values.resize(num);
+    MessagePool<NM_Update_Attribute_Values>::resize(values, num);
 }
 
 const std::vector<AttributeValue_t>& NM_Update_Attribute_Values::getValues() const
@@ -2417,11 +2618,27 @@ AttributeValue_t& NM_Update_Attribute_Values::getValues(uint32_t rank)
 void NM_Update_Attribute_Values::setValues(const AttributeValue_t& newValues, uint32_t rank)
 {
     values[rank] = newValues;
+    if (rank < _valuesViews.size()) {
+        _valuesViews[rank] = ValueView();
+    }
 }
 
 void NM_Update_Attribute_Values::removeValues(uint32_t rank)
 {
     values.erase(values.begin() + rank);
+    if (rank < _valuesViews.size()) {
+        _valuesViews.erase(_valuesViews.begin() + rank);
+    }
+}
+
+void NM_Update_Attribute_Values::setValuesView(const void* data, uint32_t size, uint32_t rank)
+{
+    // Views are only allocated by the messages using them
+    if (_valuesViews.size() < values.size()) {
+        _valuesViews.resize(values.size());
+    }
+    values[rank].clear();
+    _valuesViews[rank] = ValueView(data, size);
 }
 
 const EventRetractionHandle& NM_Update_Attribute_Values::getEvent() const
@@ -2440,6 +2657,22 @@ bool NM_Update_Attribute_Values::hasEvent() const
     return _hasEvent;
 }
 
+const uint32_t& NM_Update_Attribute_Values::getSequence() const
+{
+    return sequence;
+}
+
+void NM_Update_Attribute_Values::setSequence(const uint32_t& newSequence)
+{
+    _hasSequence = true;
+    sequence = newSequence;
+}
+
+bool NM_Update_Attribute_Values::hasSequence() const
+{
+    return _hasSequence;
+}
+
 std::ostream& operator<<(std::ostream& os, const NM_Update_Attribute_Values& msg)
 {
     os << "[NM_Update_Attribute_Values - Begin]" << std::endl;
@@ -2460,6 +2693,7 @@ std::ostream& operator<<(std::ostream& os, const NM_Update_Attribute_Values& msg
     }
     os << std::endl;
     os << "  (opt) event =" << "// TODO field <event> of type <EventRetractionHandle>" << std::endl;
+    os << "  (opt) sequence =" << msg.sequence << std::endl;
     
     os << "[NM_Update_Attribute_Values - End]" << std::endl;
     return os;
@@ -2469,6 +2703,43 @@ NM_Reflect_Attribute_Values::NM_Reflect_Attribute_Values()
 {
     this->messageName = "NM_Reflect_Attribute_Values";
     this->type = NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES;
+    MessagePool<NM_Reflect_Attribute_Values>::take(attributes);
+    MessagePool<NM_Reflect_Attribute_Values>::take(values);
+    MessagePool<NM_Reflect_Attribute_Values>::take(_valuesViews);
+}
+
+NM_Reflect_Attribute_Values::NM_Reflect_Attribute_Values(const NM_Reflect_Attribute_Values& other) : NM_Reflect_Attribute_Values()
+{
+    *this = other;
+}
+
+NM_Reflect_Attribute_Values& NM_Reflect_Attribute_Values::operator=(const NM_Reflect_Attribute_Values& other)
+{
+    Super::operator=(other);
+    object = other.object;
+    MessagePool<NM_Reflect_Attribute_Values>::assign(attributes, other.attributes);
+    MessagePool<NM_Reflect_Attribute_Values>::assign(values, other.values);
+    _valuesViews = other._valuesViews;
+    event = other.event;
+    _hasEvent = other._hasEvent;
+    return *this;
+}
+
+NM_Reflect_Attribute_Values::~NM_Reflect_Attribute_Values()
+{
+    MessagePool<NM_Reflect_Attribute_Values>::keep(attributes);
+    MessagePool<NM_Reflect_Attribute_Values>::keep(values);
+    MessagePool<NM_Reflect_Attribute_Values>::keep(_valuesViews);
+}
+
+void* NM_Reflect_Attribute_Values::operator new(std::size_t size)
+{
+    return MessagePool<NM_Reflect_Attribute_Values>::allocate(size);
+}
+
+void NM_Reflect_Attribute_Values::operator delete(void* block, std::size_t size)
+{
+    MessagePool<NM_Reflect_Attribute_Values>::release(block, size);
 }
 
 void NM_Reflect_Attribute_Values::serialize(libhla::MessageBuffer& msgBuffer)
@@ -2486,6 +2757,11 @@ void NM_Reflect_Attribute_Values::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //serialize native whose representation is 'repeated' byte 
+        if (i < _valuesViews.size() && _valuesViews[i].data) {
+            msgBuffer.write_uint32(_valuesViews[i].size);
+            msgBuffer.write_bytes(_valuesViews[i].data, _valuesViews[i].size);
+            continue;
+        }
         msgBuffer.write_uint32(values[i].size());
         msgBuffer.write_bytes(&(values[i][0]),values[i].size());
     }
@@ -2501,12 +2777,13 @@ void NM_Reflect_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
     // Specific deserialization code
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
-    attributes.resize(attributesSize);
+    MessagePool<NM_Reflect_Attribute_Values>::resize(attributes, attributesSize);
     for (uint32_t i = 0; i < attributesSize; ++i) {
         attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
     }
     uint32_t valuesSize = msgBuffer.read_uint32();
-    values.resize(valuesSize);
+    MessagePool<NM_Reflect_Attribute_Values>::resize(values, valuesSize);
+    _valuesViews.clear();
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //deserialize native whose representation is 'repeated' byte 
         values[i].resize(msgBuffer.read_uint32());
@@ -2534,7 +2811,7 @@ uint32_t NM_Reflect_Attribute_Values::getAttributesSize() const
 
 void NM_Reflect_Attribute_Values::setAttributesSize(uint32_t num)
 {
-    attributes.resize(num);
+    MessagePool<NM_Reflect_Attribute_Values>::resize(attributes, num);
 }
 
 const std::vector<AttributeHandle>& NM_Reflect_Attribute_Values::getAttributes() const
@@ -2569,7 +2846,7 @@ uint32_t NM_Reflect_Attribute_Values::getValuesSize() const
 
 void NM_Reflect_Attribute_Values::setValuesSize(uint32_t num)
 {
-    values.resize(num);
+    MessagePool<NM_Reflect_Attribute_Values>::resize(values, num);
 }
 
 const std::vector<AttributeValue_t>& NM_Reflect_Attribute_Values::getValues() const
@@ -2590,11 +2867,27 @@ AttributeValue_t& NM_Reflect_Attribute_Values::getValues(uint32_t rank)
 void NM_Reflect_Attribute_Values::setValues(const AttributeValue_t& newValues, uint32_t rank)
 {
     values[rank] = newValues;
+    if (rank < _valuesViews.size()) {
+        _valuesViews[rank] = ValueView();
+    }
 }
 
 void NM_Reflect_Attribute_Values::removeValues(uint32_t rank)
 {
     values.erase(values.begin() + rank);
+    if (rank < _valuesViews.size()) {
+        _valuesViews.erase(_valuesViews.begin() + rank);
+    }
+}
+
+void NM_Reflect_Attribute_Values::setValuesView(const void* data, uint32_t size, uint32_t rank)
+{
+    // Views are only allocated by the messages using them
+    if (_valuesViews.size() < values.size()) {
+        _valuesViews.resize(values.size());
+    }
+    values[rank].clear();
+    _valuesViews[rank] = ValueView(data, size);
 }
 
 const EventRetractionHandle& NM_Reflect_Attribute_Values::getEvent() const
@@ -2642,6 +2935,44 @@ NM_Send_Interaction::NM_Send_Interaction()
 {
     this->messageName = "NM_Send_Interaction";
     this->type = NetworkMessage::Type::SEND_INTERACTION;
+    MessagePool<NM_Send_Interaction>::take(parameters);
+    MessagePool<NM_Send_Interaction>::take(values);
+    MessagePool<NM_Send_Interaction>::take(_valuesViews);
+}
+
+NM_Send_Interaction::NM_Send_Interaction(const NM_Send_Interaction& other) : NM_Send_Interaction()
+{
+    *this = other;
+}
+
+NM_Send_Interaction& NM_Send_Interaction::operator=(const NM_Send_Interaction& other)
+{
+    Super::operator=(other);
+    interactionClass = other.interactionClass;
+    MessagePool<NM_Send_Interaction>::assign(parameters, other.parameters);
+    MessagePool<NM_Send_Interaction>::assign(values, other.values);
+    _valuesViews = other._valuesViews;
+    region = other.region;
+    sequence = other.sequence;
+    _hasSequence = other._hasSequence;
+    return *this;
+}
+
+NM_Send_Interaction::~NM_Send_Interaction()
+{
+    MessagePool<NM_Send_Interaction>::keep(parameters);
+    MessagePool<NM_Send_Interaction>::keep(values);
+    MessagePool<NM_Send_Interaction>::keep(_valuesViews);
+}
+
+void* NM_Send_Interaction::operator new(std::size_t size)
+{
+    return MessagePool<NM_Send_Interaction>::allocate(size);
+}
+
+void NM_Send_Interaction::operator delete(void* block, std::size_t size)
+{
+    MessagePool<NM_Send_Interaction>::release(block, size);
 }
 
 void NM_Send_Interaction::serialize(libhla::MessageBuffer& msgBuffer)
@@ -2659,10 +2990,19 @@ void NM_Send_Interaction::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //serialize native whose representation is 'repeated' byte 
+        if (i < _valuesViews.size() && _valuesViews[i].data) {
+            msgBuffer.write_uint32(_valuesViews[i].size);
+            msgBuffer.write_bytes(_valuesViews[i].data, _valuesViews[i].size);
+            continue;
+        }
         msgBuffer.write_uint32(values[i].size());
         msgBuffer.write_bytes(&(values[i][0]),values[i].size());
     }
     msgBuffer.write_uint32(region);
+    msgBuffer.write_bool(_hasSequence);
+    if (_hasSequence) {
+        msgBuffer.write_uint32(sequence);
+    }
 }
 
 void NM_Send_Interaction::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -2672,18 +3012,23 @@ void NM_Send_Interaction::deserialize(libhla::MessageBuffer& msgBuffer)
     // Specific deserialization code
     interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
     uint32_t parametersSize = msgBuffer.read_uint32();
-    parameters.resize(parametersSize);
+    MessagePool<NM_Send_Interaction>::resize(parameters, parametersSize);
     for (uint32_t i = 0; i < parametersSize; ++i) {
         parameters[i] = static_cast<ParameterHandle>(msgBuffer.read_uint32());
     }
     uint32_t valuesSize = msgBuffer.read_uint32();
-    values.resize(valuesSize);
+    MessagePool<NM_Send_Interaction>::resize(values, valuesSize);
+    _valuesViews.clear();
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //deserialize native whose representation is 'repeated' byte 
         values[i].resize(msgBuffer.read_uint32());
         msgBuffer.read_bytes(&(values[i][0]),values[i].size());
     }
     region = static_cast<RegionHandle>(msgBuffer.read_uint32());
+    _hasSequence = msgBuffer.read_bool();
+    if (_hasSequence) {
+        sequence = msgBuffer.read_uint32();
+    }
 }
 
 const InteractionClassHandle& NM_Send_Interaction::getInteractionClass() const
@@ -2703,7 +3048,7 @@ uint32_t NM_Send_Interaction::getParametersSize() const
 
 void NM_Send_Interaction::setParametersSize(uint32_t num)
 {
-    parameters.resize(num);
+    MessagePool<NM_Send_Interaction>::resize(parameters, num);
 }
 
 const std::vector<ParameterHandle>& NM_Send_Interaction::getParameters() const
@@ -2738,7 +3083,7 @@ uint32_t NM_Send_Interaction::getValuesSize() const
 
 void NM_Send_Interaction::setValuesSize(uint32_t num)
 {
-    values.resize(num);
+    MessagePool<NM_Send_Interaction>::resize(values, num);
 }
 
 const std::vector<ParameterValue_t>& NM_Send_Interaction::getValues() const
@@ -2759,11 +3104,27 @@ ParameterValue_t& NM_Send_Interaction::getValues(uint32_t rank)
 void NM_Send_Interaction::setValues(const ParameterValue_t& newValues, uint32_t rank)
 {
     values[rank] = newValues;
+    if (rank < _valuesViews.size()) {
+        _valuesViews[rank] = ValueView();
+    }
 }
 
 void NM_Send_Interaction::removeValues(uint32_t rank)
 {
     values.erase(values.begin() + rank);
+    if (rank < _valuesViews.size()) {
+        _valuesViews.erase(_valuesViews.begin() + rank);
+    }
+}
+
+void NM_Send_Interaction::setValuesView(const void* data, uint32_t size, uint32_t rank)
+{
+    // Views are only allocated by the messages using them
+    if (_valuesViews.size() < values.size()) {
+        _valuesViews.resize(values.size());
+    }
+    values[rank].clear();
+    _valuesViews[rank] = ValueView(data, size);
 }
 
 const RegionHandle& NM_Send_Interaction::getRegion() const
@@ -2776,6 +3137,22 @@ void NM_Send_Interaction::setRegion(const RegionHandle& newRegion)
     region = newRegion;
 }
 
+const uint32_t& NM_Send_Interaction::getSequence() const
+{
+    return sequence;
+}
+
+void NM_Send_Interaction::setSequence(const uint32_t& newSequence)
+{
+    _hasSequence = true;
+    sequence = newSequence;
+}
+
+bool NM_Send_Interaction::hasSequence() const
+{
+    return _hasSequence;
+}
+
 std::ostream& operator<<(std::ostream& os, const NM_Send_Interaction& msg)
 {
     os << "[NM_Send_Interaction - Begin]" << std::endl;
@@ -2796,6 +3173,7 @@ std::ostream& operator<<(std::ostream& os, const NM_Send_Interaction& msg)
     }
     os << std::endl;
     os << "  region = " << msg.region << std::endl;
+    os << "  (opt) sequence =" << msg.sequence << std::endl;
     
     os << "[NM_Send_Interaction - End]" << std::endl;
     return os;
@@ -2805,6 +3183,43 @@ NM_Receive_Interaction::NM_Receive_Interaction()
 {
     this->messageName = "NM_Receive_Interaction";
     this->type = NetworkMessage::Type::RECEIVE_INTERACTION;
+    MessagePool<NM_Receive_Interaction>::take(parameters);
+    MessagePool<NM_Receive_Interaction>::take(values);
+    MessagePool<NM_Receive_Interaction>::take(_valuesViews);
+}
+
+NM_Receive_Interaction::NM_Receive_Interaction(const NM_Receive_Interaction& other) : NM_Receive_Interaction()
+{
+    *this = other;
+}
+
+NM_Receive_Interaction& NM_Receive_Interaction::operator=(const NM_Receive_Interaction& other)
+{
+    Super::operator=(other);
+    interactionClass = other.interactionClass;
+    MessagePool<NM_Receive_Interaction>::assign(parameters, other.parameters);
+    MessagePool<NM_Receive_Interaction>::assign(values, other.values);
+    _valuesViews = other._valuesViews;
+    event = other.event;
+    _hasEvent = other._hasEvent;
+    return *this;
+}
+
+NM_Receive_Interaction::~NM_Receive_Interaction()
+{
+    MessagePool<NM_Receive_Interaction>::keep(parameters);
+    MessagePool<NM_Receive_Interaction>::keep(values);
+    MessagePool<NM_Receive_Interaction>::keep(_valuesViews);
+}
+
+void* NM_Receive_Interaction::operator new(std::size_t size)
+{
+    return MessagePool<NM_Receive_Interaction>::allocate(size);
+}
+
+void NM_Receive_Interaction::operator delete(void* block, std::size_t size)
+{
+    MessagePool<NM_Receive_Interaction>::release(block, size);
 }
 
 void NM_Receive_Interaction::serialize(libhla::MessageBuffer& msgBuffer)
@@ -2822,6 +3237,11 @@ void NM_Receive_Interaction::serialize(libhla::MessageBuffer& msgBuffer)
     msgBuffer.write_uint32(valuesSize);
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //serialize native whose representation is 'repeated' byte 
+        if (i < _valuesViews.size() && _valuesViews[i].data) {
+            msgBuffer.write_uint32(_valuesViews[i].size);
+            msgBuffer.write_bytes(_valuesViews[i].data, _valuesViews[i].size);
+            continue;
+        }
         msgBuffer.write_uint32(values[i].size());
         msgBuffer.write_bytes(&(values[i][0]),values[i].size());
     }
@@ -2837,12 +3257,13 @@ void NM_Receive_Interaction::deserialize(libhla::MessageBuffer& msgBuffer)
     // Specific deserialization code
     interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
     uint32_t parametersSize = msgBuffer.read_uint32();
-    parameters.resize(parametersSize);
+    MessagePool<NM_Receive_Interaction>::resize(parameters, parametersSize);
     for (uint32_t i = 0; i < parametersSize; ++i) {
         parameters[i] = static_cast<ParameterHandle>(msgBuffer.read_uint32());
     }
     uint32_t valuesSize = msgBuffer.read_uint32();
-    values.resize(valuesSize);
+    MessagePool<NM_Receive_Interaction>::resize(values, valuesSize);
+    _valuesViews.clear();
     for (uint32_t i = 0; i < valuesSize; ++i) {
         //deserialize native whose representation is 'repeated' byte 
         values[i].resize(msgBuffer.read_uint32());
@@ -2870,7 +3291,7 @@ uint32_t NM_Receive_Interaction::getParametersSize() const
 
 void NM_Receive_Interaction::setParametersSize(uint32_t num)
 {
-    parameters.resize(num);
+    MessagePool<NM_Receive_Interaction>::resize(parameters, num);
 }
 
 const std::vector<ParameterHandle>& NM_Receive_Interaction::getParameters() const
@@ -2905,7 +3326,7 @@ uint32_t NM_Receive_Interaction::getValuesSize() const
 
 void NM_Receive_Interaction::setValuesSize(uint32_t num)
 {
-    values.resize(num);
+    MessagePool<NM_Receive_Interaction>::resize(values, num);
 }
 
 const std::vector<ParameterValue_t>& NM_Receive_Interaction::getValues() const
@@ -2926,11 +3347,27 @@ ParameterValue_t& NM_Receive_Interaction::getValues(uint32_t rank)
 void NM_Receive_Interaction::setValues(const ParameterValue_t& newValues, uint32_t rank)
 {
     values[rank] = newValues;
+    if (rank < _valuesViews.size()) {
+        _valuesViews[rank] = ValueView();
+    }
 }
 
 void NM_Receive_Interaction::removeValues(uint32_t rank)
 {
     values.erase(values.begin() + rank);
+    if (rank < _valuesViews.size()) {
+        _valuesViews.erase(_valuesViews.begin() + rank);
+    }
+}
+
+void NM_Receive_Interaction::setValuesView(const void* data, uint32_t size, uint32_t rank)
+{
+    // Views are only allocated by the messages using them
+    if (_valuesViews.size() < values.size()) {
+        _valuesViews.resize(values.size());
+    }
+    values[rank].clear();
+    _valuesViews[rank] = ValueView(data, size);
 }
 
 const EventRetractionHandle& NM_Receive_Interaction::getEvent() const
@@ -5364,10 +5801,7 @@ void NM_Time_State_Update::serialize(libhla::MessageBuffer& msgBuffer)
     // Call parent class
     Super::serialize(msgBuffer);
     // Specific serialization code
-    msgBuffer.write_double(lookahead);
-    msgBuffer.write_bool(state);
-    msgBuffer.write_double(galt);
-    msgBuffer.write_double(lits);
+    timeState.serialize(msgBuffer);
 }
 
 void NM_Time_State_Update::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -5375,50 +5809,17 @@ void NM_Time_State_Update::deserialize(libhla::MessageBuffer& msgBuffer)
     // Call parent class
     Super::deserialize(msgBuffer);
     // Specific deserialization code
-    lookahead = msgBuffer.read_double();
-    state = msgBuffer.read_bool();
-    galt = msgBuffer.read_double();
-    lits = msgBuffer.read_double();
-}
-
-const double& NM_Time_State_Update::getLookahead() const
-{
-    return lookahead;
-}
-
-void NM_Time_State_Update::setLookahead(const double& newLookahead)
-{
-    lookahead = newLookahead;
-}
-
-const bool& NM_Time_State_Update::getState() const
-{
-    return state;
-}
-
-void NM_Time_State_Update::setState(const bool& newState)
-{
-    state = newState;
-}
-
-const double& NM_Time_State_Update::getGalt() const
-{
-    return galt;
-}
-
-void NM_Time_State_Update::setGalt(const double& newGalt)
-{
-    galt = newGalt;
+    timeState.deserialize(msgBuffer);
 }
 
-const double& NM_Time_State_Update::getLits() const
+const NM_Time_State& NM_Time_State_Update::getTimeState() const
 {
-    return lits;
+    return timeState;
 }
 
-void NM_Time_State_Update::setLits(const double& newLits)
+void NM_Time_State_Update::setTimeState(const NM_Time_State& newTimeState)
 {
-    lits = newLits;
+    timeState = newTimeState;
 }
 
 std::ostream& operator<<(std::ostream& os, const NM_Time_State_Update& msg)
@@ -5428,10 +5829,7 @@ std::ostream& operator<<(std::ostream& os, const NM_Time_State_Update& msg)
     os << static_cast<const NM_Time_State_Update::Super&>(msg); // show parent class
     
     // Specific display
-    os << "  lookahead = " << msg.lookahead << std::endl;
-    os << "  state = " << msg.state << std::endl;
-    os << "  galt = " << msg.galt << std::endl;
-    os << "  lits = " << msg.lits << std::endl;
+    os << "  timeState = " << msg.timeState << std::endl;
     
     os << "[NM_Time_State_Update - End]" << std::endl;
     return os;
@@ -5873,18 +6271,17 @@ NetworkMessage* NM_Factory::create(NM_Type type) throw (NetworkError ,NetworkSig
 } /* end of NM_Factory::create */
 
 NetworkMessage* NM_Factory::receive(NMStreamType stream) throw (NetworkError ,NetworkSignal) { 
-    // FIXME This is not thread safe
-    static libhla::MessageBuffer msgBuffer;
-    NetworkMessage  msgGen;
-    NetworkMessage* msg;
-
-    // receive generic message 
-    msgGen.receive(stream,msgBuffer);
-    // create specific message from type 
-    msg = NM_Factory::create(msgGen.getMessageType());
-    msgBuffer.assumeSizeFromReservedBytes();
+    // One buffer per thread, the RTIA may run in the federate process
+    static thread_local libhla::MessageBuffer msgBuffer;
+    return NM_Factory::receive(stream, msgBuffer);
+} /* end of NM_Factory::receive */ 
+
+NetworkMessage* NM_Factory::receive(NMStreamType stream, libhla::MessageBuffer& msgBuffer) throw (NetworkError ,NetworkSignal) { 
+    // receive the message, then decode it once its type is known 
+    NetworkMessage::receiveBytes(stream, msgBuffer);
+    std::unique_ptr<NetworkMessage> msg(NM_Factory::create(NetworkMessage::peekType(msgBuffer)));
     msg->deserialize(msgBuffer);
-    return msg;
+    return msg.release();
 } /* end of NM_Factory::receive */ 
 
 } // end of namespace certi 
@@ -1,7 +1,8 @@
-// Generated on 2018 April Fri, 13 at 11:41:23 by the CERTI message generator
+// Generated on 2026 October Sun, 18 at 09:00:29 by the CERTI message generator
 #ifndef NM_CLASSES_HH
 #define NM_CLASSES_HH
 // ****-**** Global System includes ****-****
+#include <cstddef>
 #include <string>
 #include <vector>
 // ****-**** Includes coming from native types ****-****
@@ -268,6 +269,43 @@ protected:
 
 std::ostream& operator<<(std::ostream& os, const NM_FOM_Interaction_Class& msg);
 
+// Time state of a federate reported to the MOM
+class CERTI_EXPORT NM_Time_State {
+public:
+    NM_Time_State() = default;
+    ~NM_Time_State() = default;
+    
+    void serialize(libhla::MessageBuffer& msgBuffer);
+    void deserialize(libhla::MessageBuffer& msgBuffer);
+
+    // Attributes accessors and mutators
+    const double& getTime() const;
+    void setTime(const double& newTime);
+    
+    const double& getLookahead() const;
+    void setLookahead(const double& newLookahead);
+    
+    const bool& getState() const;
+    void setState(const bool& newState);
+    
+    const double& getGalt() const;
+    void setGalt(const double& newGalt);
+    
+    const double& getLits() const;
+    void setLits(const double& newLits);
+    
+    friend std::ostream& operator<<(std::ostream& os, const NM_Time_State& msg);
+
+protected:
+    double time {0};
+    double lookahead {0};
+    bool state {false};
+    double galt {0};
+    double lits {0};
+};
+
+std::ostream& operator<<(std::ostream& os, const NM_Time_State& msg);
+
 
 class CERTI_EXPORT NM_Close_Connexion : public NetworkMessage {
 public:
@@ -276,14 +314,34 @@ public:
     
 };
 
-
+// The messages exchanged at a high rate are pooled, see MessagePool.hh
 class CERTI_EXPORT NM_Message_Null : public NetworkMessage {
 public:
     NM_Message_Null();
     virtual ~NM_Message_Null() = default;
     
+    /// The memory of a destroyed message is reused by the next one, see MessagePool.
+    static void* operator new(std::size_t size);
+    static void operator delete(void* block, std::size_t size);
+    
+    virtual void serialize(libhla::MessageBuffer& msgBuffer);
+    virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+
+    // Attributes accessors and mutators
+    const NM_Time_State& getTimeState() const;
+    void setTimeState(const NM_Time_State& newTimeState);
+    bool hasTimeState() const;
+    
+    using Super = NetworkMessage;
+    friend std::ostream& operator<<(std::ostream& os, const NM_Message_Null& msg);
+
+protected:
+    NM_Time_State timeState;// set when the time state changed since it was last reported
+    bool _hasTimeState {false};
 };
 
+std::ostream& operator<<(std::ostream& os, const NM_Message_Null& msg);
+
 // Create the federation execution
 class CERTI_EXPORT NM_Create_Federation_Execution : public NetworkMessage {
 public:
@@ -1056,7 +1114,15 @@ std::ostream& operator<<(std::ostream& os, const NM_Discover_Object& msg);
 class CERTI_EXPORT NM_Update_Attribute_Values : public NetworkMessage {
 public:
     NM_Update_Attribute_Values();
-    virtual ~NM_Update_Attribute_Values() = default;
+    NM_Update_Attribute_Values(const NM_Update_Attribute_Values& other);
+    NM_Update_Attribute_Values(NM_Update_Attribute_Values&& other) = default;
+    NM_Update_Attribute_Values& operator=(const NM_Update_Attribute_Values& other);
+    NM_Update_Attribute_Values& operator=(NM_Update_Attribute_Values&& other) = default;
+    virtual ~NM_Update_Attribute_Values();
+    
+    /// The memory of a destroyed message is reused by the next one, see MessagePool.
+    static void* operator new(std::size_t size);
+    static void operator delete(void* block, std::size_t size);
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
@@ -1080,11 +1146,17 @@ public:
     AttributeValue_t& getValues(uint32_t rank);
     void setValues(const AttributeValue_t& newValues, uint32_t rank);
     void removeValues(uint32_t rank);
+    /// Serialize the value of rank from bytes of the caller, which must outlive the serialization.
+    void setValuesView(const void* data, uint32_t size, uint32_t rank);
     
     const EventRetractionHandle& getEvent() const;
     void setEvent(const EventRetractionHandle& newEvent);
     bool hasEvent() const;
     
+    const uint32_t& getSequence() const;
+    void setSequence(const uint32_t& newSequence);
+    bool hasSequence() const;
+    
     using Super = NetworkMessage;
     friend std::ostream& operator<<(std::ostream& os, const NM_Update_Attribute_Values& msg);
 
@@ -1092,8 +1164,11 @@ protected:
     ObjectHandle object;
     std::vector<AttributeHandle> attributes;
     std::vector<AttributeValue_t> values;
+    std::vector<ValueView> _valuesViews;
     EventRetractionHandle event;
     bool _hasEvent {false};
+    uint32_t sequence;// set by a pipelining RTIA, only failures are answered
+    bool _hasSequence {false};
 };
 
 std::ostream& operator<<(std::ostream& os, const NM_Update_Attribute_Values& msg);
@@ -1102,7 +1177,15 @@ std::ostream& operator<<(std::ostream& os, const NM_Update_Attribute_Values& msg
 class CERTI_EXPORT NM_Reflect_Attribute_Values : public NetworkMessage {
 public:
     NM_Reflect_Attribute_Values();
-    virtual ~NM_Reflect_Attribute_Values() = default;
+    NM_Reflect_Attribute_Values(const NM_Reflect_Attribute_Values& other);
+    NM_Reflect_Attribute_Values(NM_Reflect_Attribute_Values&& other) = default;
+    NM_Reflect_Attribute_Values& operator=(const NM_Reflect_Attribute_Values& other);
+    NM_Reflect_Attribute_Values& operator=(NM_Reflect_Attribute_Values&& other) = default;
+    virtual ~NM_Reflect_Attribute_Values();
+    
+    /// The memory of a destroyed message is reused by the next one, see MessagePool.
+    static void* operator new(std::size_t size);
+    static void operator delete(void* block, std::size_t size);
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
@@ -1126,6 +1209,8 @@ public:
     AttributeValue_t& getValues(uint32_t rank);
     void setValues(const AttributeValue_t& newValues, uint32_t rank);
     void removeValues(uint32_t rank);
+    /// Serialize the value of rank from bytes of the caller, which must outlive the serialization.
+    void setValuesView(const void* data, uint32_t size, uint32_t rank);
     
     const EventRetractionHandle& getEvent() const;
     void setEvent(const EventRetractionHandle& newEvent);
@@ -1138,6 +1223,7 @@ protected:
     ObjectHandle object;
     std::vector<AttributeHandle> attributes;
     std::vector<AttributeValue_t> values;
+    std::vector<ValueView> _valuesViews;
     EventRetractionHandle event;
     bool _hasEvent {false};
 };
@@ -1148,7 +1234,15 @@ std::ostream& operator<<(std::ostream& os, const NM_Reflect_Attribute_Values& ms
 class CERTI_EXPORT NM_Send_Interaction : public NetworkMessage {
 public:
     NM_Send_Interaction();
-    virtual ~NM_Send_Interaction() = default;
+    NM_Send_Interaction(const NM_Send_Interaction& other);
+    NM_Send_Interaction(NM_Send_Interaction&& other) = default;
+    NM_Send_Interaction& operator=(const NM_Send_Interaction& other);
+    NM_Send_Interaction& operator=(NM_Send_Interaction&& other) = default;
+    virtual ~NM_Send_Interaction();
+    
+    /// The memory of a destroyed message is reused by the next one, see MessagePool.
+    static void* operator new(std::size_t size);
+    static void operator delete(void* block, std::size_t size);
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
@@ -1172,10 +1266,16 @@ public:
     ParameterValue_t& getValues(uint32_t rank);
     void setValues(const ParameterValue_t& newValues, uint32_t rank);
     void removeValues(uint32_t rank);
+    /// Serialize the value of rank from bytes of the caller, which must outlive the serialization.
+    void setValuesView(const void* data, uint32_t size, uint32_t rank);
     
     const RegionHandle& getRegion() const;
     void setRegion(const RegionHandle& newRegion);
     
+    const uint32_t& getSequence() const;
+    void setSequence(const uint32_t& newSequence);
+    bool hasSequence() const;
+    
     using Super = NetworkMessage;
     friend std::ostream& operator<<(std::ostream& os, const NM_Send_Interaction& msg);
 
@@ -1183,7 +1283,10 @@ protected:
     InteractionClassHandle interactionClass;
     std::vector<ParameterHandle> parameters;
     std::vector<ParameterValue_t> values;
+    std::vector<ValueView> _valuesViews;
     RegionHandle region;// FIXME check this....
+    uint32_t sequence;// set by a pipelining RTIA, only failures are answered
+    bool _hasSequence {false};
 };
 
 std::ostream& operator<<(std::ostream& os, const NM_Send_Interaction& msg);
@@ -1192,7 +1295,15 @@ std::ostream& operator<<(std::ostream& os, const NM_Send_Interaction& msg);
 class CERTI_EXPORT NM_Receive_Interaction : public NetworkMessage {
 public:
     NM_Receive_Interaction();
-    virtual ~NM_Receive_Interaction() = default;
+    NM_Receive_Interaction(const NM_Receive_Interaction& other);
+    NM_Receive_Interaction(NM_Receive_Interaction&& other) = default;
+    NM_Receive_Interaction& operator=(const NM_Receive_Interaction& other);
+    NM_Receive_Interaction& operator=(NM_Receive_Interaction&& other) = default;
+    virtual ~NM_Receive_Interaction();
+    
+    /// The memory of a destroyed message is reused by the next one, see MessagePool.
+    static void* operator new(std::size_t size);
+    static void operator delete(void* block, std::size_t size);
     
     virtual void serialize(libhla::MessageBuffer& msgBuffer);
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
@@ -1216,6 +1327,8 @@ public:
     ParameterValue_t& getValues(uint32_t rank);
     void setValues(const ParameterValue_t& newValues, uint32_t rank);
     void removeValues(uint32_t rank);
+    /// Serialize the value of rank from bytes of the caller, which must outlive the serialization.
+    void setValuesView(const void* data, uint32_t size, uint32_t rank);
     
     const EventRetractionHandle& getEvent() const;
     void setEvent(const EventRetractionHandle& newEvent);
@@ -1228,6 +1341,7 @@ protected:
     InteractionClassHandle interactionClass;
     std::vector<ParameterHandle> parameters;
     std::vector<ParameterValue_t> values;
+    std::vector<ValueView> _valuesViews;
     EventRetractionHandle event;
     bool _hasEvent {false};
 };
@@ -2248,7 +2362,7 @@ protected:
 
 std::ostream& operator<<(std::ostream& os, const NM_Mom_Status& msg);
 
-
+// Sent when no NULL message carried a changed time state within the MOM report period
 class CERTI_EXPORT NM_Time_State_Update : public NetworkMessage {
 public:
     NM_Time_State_Update();
@@ -2258,26 +2372,14 @@ public:
     virtual void deserialize(libhla::MessageBuffer& msgBuffer);
 
     // Attributes accessors and mutators
-    const double& getLookahead() const;
-    void setLookahead(const double& newLookahead);
-    
-    const bool& getState() const;
-    void setState(const bool& newState);
-    
-    const double& getGalt() const;
-    void setGalt(const double& newGalt);
-    
-    const double& getLits() const;
-    void setLits(const double& newLits);
+    const NM_Time_State& getTimeState() const;
+    void setTimeState(const NM_Time_State& newTimeState);
     
     using Super = NetworkMessage;
     friend std::ostream& operator<<(std::ostream& os, const NM_Time_State_Update& msg);
 
 protected:
-    double lookahead;
-    bool state;
-    double galt;
-    double lits;
+    NM_Time_State timeState;
 };
 
 std::ostream& operator<<(std::ostream& os, const NM_Time_State_Update& msg);
@@ -2326,6 +2428,7 @@ class CERTI_EXPORT NM_Factory {
     public:
         static NetworkMessage* create(NM_Type type) throw (NetworkError ,NetworkSignal); 
         static NetworkMessage* receive(NMStreamType stream) throw (NetworkError ,NetworkSignal); 
+        static NetworkMessage* receive(NMStreamType stream, libhla::MessageBuffer& msgBuffer) throw (NetworkError ,NetworkSignal); 
     protected:
     private:
 };
@@ -41,6 +41,8 @@
 
 namespace certi {
 
+class SocketUDP;
+
 /**
  * NetworkMessage is the base class used
  * for modeling message exchanged between RTIG and RTIA.
@@ -223,6 +225,24 @@ public:
 	 */
     virtual void deserialize(MessageBuffer& msgBuffer);
 
+    /**
+     * True for messages a slow federate can do without, i.e. receive order
+     * reflections and interactions of best effort traffic, which the RTIG may
+     * drop like a datagram.
+     */
+    bool isDroppable();
+
+    /// True if the message carries best effort traffic, false by default.
+    bool isBestEffort() const
+    {
+        return bestEffort;
+    };
+
+    void setBestEffort(const bool bestEffort)
+    {
+        this->bestEffort = bestEffort;
+    };
+
     /**
      * Send a message buffer to the socket
      */
@@ -238,6 +258,24 @@ public:
 	 */
     void receive(Socket* socket, MessageBuffer& msgBuffer);
 
+    /**
+     * Receive the bytes of the next message from the socket, without decoding them.
+     */
+    static void receiveBytes(Socket* socket, MessageBuffer& msgBuffer);
+
+    /**
+     * Type of the message received in the buffer, which is left ready to be deserialized.
+     * @throw NetworkError if the buffer does not hold a valid type
+     */
+    static Type peekType(MessageBuffer& msgBuffer);
+
+    /**
+     * Receive the message held by the next datagram of the socket.
+     * A datagram holds exactly one message, which must fit in it.
+     * @return the new message, nullptr if the datagram was not valid and was dropped
+     */
+    static NetworkMessage* receiveDatagram(SocketUDP* socket, MessageBuffer& msgBuffer);
+
     EventRetractionHandle eventRetraction; /* FIXME to be suppressed */
 
     Handle getFederation() const
@@ -302,6 +340,11 @@ protected:
 	 */
     FederateHandle federate;
 
+    /**
+	 * The message carries best effort traffic, it is not serialized.
+	 */
+    bool bestEffort{false};
+
 private:
 };
 
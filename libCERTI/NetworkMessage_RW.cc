@@ -18,8 +18,14 @@
 //
 // ----------------------------------------------------------------------------
 
+#include "NM_Classes.hh"
 #include "NetworkMessage.hh"
 #include "PrettyDebug.hh"
+#include "SocketUDP.hh"
+
+#include <memory>
+#include <new>
+#include <stdexcept>
 
 using std::vector;
 using std::endl;
@@ -75,6 +81,11 @@ void NetworkMessage::deserialize(MessageBuffer& msgBuffer)
     Debug(G, pdGendoc) << "exit NetworkMessage::deserialize" << std::endl;
 } /* end of deserialize */
 
+bool NetworkMessage::isDroppable()
+{
+    return bestEffort && (type == Type::REFLECT_ATTRIBUTE_VALUES || type == Type::RECEIVE_INTERACTION) && !isDated();
+}
+
 void NetworkMessage::send(Socket* socket, MessageBuffer& msgBuffer)
 {
     Debug(G, pdGendoc) << "enter NetworkMessage::send" << std::endl;
@@ -93,7 +104,12 @@ void NetworkMessage::send(Socket* socket, MessageBuffer& msgBuffer)
     /* 3- effectively send the raw message to socket */
 
     if (NULL != socket) { // send only if socket is unequal to null
-        socket->send(static_cast<unsigned char*>(msgBuffer(0)), msgBuffer.size());
+        if (isDroppable()) {
+            socket->sendDroppable(static_cast<unsigned char*>(msgBuffer(0)), msgBuffer.size());
+        }
+        else {
+            socket->send(static_cast<unsigned char*>(msgBuffer(0)), msgBuffer.size());
+        }
     }
     else { // socket pointer was null - not sending
         Debug(D, pdDebug) << "Not sending -- socket is deleted." << std::endl;
@@ -118,9 +134,15 @@ void NetworkMessage::send(std::vector<Socket*> sockets, MessageBuffer& msgBuffer
     //msgBuffer.show(msgBuf(0),5);
     /* 3- effectively send the raw message to socket */
 
+    const bool droppable = isDroppable();
     for (const auto& socket : sockets) {
         if (socket) { // send only if socket is unequal to null
-            socket->send(static_cast<unsigned char*>(msgBuffer(0)), msgBuffer.size());
+            if (droppable) {
+                socket->sendDroppable(static_cast<unsigned char*>(msgBuffer(0)), msgBuffer.size());
+            }
+            else {
+                socket->send(static_cast<unsigned char*>(msgBuffer(0)), msgBuffer.size());
+            }
         }
     }
     Debug(G, pdGendoc) << "exit  NetworkMessage::send" << std::endl;
@@ -129,6 +151,17 @@ void NetworkMessage::send(std::vector<Socket*> sockets, MessageBuffer& msgBuffer
 void NetworkMessage::receive(Socket* socket, MessageBuffer& msgBuffer)
 {
     Debug(G, pdGendoc) << "enter NetworkMessage::receive" << std::endl;
+    receiveBytes(socket, msgBuffer);
+    /* 4- deserialize the message
+	 * This is a polymorphic call
+	 * which may specialized in a daughter class
+	 */
+    deserialize(msgBuffer);
+    Debug(G, pdGendoc) << "exit  NetworkMessage::receive" << std::endl;
+} /* end of receive */
+
+void NetworkMessage::receiveBytes(Socket* socket, MessageBuffer& msgBuffer)
+{
     /* 0- Reset receive buffer */
     /* FIXME this reset may not be necessary since we do
 	 * raw-receive + assume-size
@@ -144,12 +177,72 @@ void NetworkMessage::receive(Socket* socket, MessageBuffer& msgBuffer)
                       << " reserved)" << std::endl;
     /* 3- receive the rest of the message */
     socket->receive(msgBuffer(msgBuffer.reservedBytes), msgBuffer.size() - msgBuffer.reservedBytes);
-    /* 4- deserialize the message
-	 * This is a polymorphic call
-	 * which may specialized in a daughter class
-	 */
-    deserialize(msgBuffer);
-    Debug(G, pdGendoc) << "exit  NetworkMessage::receive" << std::endl;
-} /* end of receive */
+} /* end of receiveBytes */
+
+NetworkMessage::Type NetworkMessage::peekType(MessageBuffer& msgBuffer)
+{
+    /* the type comes first, see serialize */
+    const auto type = msgBuffer.read_int32();
+    msgBuffer.seek_read(msgBuffer.reservedBytes);
+    if (type <= static_cast<int32_t>(Type::NOT_USED) || type >= static_cast<int32_t>(Type::LAST)) {
+        throw NetworkError("Invalid message type <" + std::to_string(type) + ">");
+    }
+    return static_cast<Type>(type);
+} /* end of peekType */
+
+NetworkMessage* NetworkMessage::receiveDatagram(SocketUDP* socket, MessageBuffer& msgBuffer)
+{
+    // The garbage a datagram may hold is only found while reading it
+    try {
+        receiveBytes(socket, msgBuffer);
+        const auto type = peekType(msgBuffer);
+
+        // Only the messages which may be lost travel as datagrams
+        std::unique_ptr<NetworkMessage> msg;
+        switch (type) {
+        case Type::UPDATE_ATTRIBUTE_VALUES:
+            msg.reset(new NM_Update_Attribute_Values());
+            break;
+        case Type::REFLECT_ATTRIBUTE_VALUES:
+            msg.reset(new NM_Reflect_Attribute_Values());
+            break;
+        case Type::SEND_INTERACTION:
+            msg.reset(new NM_Send_Interaction());
+            break;
+        case Type::RECEIVE_INTERACTION:
+            msg.reset(new NM_Receive_Interaction());
+            break;
+        default:
+            throw NetworkError("Unexpected message type <"
+                               + std::to_string(static_cast<std::underlying_type<Type>::type>(type))
+                               + "> in datagram");
+        }
+        msg->deserialize(msgBuffer);
+
+        const auto left = socket->dropDatagram();
+        if (left == 0) {
+            return msg.release();
+        }
+        Debug(D, pdExcept) << "Dropped datagram holding " << left << " bytes after <" << msg->getMessageName() << ">"
+                           << std::endl;
+    }
+    catch (NetworkError& e) {
+        Debug(D, pdExcept) << "Dropped datagram: " << e.reason() << std::endl;
+    }
+    catch (Exception& e) {
+        Debug(D, pdExcept) << "Dropped datagram: " << e.name() << " - " << e.reason() << std::endl;
+    }
+    catch (libhla::Exception& e) {
+        Debug(D, pdExcept) << "Dropped datagram: " << e.name() << " - " << e.reason() << std::endl;
+    }
+    catch (std::bad_alloc&) {
+        Debug(D, pdExcept) << "Dropped datagram with invalid sizes" << std::endl;
+    }
+    catch (std::length_error&) {
+        Debug(D, pdExcept) << "Dropped datagram with invalid sizes" << std::endl;
+    }
+    socket->dropDatagram();
+    return nullptr;
+}
 
 } // namespace certi
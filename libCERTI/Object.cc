@@ -25,6 +25,7 @@
 #include "ObjectAttribute.hh"
 #include "RTIRegion.hh"
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
@@ -43,11 +44,6 @@ Object::Object(FederateHandle the_owner) : Owner(the_owner)
 //! Destructor.
 Object::~Object()
 {
-    // We should delete the pointee because it belongs to the object.
-    AttributeMap::const_iterator i;
-    for (i = _attributeMap.begin(); i != _attributeMap.end(); ++i) {
-        delete i->second;
-    }
 }
 
 // ----------------------------------------------------------------------------
@@ -63,32 +59,52 @@ void Object::display() const
         cout << ", (No name)." << endl;
     }
 
-    cout << " Attributes: " << _attributeMap.size() << endl;
-    for (const auto& pair : _attributeMap) {
-        cout << "Attribute #" << pair.first << endl;
-        pair.second->display();
+    cout << " Attributes: " << _attributes.size() << endl;
+    for (const auto& attribute : _attributes) {
+        cout << "Attribute #" << attribute.getHandle() << endl;
+        attribute.display();
     }
 }
 
 // ----------------------------------------------------------------------------
-void Object::addAttribute(ObjectAttribute* new_attribute)
+void Object::reserveAttributes(std::size_t the_count)
 {
-    AttributeHandle attributeHandle = new_attribute->getHandle();
-    if (_attributeMap.find(attributeHandle) != _attributeMap.end())
+    _attributes.reserve(the_count);
+}
+
+// ----------------------------------------------------------------------------
+void Object::addAttribute(const ObjectAttribute& new_attribute)
+{
+    AttributeHandle attributeHandle = new_attribute.getHandle();
+    auto it = std::lower_bound(
+        _attributes.begin(), _attributes.end(), attributeHandle, [](const ObjectAttribute& a, AttributeHandle h) {
+            return a.getHandle() < h;
+        });
+    if (it != _attributes.end() && it->getHandle() == attributeHandle)
         throw RTIinternalError("Attribute already defined");
-    _attributeMap[attributeHandle] = new_attribute;
+    _attributes.insert(it, new_attribute);
 }
 
 // ----------------------------------------------------------------------------
 //! getAttribute.
 ObjectAttribute* Object::getAttribute(AttributeHandle attributeHandle) const
 {
-    AttributeMap::const_iterator i = _attributeMap.find(attributeHandle);
-    if (i == _attributeMap.end()) {
+    // Handles of the attributes of a class usually are 1 to n
+    if (attributeHandle > 0 && attributeHandle <= _attributes.size()
+        && _attributes[attributeHandle - 1].getHandle() == attributeHandle) {
+        return const_cast<ObjectAttribute*>(&_attributes[attributeHandle - 1]);
+    }
+
+    auto it = std::lower_bound(
+        _attributes.begin(), _attributes.end(), attributeHandle, [](const ObjectAttribute& a, AttributeHandle h) {
+            return a.getHandle() < h;
+        });
+    if (it == _attributes.end() || it->getHandle() != attributeHandle) {
         throw AttributeNotDefined(
             "Object::getAttribute(AttributeHandle) Unknown attribute handle <" + std::to_string(attributeHandle) + ">");
     }
-    return i->second;
+    // The attributes belong to the object, as they did when they were allocated apart
+    return const_cast<ObjectAttribute*>(&*it);
 }
 
 // ----------------------------------------------------------------------------
@@ -114,9 +130,8 @@ bool Object::isAttributeOwnedByFederate(FederateHandle the_federate, AttributeHa
 //! Unassociate attributes from this region
 void Object::unassociate(RTIRegion* region)
 {
-    AttributeMap::const_iterator i;
-    for (i = _attributeMap.begin(); i != _attributeMap.end(); ++i) {
-        i->second->unassociate(region);
+    for (auto& attribute : _attributes) {
+        attribute.unassociate(region);
     }
 }
 
@@ -124,10 +139,9 @@ void Object::unassociate(RTIRegion* region)
 //! Remove references for killed federate from all attributes in object
 void Object::killFederate(FederateHandle the_federate)
 {
-    AttributeMap::const_iterator i;
-    for (i = _attributeMap.begin(); i != _attributeMap.end(); ++i) {
-        if (i->second->getOwner() == the_federate)
-            i->second->setOwner(0);
+    for (auto& attribute : _attributes) {
+        if (attribute.getOwner() == the_federate)
+            attribute.setOwner(0);
     }
 }
 
@@ -27,16 +27,16 @@
 
 // forward declaration
 namespace certi {
-class ObjectAttribute;
 class RTIRegion;
 }
 
 #include "Exception.hh"
 #include "Handled.hh"
 #include "Named.hh"
+#include "ObjectAttribute.hh"
 #include <include/certi.hh>
 
-#include <map>
+#include <vector>
 
 namespace certi {
 
@@ -47,7 +47,12 @@ public:
 
     void display() const;
 
-    void addAttribute(ObjectAttribute* new_attribute);
+    /** Reserve room for the attributes of the class, so that adding them does not move
+     * the ones already added.
+     */
+    void reserveAttributes(std::size_t the_count);
+
+    void addAttribute(const ObjectAttribute& new_attribute);
     ObjectAttribute* getAttribute(AttributeHandle the_attribute) const;
 
     bool isAttributeOwnedByFederate(FederateHandle, AttributeHandle) const;
@@ -68,15 +73,22 @@ public:
 
     void killFederate(FederateHandle);
 
+    //! The attributes, stored contiguously in handle order.
+    typedef std::vector<ObjectAttribute> Attributes;
+
+    const Attributes& getAttributes() const
+    {
+        return _attributes;
+    }
+
 private:
     /*! Owner Handle
       BUG: Should be handled at the attribute level, not instance level.
     */
     FederateHandle Owner;
 
-    typedef std::map<AttributeHandle, ObjectAttribute*> AttributeMap;
     //! Attribute list from object class instance.
-    AttributeMap _attributeMap;
+    Attributes _attributes;
 
     ObjectClassHandle classHandle; //! Object Class
 };
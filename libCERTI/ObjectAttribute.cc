@@ -22,9 +22,11 @@
 // ----------------------------------------------------------------------------
 
 #include "ObjectAttribute.hh"
+#include "ObjectClassAttribute.hh"
 #include "PrettyDebug.hh"
 #include "RTIRegion.hh"
 
+#include <algorithm>
 #include <iostream>
 
 using std::cout;
@@ -39,7 +41,13 @@ static PrettyDebug D("OBJECTATTRIBUTE", "(Obj_Attr) - ");
 ObjectAttribute::ObjectAttribute(AttributeHandle new_handle,
                                  FederateHandle new_owner,
                                  ObjectClassAttribute* associated_attribute)
-    : handle(new_handle), owner(new_owner), divesting(false), space(0), source(associated_attribute), region(0)
+    : handle(new_handle)
+    , owner(new_owner)
+    , divesting(false)
+    , space(0)
+    , transport(associated_attribute ? associated_attribute->transport : RELIABLE)
+    , source(associated_attribute)
+    , region(0)
 {
 }
 
@@ -90,21 +98,27 @@ void ObjectAttribute::setDivesting(bool divestingState)
 //! Return the candidate position in list, null otherwise.
 bool ObjectAttribute::isCandidate(FederateHandle candidate) const
 {
-    return ownerCandidates.find(candidate) != ownerCandidates.end();
+    return std::binary_search(ownerCandidates.begin(), ownerCandidates.end(), candidate);
 }
 
 // ----------------------------------------------------------------------------
 //! Add a new candidate to list.
 void ObjectAttribute::addCandidate(FederateHandle candidate)
 {
-    ownerCandidates.insert(candidate);
+    auto it = std::lower_bound(ownerCandidates.begin(), ownerCandidates.end(), candidate);
+    if (it == ownerCandidates.end() || *it != candidate) {
+        ownerCandidates.insert(it, candidate);
+    }
 }
 
 // ----------------------------------------------------------------------------
 // Removes a candidate from list.
 void ObjectAttribute::removeCandidate(FederateHandle candidate)
 {
-    ownerCandidates.erase(candidate);
+    auto it = std::lower_bound(ownerCandidates.begin(), ownerCandidates.end(), candidate);
+    if (it != ownerCandidates.end() && *it == candidate) {
+        ownerCandidates.erase(it);
+    }
 }
 
 // ----------------------------------------------------------------------------
@@ -114,7 +128,7 @@ FederateHandle ObjectAttribute::getFirstCandidate() const
     if (ownerCandidates.empty())
         throw RTIinternalError("");
 
-    return *ownerCandidates.begin();
+    return ownerCandidates.front();
 }
 
 // ----------------------------------------------------------------------------
@@ -147,6 +161,18 @@ void ObjectAttribute::setSpace(SpaceHandle h)
     space = h;
 }
 
+// ----------------------------------------------------------------------------
+TransportType ObjectAttribute::getTransport() const
+{
+    return transport;
+}
+
+// ----------------------------------------------------------------------------
+void ObjectAttribute::setTransport(TransportType t)
+{
+    transport = t;
+}
+
 // ----------------------------------------------------------------------------
 /* Associate this attribute with a DDM region
  */
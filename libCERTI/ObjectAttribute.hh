@@ -28,7 +28,7 @@
 #include "Exception.hh"
 #include "Handle.hh"
 
-#include <set>
+#include <vector>
 
 namespace certi {
 
@@ -71,6 +71,10 @@ public:
     SpaceHandle getSpace() const;
     void setSpace(SpaceHandle);
 
+    /// Transport of the updates of the attribute, the one of its class attribute unless changed.
+    TransportType getTransport() const;
+    void setTransport(TransportType);
+
     ObjectClassAttribute* getObjectClassAttribute() const
     {
         return source;
@@ -91,8 +95,9 @@ private:
     AttributeHandle handle; //!< The object attribute handle.
     FederateHandle owner; //!< Federate who owns the attribute.
     bool divesting; //!< Divesting state.
-    std::set<FederateHandle> ownerCandidates; //!< Federates candidate.
+    std::vector<FederateHandle> ownerCandidates; //!< Federates candidate, sorted.
     SpaceHandle space; //!< Associated routing space
+    TransportType transport; //!< Transport type of the updates.
     ObjectClassAttribute* source; //!< The associated class attribute.
     RTIRegion* region;
 };
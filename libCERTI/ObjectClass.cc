@@ -97,7 +97,7 @@ void ObjectClass::addInheritedClassAttributes(ObjectClass* the_child)
   take a look at ObjectClassSet::RegisterObject to understand
   what is going on...
 */
-Responses ObjectClass::broadcastClassMessage(ObjectClassBroadcastList* ocbList, const Object* source)
+Responses ObjectClass::broadcastClassMessage(ObjectClassBroadcastList* ocbList)
 {
     Debug(G, pdGendoc) << "enter ObjectClass::broadcastClassMessage" << std::endl;
     // 1. Set ObjectHandle to local class Handle.
@@ -105,19 +105,8 @@ Responses ObjectClass::broadcastClassMessage(ObjectClassBroadcastList* ocbList,
 
     Debug(G, pdGendoc) << "      ObjectClass::broadcastClassMessage handle " << handle << std::endl;
     // 2. Update message attribute list by removing child's attributes.
-    if ((ocbList->getMsg().getMessageType() == NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES)) {
-        for (uint32_t attr = 0; attr < (ocbList->getMsgRAV()->getAttributesSize());) {
-            // If the attribute is not in that class, remove it from the message.
-            if (hasAttribute(ocbList->getMsgRAV()->getAttributes(attr))) {
-                ++attr;
-            }
-            else {
-                ocbList->getMsgRAV()->removeAttributes(attr);
-            }
-        }
-    }
     if ((ocbList->getMsg().getMessageType() == NetworkMessage::Type::REQUEST_ATTRIBUTE_OWNERSHIP_ASSUMPTION)) {
-        for (uint32_t attr = 0; attr < (ocbList->getMsgRAV()->getAttributesSize());) {
+        for (uint32_t attr = 0; attr < (ocbList->getMsgRAOA()->getAttributesSize());) {
             // If the attribute is not in that class, remove it from the message.
             if (hasAttribute(ocbList->getMsgRAOA()->getAttributes(attr))) {
                 ++attr;
@@ -141,26 +130,6 @@ Responses ObjectClass::broadcastClassMessage(ObjectClassBroadcastList* ocbList,
         }
     } break;
 
-    case NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES: {
-        // For each class attribute, update the list by adding federates who
-        // subscribed to the attribute.
-        for (uint32_t i = 0; i < ocbList->getMsgRAV()->getAttributesSize(); ++i) {
-            AttributeHandle attributeHandle = ocbList->getMsgRAV()->getAttributes(i);
-
-            HandleClassAttributeMap::iterator a = _handleClassAttributeMap.find(attributeHandle);
-            // May be this is a hard error?
-            if (a == _handleClassAttributeMap.end()) {
-                continue;
-            }
-
-            ObjectAttribute* attr = source->getAttribute(attributeHandle);
-            const RTIRegion* update_region = attr->getRegion();
-            Debug(D, pdTrace) << "RAV: attr " << attributeHandle << " / region "
-                              << (update_region ? update_region->getHandle() : 0) << std::endl;
-            a->second->updateBroadcastList(ocbList, update_region);
-        }
-    } break;
-
     case NetworkMessage::Type::REQUEST_ATTRIBUTE_OWNERSHIP_ASSUMPTION: {
         // For each class attribute, update the list be adding federates who
         // subscribed to the attribute.
@@ -187,11 +156,7 @@ void ObjectClass::sendToFederate(NetworkMessage* msg, FederateHandle theFederate
     // Send the message 'msg' to the Federate which Handle is theFederate.
     Socket* socket = NULL;
     try {
-#ifdef HLA_USES_UDP
-        socket = server->getSocketLink(theFederate, BEST_EFFORT);
-#else
         socket = server->getSocketLink(theFederate);
-#endif
         msg->send(socket, NM_msgBufSend);
     }
     catch (RTIinternalError& e) {
@@ -643,15 +608,15 @@ ObjectClass::registerObjectInstance(FederateHandle the_federate, Object* the_obj
     // Ownership management :
     // Copy instance attributes
     // Federate only owns attributes it publishes.
+    the_object->reserveAttributes(_handleClassAttributeMap.size());
     for (HandleClassAttributeMap::iterator i = _handleClassAttributeMap.begin(); i != _handleClassAttributeMap.end();
          ++i) {
-        ObjectAttribute* oa;
-        oa = new ObjectAttribute(
+        ObjectAttribute oa(
             i->second->getHandle(), i->second->isPublishing(the_federate) ? the_federate : 0, i->second);
 
         // privilegeToDelete is owned by federate even not published.
         if (i->second->isNamed("privilegeToDelete")) {
-            oa->setOwner(the_federate);
+            oa.setOwner(the_federate);
         }
 
         the_object->addAttribute(oa);
@@ -781,13 +746,14 @@ bool ObjectClass::subscribe(FederateHandle fed, const std::vector<AttributeHandl
     for (std::vector<AttributeHandle>::const_iterator it = attributes.begin(); it != attributes.end(); ++it) {
         getAttribute(*it)->subscribe(fed, region);
     }
+    invalidateRoutes();
 
     return (attributes.size() > 0) && !was_subscriber;
 } /* end of subscribe */
 
 // ----------------------------------------------------------------------------
 //! update Attribute Values with time.
-std::pair<ObjectClassBroadcastList*, Responses>
+std::unique_ptr<NM_Reflect_Attribute_Values>
 ObjectClass::updateAttributeValues(FederateHandle the_federate,
                                    Object* object,
                                    const std::vector<AttributeHandle>& the_attributes,
@@ -796,8 +762,6 @@ ObjectClass::updateAttributeValues(FederateHandle the_federate,
                                    FederationTime the_time,
                                    const std::string& the_tag)
 {
-    Responses ret;
-
     // Ownership management: Test ownership on each attribute before updating.
     ObjectAttribute* oa;
     for (int i = 0; i < the_size; i++) {
@@ -808,8 +772,6 @@ ObjectClass::updateAttributeValues(FederateHandle the_federate,
                                     + ">");
     }
 
-    // Prepare and Broadcast message for this class
-    ObjectClassBroadcastList* ocbList = NULL;
     if (server != NULL) {
         auto answer = make_unique<NM_Reflect_Attribute_Values>();
         answer->setFederation(server->federation().get());
@@ -827,26 +789,19 @@ ObjectClass::updateAttributeValues(FederateHandle the_federate,
             answer->setValues(the_values[i], i);
         }
 
-        ocbList = new ObjectClassBroadcastList(std::move(answer), _handleClassAttributeMap.size());
+        Debug(D, pdProtocol) << "Object " << object->getHandle() << " updated in class " << handle << std::endl;
 
-        Debug(D, pdProtocol) << "Object " << object->getHandle() << " updated in class " << handle
-                             << ", now broadcasting..." << std::endl;
-
-        ret = broadcastClassMessage(ocbList, object);
+        return answer;
     }
     else {
         Debug(D, pdExcept) << "UpdateAttributeValues should not be called on the RTIA." << std::endl;
         throw RTIinternalError("UpdateAttributeValues called on the RTIA.");
     }
-
-    // Return the BroadcastList in case it had to be passed to the parent
-    // class.
-    return {ocbList, std::move(ret)};
 }
 
 // ----------------------------------------------------------------------------
 //! update Attribute Values without time.
-std::pair<ObjectClassBroadcastList*, Responses>
+std::unique_ptr<NM_Reflect_Attribute_Values>
 ObjectClass::updateAttributeValues(FederateHandle the_federate,
                                    Object* object,
                                    const std::vector<AttributeHandle>& the_attributes,
@@ -854,7 +809,6 @@ ObjectClass::updateAttributeValues(FederateHandle the_federate,
                                    int the_size,
                                    const std::string& the_tag)
 {
-    Responses ret;
     // Ownership management: Test ownership on each attribute before updating.
     ObjectAttribute* oa;
     for (int i = 0; i < the_size; i++) {
@@ -866,8 +820,6 @@ ObjectClass::updateAttributeValues(FederateHandle the_federate,
         }
     }
 
-    // Prepare and Broadcast message for this class
-    ObjectClassBroadcastList* ocbList = NULL;
     if (server != NULL) {
         auto answer = make_unique<NM_Reflect_Attribute_Values>();
         answer->setFederation(server->federation().get());
@@ -886,21 +838,14 @@ ObjectClass::updateAttributeValues(FederateHandle the_federate,
             answer->setValues(the_values[i], i);
         }
 
-        ocbList = new ObjectClassBroadcastList(std::move(answer), _handleClassAttributeMap.size());
+        Debug(D, pdProtocol) << "Object " << object->getHandle() << " updated in class " << handle << std::endl;
 
-        Debug(D, pdProtocol) << "Object " << object->getHandle() << " updated in class " << handle
-                             << ", now broadcasting..." << std::endl;
-
-        ret = broadcastClassMessage(ocbList, object);
+        return answer;
     }
     else {
         Debug(D, pdExcept) << "UpdateAttributeValues should not be called on the RTIA." << std::endl;
         throw RTIinternalError("UpdateAttributeValues called on the RTIA.");
     }
-
-    // Return the BroadcastList in case it had to be passed to the parent
-    // class.
-    return {ocbList, std::move(ret)};
 }
 
 // ----------------------------------------------------------------------------
@@ -1504,6 +1449,7 @@ void ObjectClass::unsubscribe(FederateHandle fed, const RTIRegion* region)
             i->second->unsubscribe(fed, region);
         }
     }
+    invalidateRoutes();
 }
 
 // ----------------------------------------------------------------------------
@@ -1517,8 +1463,17 @@ void ObjectClass::unsubscribe(FederateHandle fed)
             i->second->unsubscribe(fed);
         }
     }
+    invalidateRoutes();
 } /* end of unsubscribe */
 
+void ObjectClass::invalidateRoutes()
+{
+    my_routes.clear();
+    for (auto i = subClasses->handled_begin(); i != subClasses->handled_end(); ++i) {
+        i->second->invalidateRoutes();
+    }
+}
+
 void ObjectClass::addSubClass(ObjectClass* child)
 {
     /* build parent-child relationship */
@@ -44,7 +44,10 @@ class ObjectClassBroadcastList;
 
 // Standard
 #include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace certi {
 
@@ -191,22 +194,37 @@ public:
 
     std::pair<ObjectClassBroadcastList*, Responses> registerObjectInstance(FederateHandle, Object*, ObjectClassHandle);
 
-    Responses broadcastClassMessage(ObjectClassBroadcastList* ocb_list, const Object* = nullptr);
+    Responses broadcastClassMessage(ObjectClassBroadcastList* ocb_list);
 
-    std::pair<ObjectClassBroadcastList*, Responses> updateAttributeValues(FederateHandle,
-                                                                          Object*,
-                                                                          const std::vector<AttributeHandle>&,
-                                                                          const std::vector<AttributeValue_t>&,
-                                                                          int,
-                                                                          FederationTime,
-                                                                          const std::string&);
-
-    std::pair<ObjectClassBroadcastList*, Responses> updateAttributeValues(FederateHandle,
-                                                                          Object*,
-                                                                          const std::vector<AttributeHandle>&,
-                                                                          const std::vector<AttributeValue_t>&,
-                                                                          int,
-                                                                          const std::string&);
+    /** Check that the federate owns the updated attributes, and make the message
+     * reflecting their values. ObjectClassSet routes it to the subscribers.
+     */
+    std::unique_ptr<NM_Reflect_Attribute_Values> updateAttributeValues(FederateHandle,
+                                                                       Object*,
+                                                                       const std::vector<AttributeHandle>&,
+                                                                       const std::vector<AttributeValue_t>&,
+                                                                       int,
+                                                                       FederationTime,
+                                                                       const std::string&);
+
+    std::unique_ptr<NM_Reflect_Attribute_Values> updateAttributeValues(FederateHandle,
+                                                                       Object*,
+                                                                       const std::vector<AttributeHandle>&,
+                                                                       const std::vector<AttributeValue_t>&,
+                                                                       int,
+                                                                       const std::string&);
+
+    /// The subscribers to route the updates of an attribute to, by attribute.
+    typedef std::unordered_map<AttributeHandle, std::vector<FederateHandle>> Routes;
+
+    /** Routes of the updates of the instances of this class which have no region, built by
+     * ObjectClassSet from the subscribers of this class and of its superclasses.
+     * They are dropped when a subscription to this class or to a superclass changes.
+     */
+    Routes& getRoutes()
+    {
+        return my_routes;
+    }
 
     void recursiveDiscovering(FederateHandle, ObjectClassHandle);
 
@@ -235,6 +253,9 @@ private:
 
     void addInheritedClassAttributes(ObjectClass* child);
 
+    /// Drop the routes of this class and of its subclasses.
+    void invalidateRoutes();
+
     void sendToFederate(NetworkMessage* msg, FederateHandle theFederate);
 
     /// Simple private inner-class.
@@ -294,6 +315,8 @@ private:
 
     /// The message buffer used to send Network messages
     libhla::MessageBuffer NM_msgBufSend;
+
+    Routes my_routes;
 };
 
 } // namespace certi
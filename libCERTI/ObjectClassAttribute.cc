@@ -151,12 +151,9 @@ SpaceHandle ObjectClassAttribute::getSpace() const
 
 // ----------------------------------------------------------------------------
 //! Add all attribute's subscribers to the broadcast list
-void ObjectClassAttribute::updateBroadcastList(ObjectClassBroadcastList* ocblist, const RTIRegion* region)
+void ObjectClassAttribute::updateBroadcastList(ObjectClassBroadcastList* ocblist)
 {
     switch (ocblist->getMsg().getMessageType()) {
-    case NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES: {
-        addFederatesIfOverlap(*ocblist, region, handle);
-    } break;
     case NetworkMessage::Type::REQUEST_ATTRIBUTE_OWNERSHIP_ASSUMPTION: {
         PublishersList_t::iterator i;
         for (i = publishers.begin(); i != publishers.end(); ++i) {
@@ -86,7 +86,7 @@ public:
     void unpublish(FederateHandle);
 
     // Update attribute values
-    void updateBroadcastList(ObjectClassBroadcastList* ocb_list, const RTIRegion* region = NULL);
+    void updateBroadcastList(ObjectClassBroadcastList* ocb_list);
 
     /**
      * Getter for the attributes publisher list.
@@ -197,6 +197,14 @@ Responses ObjectClassBroadcastList::preparePendingMessage(SecurityServer& server
     }
 }
 
+Responses ObjectClassBroadcastList::releasePendingMessage(SecurityServer& server)
+{
+    if (msgRAV) {
+        return preparePendingRAVMessage(server, true);
+    }
+    return preparePendingMessage(server);
+}
+
 void ObjectClassBroadcastList::upcastTo(ObjectClassHandle objectClass)
 {
     /* Initialize specific pointer
@@ -238,11 +246,7 @@ Responses ObjectClassBroadcastList::preparePendingDOMessage(SecurityServer& serv
             // 1. Prepare message for federate
             Debug(D, pdProtocol) << "Broadcasting message to Federate " << line.getFederate() << std::endl;
             try {
-#ifdef HLA_USES_UDP
-                sockets.push_back(server.getSocketLink(line.getFederate(), BEST_EFFORT));
-#else
                 sockets.push_back(server.getSocketLink(line.getFederate()));
-#endif
             }
             catch (Exception& e) {
                 Debug(D, pdExcept) << "Reference to a killed Federate while broadcasting." << std::endl;
@@ -268,7 +272,7 @@ Responses ObjectClassBroadcastList::preparePendingDOMessage(SecurityServer& serv
     return responses;
 }
 
-Responses ObjectClassBroadcastList::preparePendingRAVMessage(SecurityServer& server)
+Responses ObjectClassBroadcastList::preparePendingRAVMessage(SecurityServer& server, const bool release)
 {
     Debug(G, pdGendoc) << "enter ObjectClassBroadcastList::sendPendingRAVMessage" << std::endl;
 
@@ -284,23 +288,25 @@ Responses ObjectClassBroadcastList::preparePendingRAVMessage(SecurityServer& ser
         relevantAttributes = msgRAOA->getAttributes();
     }
 
+    // Federates waiting for every attribute of the message all get the very same bytes,
+    // so they share a single response: the message is copied and serialized once.
+    std::vector<Socket*> completeSockets;
+
     for (auto& line : my_lines) {
         // If *at least* one of the attributes is waiting
         if (line.isWaitingAny(maxHandle)) {
-            std::unique_ptr<NetworkMessage> currentMessage;
-
             if (line.isWaitingAll(relevantAttributes)) {
-                // YES: Nothing to do.
-                if (msgRAV) {
-                    currentMessage = createResponseMessage(msgRAV);
+                Debug(D, pdProtocol) << "Broadcasting complete message to Federate " << line.getFederate() << std::endl;
+                try {
+                    completeSockets.push_back(server.getSocketLink(line.getFederate()));
                 }
-                if (msgRAOA) {
-                    currentMessage = createResponseMessage(msgRAOA);
+                catch (Exception& e) {
+                    Debug(D, pdExcept) << "Reference to a killed Federate while broadcasting." << std::endl;
                 }
-                Debug(D, pdProtocol) << "Broadcasting complete message to Federate " << line.getFederate() << std::endl;
             }
             else {
-                // NO: Create a new message containing only relevant attributes.
+                // Create a new message containing only relevant attributes.
+                std::unique_ptr<NetworkMessage> currentMessage;
                 if (msgRAV) {
                     currentMessage = createResponseMessageWithValues(msgRAV, line);
                 }
@@ -308,37 +314,44 @@ Responses ObjectClassBroadcastList::preparePendingRAVMessage(SecurityServer& ser
                     currentMessage = createResponseMessage(msgRAOA, line);
                 }
                 Debug(D, pdProtocol) << "Broadcasting reduced message to Federate " << line.getFederate() << std::endl;
-            }
 
-            // 2. Send appropriate message
-            try {
-                std::vector<Socket*> sockets;
-#ifdef HLA_USES_UDP
-                sockets.push_back(server.getSocketLink(line.getFederate(), BEST_EFFORT));
-#else
-                sockets.push_back(server.getSocketLink(line.getFederate()));
-#endif
-                responses.emplace_back(sockets, std::move(currentMessage));
-            }
-            catch (Exception& e) {
-                Debug(D, pdExcept) << "Reference to a killed Federate while broadcasting." << std::endl;
+                try {
+                    std::vector<Socket*> sockets;
+                    sockets.push_back(server.getSocketLink(line.getFederate()));
+                    responses.emplace_back(sockets, std::move(currentMessage));
+                }
+                catch (Exception& e) {
+                    Debug(D, pdExcept) << "Reference to a killed Federate while broadcasting." << std::endl;
+                }
             }
 
-            // 3. mark attributes as sent.
+            // Mark attributes as sent.
             for (unsigned int attrIndex = 1; attrIndex <= maxHandle; attrIndex++) {
                 if (line.stateFor(attrIndex) == ObjectBroadcastLine::State::Waiting) {
                     line.setState(attrIndex, ObjectBroadcastLine::State::Sent);
                 }
             }
-            //*/
         }
         else {
             Debug(D, pdProtocol) << "No message sent to Federate " << line.getFederate() << std::endl;
         }
+    }
 
-        Debug(G, pdGendoc) << "exit  ObjectClassBroadcastList::sendPendingRAVMessage" << std::endl;
+    if (!completeSockets.empty()) {
+        if (msgRAV && release) {
+            msgRAV = nullptr;
+            responses.emplace_back(completeSockets, std::move(my_message));
+        }
+        else if (msgRAV) {
+            responses.emplace_back(completeSockets, createResponseMessage(msgRAV));
+        }
+        if (msgRAOA) {
+            responses.emplace_back(completeSockets, createResponseMessage(msgRAOA));
+        }
     }
 
+    Debug(G, pdGendoc) << "exit  ObjectClassBroadcastList::sendPendingRAVMessage" << std::endl;
+
     return responses;
 }
 
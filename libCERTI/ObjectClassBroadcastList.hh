@@ -131,9 +131,18 @@ public:
      * and then all pending attributes(in the bsWainting state) are added
      * to the copy. The copy is sent, and attributes are marked as
      * ObjectBroadcastLine::sent.
+     * Federates waiting for all the attributes of a RAV message share a
+     * single response, so that the message is only encoded once for them.
      */
     Responses preparePendingMessage(SecurityServer& server);
 
+    /** Prepare all the pending message like preparePendingMessage, for the last time.
+     * 
+     * The federates waiting for all the attributes of a RAV message get the message
+     * itself instead of a copy, so the list must not be used afterwards.
+     */
+    Responses releasePendingMessage(SecurityServer& server);
+
     /**
      * Upcast class to appropriate message.
      * The inheritance feature of HLA imply that a federate subscribing
@@ -159,7 +168,7 @@ protected:
 
 private:
     Responses preparePendingDOMessage(SecurityServer& server);
-    Responses preparePendingRAVMessage(SecurityServer& server);
+    Responses preparePendingRAVMessage(SecurityServer& server, const bool release = false);
 
     template <typename T>
     std::unique_ptr<NetworkMessage> createResponseMessage(T* message, const ObjectBroadcastLine& line);
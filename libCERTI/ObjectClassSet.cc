@@ -24,13 +24,16 @@
 // Project
 #include "Named.hh"
 #include "Object.hh"
+#include "ObjectAttribute.hh"
 #include "ObjectClass.hh"
+#include "ObjectClassAttribute.hh"
 #include "ObjectClassBroadcastList.hh"
 #include "ObjectClassSet.hh"
 #include "PrettyDebug.hh"
 #include "SecurityServer.hh"
 
 // Standard
+#include <algorithm>
 #include <iosfwd>
 #include <sstream>
 
@@ -318,8 +321,6 @@ Responses ObjectClassSet::updateAttributeValues(FederateHandle federate,
                                                 const FederationTime& time,
                                                 const std::string& tag)
 {
-    Responses ret;
-
     ObjectClass* object_class = getObjectFromHandle(object->getClass());
     ObjectClassHandle current_class = object_class->getHandle();
 
@@ -327,29 +328,10 @@ Responses ObjectClassSet::updateAttributeValues(FederateHandle federate,
                          << current_class << std::endl;
 
     // It may throw a bunch of exceptions
-    ObjectClassBroadcastList* ocbList = NULL;
-    std::tie(ocbList, ret)
+    auto message
         = object_class->updateAttributeValues(federate, object, attributes, values, attributes.size(), time, tag);
 
-    // Broadcast ReflectAttributeValues message recursively
-    current_class = object_class->getSuperclass();
-
-    while (0 != current_class) {
-        Debug(D, pdProtocol) << "Broadcasting RAV msg to parent class " << current_class << " for instance "
-                             << object->getHandle() << std::endl;
-
-        // It may throw ObjectClassNotDefined
-        object_class = getObjectFromHandle(current_class);
-
-        auto resp = object_class->broadcastClassMessage(ocbList, object);
-        ret.insert(std::end(ret), make_move_iterator(std::begin(resp)), make_move_iterator(std::end(resp)));
-
-        current_class = object_class->getSuperclass();
-    }
-
-    delete ocbList;
-
-    return ret;
+    return reflectAttributeValues(*object_class, *object, std::move(message));
 }
 
 Responses ObjectClassSet::updateAttributeValues(FederateHandle federate,
@@ -358,8 +340,6 @@ Responses ObjectClassSet::updateAttributeValues(FederateHandle federate,
                                                 const std::vector<AttributeValue_t>& values,
                                                 const std::string& tag)
 {
-    Responses ret;
-
     ObjectClass* object_class = getObjectFromHandle(object->getClass());
     ObjectClassHandle current_class = object_class->getHandle();
 
@@ -367,28 +347,68 @@ Responses ObjectClassSet::updateAttributeValues(FederateHandle federate,
                          << current_class << std::endl;
 
     // It may throw a bunch of exceptions
-    ObjectClassBroadcastList* ocbList = NULL;
-    std::tie(ocbList, ret)
-        = object_class->updateAttributeValues(federate, object, attributes, values, attributes.size(), tag);
+    auto message = object_class->updateAttributeValues(federate, object, attributes, values, attributes.size(), tag);
 
-    // Broadcast ReflectAttributeValues message recursively
-    current_class = object_class->getSuperclass();
+    return reflectAttributeValues(*object_class, *object, std::move(message));
+}
 
-    while (current_class != 0) {
-        Debug(D, pdProtocol) << "Broadcasting RAV msg to parent class " << current_class << " for instance "
-                             << object->getHandle() << std::endl;
+Responses ObjectClassSet::reflectAttributeValues(ObjectClass& object_class,
+                                                 const Object& object,
+                                                 std::unique_ptr<NM_Reflect_Attribute_Values> message)
+{
+    ObjectClassBroadcastList ocb_list(std::move(message), object_class.getHandleClassAttributeMap().size());
 
-        // It may throw ObjectClassNotDefined
-        object_class = getObjectFromHandle(current_class);
-        auto resp = object_class->broadcastClassMessage(ocbList, object);
-        ret.insert(std::end(ret), make_move_iterator(std::begin(resp)), make_move_iterator(std::end(resp)));
+    std::vector<FederateHandle> overlapping;
+    for (const auto attribute : ocb_list.getMsgRAV()->getAttributes()) {
+        const auto* region = object.getAttribute(attribute)->getRegion();
+
+        const std::vector<FederateHandle>* federates = nullptr;
+        if (region) {
+            overlapping.clear();
+            addRoute(overlapping, object_class, attribute, region);
+            federates = &overlapping;
+        }
+        else {
+            federates = &getRoute(object_class, attribute);
+        }
+
+        for (const auto federate : *federates) {
+            ocb_list.addFederate(federate, attribute);
+        }
+    }
 
-        current_class = object_class->getSuperclass();
+    Debug(D, pdProtocol) << "Broadcasting RAV msg for instance " << object.getHandle() << std::endl;
+    return ocb_list.releasePendingMessage(*server);
+}
+
+const std::vector<FederateHandle>& ObjectClassSet::getRoute(ObjectClass& object_class, AttributeHandle attribute)
+{
+    auto& routes = object_class.getRoutes();
+    auto it = routes.find(attribute);
+    if (it == routes.end()) {
+        Debug(D, pdRegister) << "Computing subscribers of attribute " << attribute << " in class "
+                             << object_class.getHandle() << std::endl;
+        std::vector<FederateHandle> federates;
+        addRoute(federates, object_class, attribute, nullptr);
+        std::sort(std::begin(federates), std::end(federates));
+        federates.erase(std::unique(std::begin(federates), std::end(federates)), std::end(federates));
+        it = routes.emplace(attribute, std::move(federates)).first;
     }
+    return it->second;
+}
 
-    delete ocbList;
+void ObjectClassSet::addRoute(std::vector<FederateHandle>& federates,
+                              const ObjectClass& object_class,
+                              AttributeHandle attribute,
+                              const RTIRegion* region) const
+{
+    const ObjectClass* current_class = &object_class;
+    while (current_class && current_class->hasAttribute(attribute)) {
+        current_class->getAttribute(attribute)->addFederatesIfOverlap(federates, region);
 
-    return ret;
+        const auto superclass = current_class->getSuperclass();
+        current_class = superclass == 0 ? nullptr : getObjectFromHandle(superclass);
+    }
 }
 
 Responses ObjectClassSet::negotiatedAttributeOwnershipDivestiture(FederateHandle theFederateHandle,
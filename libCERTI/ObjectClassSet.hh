@@ -134,6 +134,24 @@ public:
                                              const std::vector<AttributeHandle>& theAttributeList);
 
 private:
+    /** Route the reflection of an update to the federates subscribed to the class of the
+     * object or to one of its superclasses.
+     * Each federate receives its attributes in a single message. The federates receiving
+     * all the attributes share the update message itself.
+     */
+    Responses reflectAttributeValues(ObjectClass& object_class,
+                                     const Object& object,
+                                     std::unique_ptr<NM_Reflect_Attribute_Values> message);
+
+    /// Federates subscribed to an attribute of the class or of a superclass, once each, for updates without region.
+    const std::vector<FederateHandle>& getRoute(ObjectClass& object_class, AttributeHandle attribute);
+
+    /// Add the federates subscribed to an attribute of the class or of a superclass whose region overlaps.
+    void addRoute(std::vector<FederateHandle>& federates,
+                  const ObjectClass& object_class,
+                  AttributeHandle attribute,
+                  const RTIRegion* region) const;
+
     /** This object will help to find the TCPLink associated with a Federate.
 	 * This reference is passed to all new ObjectClass.
 	 */
@@ -42,19 +42,23 @@ ObjectSet::ObjectSet(SecurityServer* the_server) : server(the_server)
 
 ObjectSet::~ObjectSet()
 {
-    for (auto i = begin(my_objects_per_handle); i != end(my_objects_per_handle); ++i) {
-        delete i->second;
+    for (auto object : my_objects_per_handle) {
+        if (object) {
+            my_slab.destroy(object);
+        }
     }
 }
 
 void ObjectSet::display() const
 {
-    std::cout << "Object set: " << my_objects_per_handle.size() << std::endl;
-    for (const auto& pair : my_objects_per_handle) {
-        std::cout << "****" << std::endl;
-        std::cout << "Object #" << pair.first << std::endl;
-        pair.second->display();
-        std::cout << "****" << std::endl;
+    std::cout << "Object set: " << my_size << std::endl;
+    for (const auto object : my_objects_per_handle) {
+        if (object) {
+            std::cout << "****" << std::endl;
+            std::cout << "Object #" << object->getHandle() << std::endl;
+            object->display();
+            std::cout << "****" << std::endl;
+        }
     }
 }
 
@@ -94,27 +98,26 @@ Object* ObjectSet::registerObjectInstance(FederateHandle the_federate,
                                           ObjectHandle the_object,
                                           const std::string& the_name)
 {
-    if (my_objects_per_handle.find(the_object) != end(my_objects_per_handle)) {
+    if (the_object < my_objects_per_handle.size() && my_objects_per_handle[the_object]) {
         throw ObjectAlreadyRegistered("Object already in ObjectSet map.");
     }
 
-    if (my_objects_per_name.find(the_name) != end(my_objects_per_name)) {
+    const auto name = the_name.empty() ? "HLAobject_" + std::to_string(the_object) : the_name;
+    if (my_objects_per_name.find(name) != end(my_objects_per_name)) {
         throw ObjectAlreadyRegistered("Object name already defined.");
     }
 
-    auto object = new Object(the_federate);
+    auto object = my_slab.create(the_federate);
     object->setHandle(the_object);
     object->setClass(the_class);
+    object->setName(name);
 
-    if (the_name.size() > 0) {
-        object->setName(the_name);
-    }
-    else {
-        object->setName("HLAobject_" + std::to_string(the_object));
+    if (the_object >= my_objects_per_handle.size()) {
+        my_objects_per_handle.resize(the_object + 1);
     }
-
     my_objects_per_handle[the_object] = object;
-    my_objects_per_name[the_name] = object;
+    my_objects_per_name.emplace(name, object);
+    ++my_size;
 
     return object;
 }
@@ -124,38 +127,43 @@ void ObjectSet::deleteObjectInstance(FederateHandle /*the_federate*/,
                                      const std::string& /*the_tag*/)
 {
     auto object = getObject(the_object);
-    my_objects_per_handle.erase(object->getHandle());
+    my_objects_per_handle[the_object] = nullptr;
     my_objects_per_name.erase(object->getName());
+    --my_size;
+
+    my_slab.destroy(object); // Remove the Object instance.
 
-    delete object; // Remove the Object instance.
+    // Keep the index as short as the handles in use
+    while (!my_objects_per_handle.empty() && !my_objects_per_handle.back()) {
+        my_objects_per_handle.pop_back();
+    }
 }
 
 FederateHandle ObjectSet::requestObjectOwner(FederateHandle /*the_federate*/, ObjectHandle the_object) const
 {
     Debug(G, pdGendoc) << "enter ObjectSet::requestObjectOwner" << std::endl;
-    auto it = my_objects_per_handle.find(the_object);
-
-    if (it == end(my_objects_per_handle)) {
+    if (the_object >= my_objects_per_handle.size() || !my_objects_per_handle[the_object]) {
         throw ObjectNotKnown("Object <" + std::to_string(the_object) + "> not found in ObjectSet map.");
     }
 
     // Object found, return the owner
     Debug(G, pdGendoc) << "exit  ObjectSet::requestObjectOwner" << std::endl;
-    return it->second->getOwner();
+    return my_objects_per_handle[the_object]->getOwner();
 }
 
 void ObjectSet::killFederate(FederateHandle the_federate)
 {
-    auto i = begin(my_objects_per_handle);
-    while (i != end(my_objects_per_handle)) {
-        if (i->second->getOwner() == the_federate) {
-            deleteObjectInstance(the_federate, i->first, "");
-            i = begin(my_objects_per_handle);
+    // Deletion may only shorten the index, from its end
+    for (ObjectHandle handle = 0; handle < my_objects_per_handle.size(); ++handle) {
+        auto object = my_objects_per_handle[handle];
+        if (!object) {
+            continue;
+        }
+        if (object->getOwner() == the_federate) {
+            deleteObjectInstance(the_federate, handle, "");
         }
         else {
-            // It is safe to run this multiple times
-            i->second->killFederate(the_federate);
-            ++i;
+            object->killFederate(the_federate);
         }
     }
 }
@@ -284,10 +292,8 @@ void ObjectSet::cancelAttributeOwnershipAcquisition(FederateHandle /*the_federat
 
 Object* ObjectSet::getObject(ObjectHandle the_object) const
 {
-    auto it = my_objects_per_handle.find(the_object);
-
-    if (it != end(my_objects_per_handle)) {
-        return it->second;
+    if (the_object < my_objects_per_handle.size() && my_objects_per_handle[the_object]) {
+        return my_objects_per_handle[the_object];
     }
 
     throw ObjectNotKnown("Object <" + std::to_string(the_object) + "> not found in map set.");
@@ -308,9 +314,9 @@ void ObjectSet::getAllObjectInstancesFromFederate(FederateHandle the_federate,
                                                   std::vector<ObjectHandle>& ownedObjectInstances) const
 {
     ownedObjectInstances.clear();
-    for (const auto& kv : my_objects_per_handle) {
-        if (kv.second && kv.second->getOwner() == the_federate) {
-            ownedObjectInstances.push_back(kv.first);
+    for (const auto object : my_objects_per_handle) {
+        if (object && object->getOwner() == the_federate) {
+            ownedObjectInstances.push_back(object->getHandle());
         }
     }
 }
@@ -320,11 +326,7 @@ void ObjectSet::sendToFederate(NetworkMessage* msg, FederateHandle the_federate)
     // Send the message 'msg' to the Federate which Handle is theFederate.
     Socket* socket = nullptr;
     try {
-#ifdef HLA_USES_UDP
-        socket = server->getSocketLink(the_federate, BEST_EFFORT);
-#else
         socket = server->getSocketLink(the_federate);
-#endif
         msg->send(socket, const_cast<MessageBuffer&>(NM_msgBufSend));
     }
     catch (RTIinternalError& e) {
@@ -25,18 +25,26 @@
 #define _CERTI_OBJECT_SET_HH
 
 // Project
-class Object;
 #include "GAV.hh"
+#include "Object.hh"
 #include "SecurityServer.hh"
+#include "Slab.hh"
 #include <include/certi.hh>
 #include <libHLA/MessageBuffer.hh>
 
 // Standard
-#include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace certi {
 
+/** The object instances of a federation.
+ *
+ * The instances are allocated in a slab and indexed by handle in a vector: object handles are
+ * provided in sequence and never reused, so the vector holds at most one null entry per deleted
+ * instance. Names are indexed in a hash table.
+ */
 class CERTI_EXPORT ObjectSet {
 public:
     // Public Methods.
@@ -124,13 +132,27 @@ public:
 
     void getAllObjectInstancesFromFederate(FederateHandle the_federate, std::vector<ObjectHandle>& handles) const;
 
+    //! The objects, indexed by handle, null for handles without object.
+    const std::vector<Object*>& getObjects() const
+    {
+        return my_objects_per_handle;
+    }
+
+    //! Number of registered objects.
+    std::size_t size() const
+    {
+        return my_size;
+    }
+
 protected:
     void sendToFederate(NetworkMessage* msg, FederateHandle the_federate) const;
 
     SecurityServer* server {nullptr};
 
-    std::map<ObjectHandle, Object*> my_objects_per_handle {};
-    std::map<std::string, Object*> my_objects_per_name {};
+    Slab<Object> my_slab {};
+    std::vector<Object*> my_objects_per_handle {};
+    std::unordered_map<std::string, Object*> my_objects_per_name {};
+    std::size_t my_size {0};
     
     /* The message buffer used to send Network messages */
     MessageBuffer NM_msgBufSend {};
@@ -52,6 +52,14 @@ SpaceHandle RTIRegion::getSpaceHandle() const noexcept
     return space.getHandle();
 }
 
+// ----------------------------------------------------------------------------
+/** Get the routing space having this region.
+ */
+const RoutingSpace& RTIRegion::getRoutingSpace() const noexcept
+{
+    return space;
+}
+
 } // namespace certi
 
 // $Id: RTIRegion.cc,v 3.4 2007/07/06 09:25:18 erk Exp $
@@ -38,6 +38,8 @@ public:
 
     virtual SpaceHandle getSpaceHandle() const noexcept;
 
+    const RoutingSpace& getRoutingSpace() const noexcept;
+
 protected:
     const RoutingSpace& space;
 };
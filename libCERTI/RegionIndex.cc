@@ -0,0 +1,248 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+// ----------------------------------------------------------------------------
+
+#include "RegionIndex.hh"
+
+#include <algorithm>
+
+#include "BaseRegion.hh"
+#include "PrettyDebug.hh"
+
+namespace certi {
+
+static PrettyDebug D("REGIONINDEX", __FILE__);
+
+namespace {
+/// Number of cells per axis, when one or two dimensions are indexed.
+static constexpr size_t the_cuts_1d{256};
+static constexpr size_t the_cuts_2d{32};
+
+/// The grid is not recomputed before that many changes, for the small indexes.
+static constexpr size_t the_min_changes{64};
+
+size_t indexedDimensions(const Extent& extent)
+{
+    return std::min<size_t>(2, extent.size());
+}
+}
+
+RegionIndex::RegionIndex() : my_cells(1), my_changes(0), my_generation(0), my_cachedRegion(nullptr), my_cachedGeneration(0)
+{
+}
+
+void RegionIndex::update(const BaseRegion& region)
+{
+    auto it = my_regions.find(&region);
+    if (it == my_regions.end()) {
+        it = my_regions.emplace(&region, Entry{false, {}}).first;
+    }
+    else {
+        erase(region, it->second);
+    }
+    add(region, it->second);
+
+    changed();
+}
+
+void RegionIndex::remove(const BaseRegion& region)
+{
+    auto it = my_regions.find(&region);
+    if (it == my_regions.end()) {
+        return;
+    }
+
+    erase(region, it->second);
+    my_regions.erase(it);
+
+    changed();
+}
+
+bool RegionIndex::contains(const BaseRegion& region) const
+{
+    return my_regions.find(&region) != my_regions.end();
+}
+
+size_t RegionIndex::size() const
+{
+    return my_regions.size();
+}
+
+const RegionIndex::RegionSet& RegionIndex::getOverlappingRegions(const BaseRegion& region) const
+{
+    // A region of the index cannot change without changing the generation
+    if (my_cachedRegion == &region && my_cachedGeneration == my_generation && contains(region)) {
+        return my_cachedResult;
+    }
+
+    my_cachedResult.clear();
+    my_cachedRegion = &region;
+    my_cachedGeneration = my_generation;
+
+    Cells cells;
+    if (!computeCells(region, cells)) {
+        for (const auto& kv : my_regions) {
+            if (kv.first->overlaps(region)) {
+                my_cachedResult.insert(kv.first);
+            }
+        }
+        return my_cachedResult;
+    }
+
+    RegionSet tested;
+    for (const auto& cell : cells) {
+        for (const auto& candidate : my_cells[cell]) {
+            if (tested.insert(candidate).second && candidate->overlaps(region)) {
+                my_cachedResult.insert(candidate);
+            }
+        }
+    }
+    for (const auto& candidate : my_large) {
+        if (candidate->overlaps(region)) {
+            my_cachedResult.insert(candidate);
+        }
+    }
+
+    Debug(D, pdTrace) << "Region " << region.getHandle() << " overlaps " << my_cachedResult.size() << " regions, "
+                      << tested.size() + my_large.size() << " tested out of " << my_regions.size() << std::endl;
+
+    return my_cachedResult;
+}
+
+bool RegionIndex::computeCells(const BaseRegion& region, Cells& cells) const
+{
+    const size_t columns = my_cuts[0].size() + 1;
+    const size_t rows = my_cuts[1].size() + 1;
+
+    auto cellOf = [this](const size_t axis, const uint32_t value) {
+        return static_cast<size_t>(std::upper_bound(begin(my_cuts[axis]), end(my_cuts[axis]), value)
+                                   - begin(my_cuts[axis]));
+    };
+
+    for (const auto& extent : region.getExtents()) {
+        const size_t dimensions = indexedDimensions(extent);
+
+        // An extent is not bounded on the axes it does not have: a 1-D extent
+        // spans all the rows of its columns, a 0-D one the whole grid
+        size_t first[2] = {0, 0};
+        size_t last[2] = {columns - 1, rows - 1};
+        for (size_t axis = 0; axis < dimensions; ++axis) {
+            first[axis] = cellOf(axis, extent.getRangeLowerBound(axis + 1));
+            last[axis] = cellOf(axis, extent.getRangeUpperBound(axis + 1));
+            if (last[axis] < first[axis]) {
+                // Never built by the RTI, but still a valid input of Extent::overlaps
+                std::swap(first[axis], last[axis]);
+            }
+        }
+
+        if (4 * (last[0] - first[0] + 1) * (last[1] - first[1] + 1) > columns * rows && columns * rows > 1) {
+            return false;
+        }
+
+        for (size_t row = first[1]; row <= last[1]; ++row) {
+            for (size_t column = first[0]; column <= last[0]; ++column) {
+                cells.push_back(static_cast<uint32_t>(row * columns + column));
+            }
+        }
+    }
+
+    // Extents of a region often share cells
+    std::sort(begin(cells), end(cells));
+    cells.erase(std::unique(begin(cells), end(cells)), end(cells));
+
+    return true;
+}
+
+void RegionIndex::add(const BaseRegion& region, Entry& entry)
+{
+    entry.cells.clear();
+    entry.large = !computeCells(region, entry.cells);
+
+    if (entry.large) {
+        entry.cells.clear();
+        my_large.insert(&region);
+    }
+    else {
+        for (const auto& cell : entry.cells) {
+            my_cells[cell].insert(&region);
+        }
+    }
+}
+
+void RegionIndex::erase(const BaseRegion& region, const Entry& entry)
+{
+    if (entry.large) {
+        my_large.erase(&region);
+    }
+    else {
+        for (const auto& cell : entry.cells) {
+            my_cells[cell].erase(&region);
+        }
+    }
+}
+
+void RegionIndex::changed()
+{
+    ++my_generation;
+
+    if (++my_changes > std::max(the_min_changes, my_regions.size() / 2)) {
+        rebuild();
+    }
+}
+
+void RegionIndex::rebuild()
+{
+    my_changes = 0;
+
+    // Cut each axis so that the cells hold about the same number of extent centers
+    size_t dimensions = 0;
+    std::vector<uint32_t> centers[2];
+    for (const auto& kv : my_regions) {
+        for (const auto& extent : kv.first->getExtents()) {
+            dimensions = std::max(dimensions, indexedDimensions(extent));
+            for (size_t axis = 0; axis < indexedDimensions(extent); ++axis) {
+                centers[axis].push_back(extent.getRangeLowerBound(axis + 1) / 2
+                                        + extent.getRangeUpperBound(axis + 1) / 2);
+            }
+        }
+    }
+
+    const size_t cuts = dimensions == 2 ? the_cuts_2d : the_cuts_1d;
+    for (size_t axis = 0; axis < 2; ++axis) {
+        auto& values = centers[axis];
+        my_cuts[axis].clear();
+        std::sort(begin(values), end(values));
+        for (size_t i = 1; i < cuts && !values.empty(); ++i) {
+            auto cut = values[i * values.size() / cuts];
+            if (my_cuts[axis].empty() || my_cuts[axis].back() < cut) {
+                my_cuts[axis].push_back(cut);
+            }
+        }
+    }
+
+    my_cells.assign((my_cuts[0].size() + 1) * (my_cuts[1].size() + 1), {});
+    my_large.clear();
+    for (auto& kv : my_regions) {
+        add(*kv.first, kv.second);
+    }
+
+    Debug(D, pdDebug) << "Rebuilt index of " << my_regions.size() << " regions on " << my_cells.size() << " cells, "
+                      << my_large.size() << " large regions" << std::endl;
+}
+
+} // namespace certi
@@ -0,0 +1,105 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_REGION_INDEX_HH
+#define CERTI_REGION_INDEX_HH
+
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <include/certi.hh>
+
+namespace certi {
+
+class BaseRegion;
+
+/**
+ * Spatial index of the regions of a routing space.
+ *
+ * The first two dimensions of the space are cut into a grid and each region
+ * is recorded in the cells covered by its extents. Looking for the regions
+ * overlapping another one then only tests the regions sharing a cell with it
+ * instead of every region of the space.
+ *
+ * The cuts follow the distribution of the regions, so that the grid works
+ * whatever the range of values used by the federates. They are recomputed
+ * once the index has changed half as many times as it holds regions. Regions
+ * covering a large part of the grid are kept aside and tested on each query.
+ *
+ * Regions are only referenced, a copy of the index refers to the same regions.
+ */
+class CERTI_EXPORT RegionIndex {
+public:
+    typedef std::unordered_set<const BaseRegion*> RegionSet;
+
+    RegionIndex();
+
+    /** Add a region, or take into account the new extents of a known one. */
+    void update(const BaseRegion& region);
+
+    /** Forget a region, nothing is done if it is unknown. */
+    void remove(const BaseRegion& region);
+
+    bool contains(const BaseRegion& region) const;
+
+    size_t size() const;
+
+    /**
+     * Get the regions of the index which overlap the given one.
+     * The result of the last query on a region of the index is kept until
+     * the index changes, as the same region is usually matched once per
+     * attribute of an update.
+     */
+    const RegionSet& getOverlappingRegions(const BaseRegion& region) const;
+
+private:
+    typedef std::vector<uint32_t> Cells;
+
+    struct Entry {
+        bool large;
+        Cells cells;
+    };
+
+    /** Compute the cells covered by a region, @return false if it covers too many of them. */
+    bool computeCells(const BaseRegion& region, Cells& cells) const;
+
+    void add(const BaseRegion& region, Entry& entry);
+    void erase(const BaseRegion& region, const Entry& entry);
+    void changed();
+    void rebuild();
+
+    /// Cell i of axis d holds the values lower than my_cuts[d][i], the last one the others.
+    std::vector<uint32_t> my_cuts[2];
+    std::vector<RegionSet> my_cells;
+    RegionSet my_large;
+    std::unordered_map<const BaseRegion*, Entry> my_regions;
+
+    size_t my_changes;
+    uint64_t my_generation;
+
+    mutable const BaseRegion* my_cachedRegion;
+    mutable uint64_t my_cachedGeneration;
+    mutable RegionSet my_cachedResult;
+};
+
+} // namespace certi
+
+#endif // CERTI_REGION_INDEX_HH
@@ -22,6 +22,7 @@
 
 #include "Interaction.hh"
 #include "InteractionSet.hh"
+#include "M_Classes.hh"
 #include "NM_Classes.hh"
 #include "NameReservation.hh"
 #include "Object.hh"
@@ -357,6 +358,7 @@ RoutingSpace& RootObject::getRoutingSpace(SpaceHandle handle)
 void RootObject::addRegion(RTIRegion* region)
 {
     regions.push_back(region);
+    getRoutingSpace(region->getSpaceHandle()).getRegionIndex().update(*region);
 }
 
 RegionHandle RootObject::createRegion(SpaceHandle handle, unsigned long nb_extents)
@@ -372,6 +374,7 @@ void RootObject::modifyRegion(RegionHandle handle, const std::vector<Extent>& ex
 {
     RTIRegion* region = getRegion(handle);
     region->replaceExtents(extents);
+    getRoutingSpace(region->getSpaceHandle()).getRegionIndex().update(*region);
 }
 
 void RootObject::deleteRegion(RegionHandle region_handle)
@@ -383,9 +386,11 @@ void RootObject::deleteRegion(RegionHandle region_handle)
     }
 
     // TODO: check RegionInUse
-    regions.remove(*it);
-    regionHandles.free((*it)->getHandle());
-    delete *it;
+    RTIRegion* region = *it;
+    regions.erase(it);
+    getRoutingSpace(region->getSpaceHandle()).getRegionIndex().remove(*region);
+    regionHandles.free(region->getHandle());
+    delete region;
 }
 
 RTIRegion* RootObject::getRegion(RegionHandle handle)
@@ -791,6 +796,49 @@ void RootObject::convertToSerializedFOM(NM_Additional_Fom_Module& message)
     }
 }
 
+void RootObject::getFomNames(M_Join_Federation_Execution_V4& message) const
+{
+    const auto setName = [](FomName& fomName, const Handle owner, const Handle handle, const std::string& name) {
+        fomName.setOwner(owner);
+        fomName.setHandle(handle);
+        fomName.setName(name);
+    };
+
+    message.setObjectClassNamesSize(ObjectClasses->size());
+    message.setAttributeNamesSize(0);
+    uint32_t idx = 0;
+    for (auto i = ObjectClasses->handled_begin(); i != ObjectClasses->handled_end(); ++i, ++idx) {
+        const ObjectClass* objectClass = i->second;
+        setName(message.getObjectClassNames(idx), 0, objectClass->getHandle(), objectClass->getName());
+
+        for (const auto& attribute : objectClass->getHandleClassAttributeMap()) {
+            auto size = message.getAttributeNamesSize();
+            message.setAttributeNamesSize(size + 1);
+            setName(message.getAttributeNames(size),
+                    objectClass->getHandle(),
+                    attribute.second->getHandle(),
+                    attribute.second->getName());
+        }
+    }
+
+    message.setInteractionClassNamesSize(Interactions->size());
+    message.setParameterNamesSize(0);
+    idx = 0;
+    for (auto i = Interactions->handled_begin(); i != Interactions->handled_end(); ++i, ++idx) {
+        const Interaction* interactionClass = i->second;
+        setName(message.getInteractionClassNames(idx), 0, interactionClass->getHandle(), interactionClass->getName());
+
+        for (const auto& parameter : interactionClass->getHandleParameterMap()) {
+            auto size = message.getParameterNamesSize();
+            message.setParameterNamesSize(size + 1);
+            setName(message.getParameterNames(size),
+                    interactionClass->getHandle(),
+                    parameter.second->getHandle(),
+                    parameter.second->getName());
+        }
+    }
+}
+
 void RootObject::rebuildFromSerializedFOM(const NM_Join_Federation_Execution& message)
 {
     // The number of routing space records to read
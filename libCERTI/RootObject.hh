@@ -23,6 +23,7 @@
 #ifndef LIBCERTI_ROOT_OBJECT
 #define LIBCERTI_ROOT_OBJECT
 
+#include <deque>
 #include <vector>
 
 #include "HandleManager.hh"
@@ -46,6 +47,7 @@ class RTIRegion;
 class RoutingSpace;
 class NM_Join_Federation_Execution;
 class NM_Additional_Fom_Module;
+class M_Join_Federation_Execution_V4;
 
 /** The RootObject is literally the "root" object
  * of the HLA object class hierarchy.
@@ -115,6 +117,11 @@ public:
 
     void modifyRegion(RegionHandle, const std::vector<Extent>&);
 
+    const std::list<RTIRegion*>& getRegions() const
+    {
+        return regions;
+    }
+
     // Object Management
     bool reserveObjectInstanceName(FederateHandle the_federate, const std::string& the_object_name);
 
@@ -167,6 +174,12 @@ public:
      */
     void convertToSerializedFOM(NM_Additional_Fom_Module& message);
 
+    /**
+     * Set the names of the classes, attributes and parameters into the answer to a join request,
+     * with those inherited for each class.
+     */
+    void getFomNames(M_Join_Federation_Execution_V4& message) const;
+
     /**
      * Deserialize the federate object model from a message buffer.
      */
@@ -184,7 +197,8 @@ public:
     int getFreeSpaceHandle();
 
 private:
-    std::vector<RoutingSpace> spaces;
+    /// The regions refer to their space, it must not move when spaces are added.
+    std::deque<RoutingSpace> spaces;
     /**
      * The associated socket server.
      */
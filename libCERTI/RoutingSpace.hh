@@ -30,6 +30,7 @@
 #include "Extent.hh"
 #include "Handled.hh"
 #include "Named.hh"
+#include "RegionIndex.hh"
 
 // Standard headers
 #include <string>
@@ -88,8 +89,23 @@ public:
         return dimensions;
     }
 
+    /**
+     * Get the spatial index of the regions of this space.
+     * It is kept up to date by the RootObject owning the regions.
+     */
+    RegionIndex& getRegionIndex()
+    {
+        return regionIndex;
+    }
+
+    const RegionIndex& getRegionIndex() const
+    {
+        return regionIndex;
+    }
+
 private:
     std::vector<Dimension> dimensions;
+    RegionIndex regionIndex;
 };
 
 } // namespace certi
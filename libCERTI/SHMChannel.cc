@@ -0,0 +1,191 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+// ----------------------------------------------------------------------------
+
+#include "SHMChannel.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#include <sys/mman.h>
+
+#include <libHLA/SHMPosix.hh>
+
+#include "PrettyDebug.hh"
+
+namespace certi {
+
+static PrettyDebug D("SHMCHANNEL", __FILE__);
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "SHMChannel needs lock-free 64 bits atomics");
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "SHMChannel needs lock-free 32 bits atomics");
+
+/** Layout of one ring in the shared segment, followed by its data.
+ * Counters are only increased, the position in the data is counter % capacity.
+ * Each field has its own cache line so that the producer and the consumer do not share them.
+ */
+struct SHMChannel::Ring {
+    /// Bytes written so far, only modified by the producer.
+    alignas(64) std::atomic<uint64_t> head{0};
+    /// Bytes read so far, only modified by the consumer.
+    alignas(64) std::atomic<uint64_t> tail{0};
+    /// Set by a consumer about to wait, cleared by the producer which wakes it up.
+    alignas(64) std::atomic<uint32_t> waiting{0};
+    /// Set by a producer waiting for space, cleared by the consumer which wakes it up.
+    alignas(64) std::atomic<uint32_t> full{0};
+
+    unsigned char* data()
+    {
+        return reinterpret_cast<unsigned char*>(this + 1);
+    }
+};
+
+size_t SHMChannel::ringSize(const size_t capacity)
+{
+    // Keeps the second ring aligned as the first one
+    return alignof(Ring) * ((sizeof(Ring) + capacity + alignof(Ring) - 1) / alignof(Ring));
+}
+
+SHMChannel::SHMChannel(const std::string& name, const bool creator, const size_t capacity)
+    : my_name{name}
+    , my_creator{creator}
+    , my_capacity{capacity}
+    , my_shm{new libhla::ipc::SHMPosix(name, static_cast<int>(2 * ringSize(capacity)), creator)}
+{
+    my_shm->Open();
+    my_shm->Attach();
+
+    auto first = static_cast<unsigned char*>(my_shm->GetShm());
+    auto second = first + ringSize(capacity);
+
+    if (my_creator) {
+        my_outgoing = new (first) Ring();
+        my_incoming = new (second) Ring();
+    }
+    else {
+        my_outgoing = reinterpret_cast<Ring*>(second);
+        my_incoming = reinterpret_cast<Ring*>(first);
+
+        // Both sides are mapped now, the name is not needed anymore and must not outlive us
+        shm_unlink(my_name.c_str());
+    }
+
+    Debug(D, pdInit) << "Shared memory channel " << my_name << (my_creator ? " created" : " attached") << std::endl;
+}
+
+SHMChannel::~SHMChannel()
+{
+    if (my_creator) {
+        // The peer may never have attached, in which case the name is still there
+        shm_unlink(my_name.c_str());
+    }
+    munmap(my_shm->GetShm(), my_shm->GetSize());
+}
+
+size_t SHMChannel::write(const unsigned char* buffer, const size_t size, bool& woke_peer)
+{
+    woke_peer = false;
+
+    auto head = my_outgoing->head.load(std::memory_order_relaxed);
+    auto tail = my_outgoing->tail.load(std::memory_order_acquire);
+
+    auto count = std::min(size, static_cast<size_t>(my_capacity - (head - tail)));
+    if (count == 0) {
+        return 0;
+    }
+
+    auto offset = static_cast<size_t>(head % my_capacity);
+    auto first = std::min(count, my_capacity - offset);
+    memcpy(my_outgoing->data() + offset, buffer, first);
+    memcpy(my_outgoing->data(), buffer + first, count - first);
+
+    // seq_cst store and load pair with armWait, so that either we see the consumer waiting or it sees our data
+    my_outgoing->head.store(head + count, std::memory_order_seq_cst);
+    if (my_outgoing->waiting.load(std::memory_order_seq_cst) != 0) {
+        woke_peer = my_outgoing->waiting.exchange(0, std::memory_order_seq_cst) != 0;
+    }
+
+    return count;
+}
+
+size_t SHMChannel::read(unsigned char* buffer, const size_t size, bool& woke_peer)
+{
+    woke_peer = false;
+
+    auto tail = my_incoming->tail.load(std::memory_order_relaxed);
+    auto head = my_incoming->head.load(std::memory_order_acquire);
+
+    auto count = std::min(size, static_cast<size_t>(head - tail));
+    if (count == 0) {
+        return 0;
+    }
+
+    auto offset = static_cast<size_t>(tail % my_capacity);
+    auto first = std::min(count, my_capacity - offset);
+    memcpy(buffer, my_incoming->data() + offset, first);
+    memcpy(buffer + first, my_incoming->data(), count - first);
+
+    // seq_cst store and load pair with armFull, so that either we see the producer waiting or it sees the space
+    my_incoming->tail.store(tail + count, std::memory_order_seq_cst);
+    if (my_incoming->full.load(std::memory_order_seq_cst) != 0) {
+        woke_peer = my_incoming->full.exchange(0, std::memory_order_seq_cst) != 0;
+    }
+
+    return count;
+}
+
+bool SHMChannel::isDataReady() const
+{
+    return my_incoming->head.load(std::memory_order_acquire) != my_incoming->tail.load(std::memory_order_relaxed);
+}
+
+bool SHMChannel::armWait()
+{
+    my_incoming->waiting.store(1, std::memory_order_seq_cst);
+    return my_incoming->head.load(std::memory_order_seq_cst) != my_incoming->tail.load(std::memory_order_relaxed);
+}
+
+bool SHMChannel::disarmWait()
+{
+    return my_incoming->waiting.exchange(0, std::memory_order_seq_cst) == 0;
+}
+
+bool SHMChannel::armFull()
+{
+    my_outgoing->full.store(1, std::memory_order_seq_cst);
+    return my_outgoing->head.load(std::memory_order_relaxed) - my_outgoing->tail.load(std::memory_order_seq_cst)
+           < my_capacity;
+}
+
+bool SHMChannel::disarmFull()
+{
+    return my_outgoing->full.exchange(0, std::memory_order_seq_cst) == 0;
+}
+
+bool SHMChannel::isFullArmed() const
+{
+    return my_outgoing->full.load(std::memory_order_seq_cst) != 0;
+}
+
+const std::string& SHMChannel::getName() const
+{
+    return my_name;
+}
+
+} // namespace certi
@@ -0,0 +1,127 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_SHM_CHANNEL_HH
+#define CERTI_SHM_CHANNEL_HH
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <include/certi.hh>
+
+namespace libhla {
+namespace ipc {
+class SHM;
+}
+}
+
+namespace certi {
+
+/**
+ * Bidirectional byte stream between two processes over a POSIX shared memory segment.
+ *
+ * The segment holds two lock-free single producer/single consumer rings, one
+ * in each direction. The creator writes into the first ring and reads the
+ * second one, the other side does the opposite.
+ *
+ * The channel never blocks: waking up a consumer is left to the caller. A
+ * consumer about to sleep arms its incoming ring with armWait(); a producer
+ * which gets true from write() must then wake it up, e.g. by writing a byte on
+ * a socket the consumer is blocked on. A consumer which stops waiting calls
+ * disarmWait() to know whether such a wake up is on its way.
+ *
+ * A producer waiting for space in a full ring does the same with armFull()
+ * and disarmFull(), and is woken up by the consumer which gets true from read().
+ */
+class CERTI_EXPORT SHMChannel {
+public:
+    /// Default capacity of each ring, in bytes.
+    static constexpr size_t the_default_capacity{256 * 1024};
+
+    /** Create or attach to a channel.
+     * @param name the name of the shared memory segment, see SHM::buildShmName
+     * @param creator true to create the segment, false to attach to an existing one
+     * @param capacity the capacity of each ring, must be the same on both sides
+     */
+    SHMChannel(const std::string& name, const bool creator, const size_t capacity = the_default_capacity);
+
+    ~SHMChannel();
+
+    /** Copy as many bytes as the outgoing ring can take.
+     * @param[out] woke_peer set to true if the peer was waiting and must be woken up
+     * @return the number of bytes written
+     */
+    size_t write(const unsigned char* buffer, const size_t size, bool& woke_peer);
+
+    /** Copy at most size bytes from the incoming ring.
+     * @param[out] woke_peer set to true if the peer was waiting for space and must be woken up
+     * @return the number of bytes read
+     */
+    size_t read(unsigned char* buffer, const size_t size, bool& woke_peer);
+
+    /// True if the incoming ring holds some data.
+    bool isDataReady() const;
+
+    /** Announce that we are going to wait for data.
+     * @return true if data arrived meanwhile; the wait must then be cancelled with disarmWait()
+     */
+    bool armWait();
+
+    /** Cancel a wait announced by armWait().
+     * @return true if the peer saw the announcement and is waking us up
+     */
+    bool disarmWait();
+
+    /** Announce that we are going to wait for space in the outgoing ring.
+     * @return true if space was freed meanwhile; the wait must then be cancelled with disarmFull()
+     */
+    bool armFull();
+
+    /** Cancel a wait announced by armFull().
+     * @return true if the peer saw the announcement and is waking us up
+     */
+    bool disarmFull();
+
+    /// True while a wait announced by armFull() has not been seen by the peer.
+    bool isFullArmed() const;
+
+    const std::string& getName() const;
+
+private:
+    struct Ring;
+
+    /// Size of a ring and its data in the segment.
+    static size_t ringSize(const size_t capacity);
+
+    std::string my_name;
+    bool my_creator;
+    size_t my_capacity;
+
+    std::unique_ptr<libhla::ipc::SHM> my_shm;
+
+    Ring* my_outgoing;
+    Ring* my_incoming;
+};
+
+} // namespace certi
+
+#endif // CERTI_SHM_CHANNEL_HH
@@ -0,0 +1,96 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_SLAB_HH
+#define CERTI_SLAB_HH
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace certi {
+
+/**
+ * Storage for many instances of T, allocated by chunks of the_chunk_size.
+ *
+ * The instances never move, so pointers to them stay valid until they are
+ * destroyed, and the memory of a destroyed instance is given to the next one
+ * created. The memory is only released with the slab: its owner must destroy
+ * the instances still alive before.
+ */
+template <typename T>
+class Slab {
+public:
+    Slab() = default;
+
+    Slab(const Slab&) = delete;
+    Slab& operator=(const Slab&) = delete;
+
+    template <typename... Args>
+    T* create(Args&&... args)
+    {
+        void* block = take();
+        try {
+            return new (block) T(std::forward<Args>(args)...);
+        }
+        catch (...) {
+            my_free.push_back(block);
+            throw;
+        }
+    }
+
+    void destroy(T* instance)
+    {
+        instance->~T();
+        my_free.push_back(instance);
+    }
+
+    static constexpr std::size_t the_chunk_size{4096};
+
+private:
+    using Block = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    void* take()
+    {
+        if (!my_free.empty()) {
+            void* block = my_free.back();
+            my_free.pop_back();
+            return block;
+        }
+        if (my_chunks.empty() || my_used == the_chunk_size) {
+            my_chunks.emplace_back(new Block[the_chunk_size]);
+            my_used = 0;
+        }
+        return &my_chunks.back()[my_used++];
+    }
+
+    std::vector<std::unique_ptr<Block[]>> my_chunks{};
+    std::size_t my_used{0};
+    std::vector<void*> my_free{};
+};
+
+template <typename T>
+constexpr std::size_t Slab<T>::the_chunk_size;
+
+} // namespace certi
+
+#endif // CERTI_SLAB_HH
@@ -58,6 +58,14 @@ public:
 
     virtual void createConnection(const char* server_name, unsigned int port) = 0;
     virtual void send(const unsigned char*, size_t) = 0;
+
+    /** Send a message the peer can do without, such as a receive order update.
+     * A socket which queues its output may drop it rather than wait for a slow peer.
+     */
+    virtual void sendDroppable(const unsigned char* buffer, size_t size)
+    {
+        send(buffer, size);
+    }
     virtual void receive(void* Buffer, unsigned long Size) = 0;
     virtual void close() = 0;
 
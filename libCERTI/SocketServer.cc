@@ -24,12 +24,11 @@
 #include "PrettyDebug.hh"
 #include "SocketServer.hh"
 
-using std::list;
+#include <algorithm>
 
 namespace certi {
 static PrettyDebug G("GENDOC", __FILE__);
 
-// ----------------------------------------------------------------------------
 /** This method is called when the RTIG wants to initialize its
  *  FD_SET before doing a select. It will add all open socket to the set.
  *  \return the highest file descriptor in the FD_SET
@@ -38,10 +37,9 @@ int SocketServer::addToFDSet(fd_set* select_fdset)
 {
     int fd_max = 0;
 
-    list<SocketTuple*>::iterator i;
-    for (i = begin(); i != end(); ++i) {
-        if ((*i)->ReliableLink != NULL) {
-            int fd = (*i)->ReliableLink->returnSocket();
+    for (const auto& tuple : my_tuples) {
+        if (tuple->ReliableLink != NULL) {
+            int fd = tuple->ReliableLink->returnSocket();
             FD_SET(fd, select_fdset);
             fd_max = fd > fd_max ? fd : fd_max;
         }
@@ -49,6 +47,68 @@ int SocketServer::addToFDSet(fd_set* select_fdset)
     return fd_max;
 }
 
+#ifndef _WIN32
+void SocketServer::setOutputQueue(const size_t capacity, const SocketTCP::SlowConsumerPolicy policy)
+{
+    my_outputCapacity = capacity;
+    my_slowConsumerPolicy = policy;
+}
+
+bool SocketServer::flushOutput(std::vector<Socket*>& broken)
+{
+    bool pending = false;
+
+    for (const auto& tuple : my_tuples) {
+        auto link = tuple->ReliableLink;
+        if (link == NULL) {
+            continue;
+        }
+        if (link->hasPendingOutput()) {
+            pending = link->flush() || pending;
+        }
+        if (link->isBroken()) {
+            broken.push_back(link);
+        }
+    }
+    return pending;
+}
+
+bool SocketServer::flushOutput(const std::vector<Socket*>& links, std::vector<Socket*>& broken)
+{
+    bool pending = false;
+
+    std::unordered_set<const Socket*> flushed;
+    for (auto socket : links) {
+        auto it = my_tuplesBySocket.find(socket);
+        if (it == end(my_tuplesBySocket) || it->second->ReliableLink != socket || !flushed.insert(socket).second) {
+            continue;
+        }
+        auto link = it->second->ReliableLink;
+        if (link->hasPendingOutput()) {
+            pending = link->flush() || pending;
+        }
+        if (link->isBroken()) {
+            broken.push_back(link);
+        }
+    }
+    return pending;
+}
+
+int SocketServer::addToWriteFDSet(fd_set* select_fdset)
+{
+    int fd_max = 0;
+
+    for (const auto& tuple : my_tuples) {
+        if (tuple->ReliableLink != NULL && tuple->ReliableLink->hasPendingOutput()) {
+            int fd = tuple->ReliableLink->returnSocket();
+            FD_SET(fd, select_fdset);
+            fd_max = std::max(fd_max, fd);
+        }
+    }
+    return fd_max;
+}
+#endif
+
 void SocketServer::checkMessage(long socket_number, NetworkMessage* message) const
 {
     // G.Out(pdGendoc,"enter SocketServer::checkMessage");
@@ -88,19 +148,34 @@ void SocketServer::close(long socket, FederationHandle& federation_referenced, F
     federation_referenced = tuple->Federation;
     federate_referenced = tuple->Federate;
 
+#ifndef _WIN32
+    // Last chance for the answers still queued
+    tuple->ReliableLink->flush();
+#endif
+
+    my_tuplesBySocketDescriptor.erase(tuple->ReliableLink->returnSocket());
+    const bool attached = my_bestEffortLinks.erase(tuple->ReliableLink) > 0;
+    my_tuplesBySocket.erase(tuple->ReliableLink);
+    my_tuplesBySocket.erase(tuple->BestEffortLink);
+    if (attached) {
+        auto it = my_tuplesByBestEffortDescriptor.find(tuple->BestEffortLink->returnSocket());
+        if (it != end(my_tuplesByBestEffortDescriptor) && it->second == tuple) {
+            indexBestEffortDescriptor(it->first);
+        }
+    }
+
     // If the Tuple had no references, remove it, else just delete the socket.
     // Also, if no federate (no Join)
     if ((!tuple->Federation.isValid()) && tuple->Federate != 0) {
-        list<SocketTuple*>::iterator i;
-        list<SocketTuple*>::iterator tmp;
-        for (i = begin(); i != end(); ++i) {
-            if (((*i)->ReliableLink != NULL) && ((*i)->ReliableLink->returnSocket() == socket)) {
-                delete (*i);
-                i = erase(i); // i is dereferenced.
-                //tmp = erase(i); // i is dereferenced.
-                //i = tmp-- ; // loop will increment i ;
+        auto federation = my_tuplesByReferences.find(tuple->Federation);
+        if (federation != end(my_tuplesByReferences)) {
+            auto federate = federation->second.find(tuple->Federate);
+            if (federate != end(federation->second) && federate->second == tuple) {
+                federation->second.erase(federate);
             }
         }
+
+        my_tuples.remove_if([&](const std::unique_ptr<SocketTuple>& t) { return t.get() == tuple; });
     }
     else {
         tuple->ReliableLink->close();
@@ -114,7 +189,7 @@ void SocketServer::close(long socket, FederationHandle& federation_referenced, F
     }
 }
 
-SocketServer::SocketServer(SocketTCP* tcp_socket, SocketUDP* udp_socket) : list<SocketTuple*>()
+SocketServer::SocketServer(SocketTCP* tcp_socket, SocketUDP* udp_socket)
 {
     if (tcp_socket == NULL)
         throw RTIinternalError("");
@@ -125,11 +200,7 @@ SocketServer::SocketServer(SocketTCP* tcp_socket, SocketUDP* udp_socket) : list<
 
 SocketServer::~SocketServer()
 {
-    // Deleting remaining tuples.
-    while (!list<SocketTuple*>::empty()) {
-        delete front();
-        pop_front();
-    }
+    // Remaining tuples are deleted with my_tuples.
 }
 
 SocketTuple::SocketTuple(Socket* tcp_link) : Federation(0), Federate(0)
@@ -158,10 +229,9 @@ SocketTuple::~SocketTuple()
 
 Socket* SocketServer::getActiveSocket(fd_set* select_fdset) const
 {
-    list<SocketTuple*>::const_iterator i;
-    for (i = begin(); i != end(); ++i) {
-        if (((*i)->ReliableLink != NULL) && (FD_ISSET((*i)->ReliableLink->returnSocket(), select_fdset)))
-            return (*i)->ReliableLink;
+    for (const auto& tuple : my_tuples) {
+        if ((tuple->ReliableLink != NULL) && (FD_ISSET(tuple->ReliableLink->returnSocket(), select_fdset)))
+            return tuple->ReliableLink;
     }
 
     return NULL;
@@ -193,10 +263,12 @@ SocketServer::getSocketLink(FederationHandle the_federation, FederateHandle the_
 
 SocketTuple* SocketServer::getWithReferences(FederationHandle the_federation, FederateHandle the_federate) const
 {
-    list<SocketTuple*>::const_iterator i;
-    for (i = begin(); i != end(); ++i) {
-        if (((*i)->Federation == the_federation) && ((*i)->Federate == the_federate))
-            return (*i);
+    auto federation = my_tuplesByReferences.find(the_federation);
+    if (federation != end(my_tuplesByReferences)) {
+        auto federate = federation->second.find(the_federate);
+        if (federate != end(federation->second)) {
+            return federate->second;
+        }
     }
 
     throw FederateNotExecutionMember("Federate handle " + std::to_string(the_federate)
@@ -204,31 +276,67 @@ SocketTuple* SocketServer::getWithReferences(FederationHandle the_federation, Fe
                                      + std::to_string(the_federation.get()));
 }
 
-FederateHandle SocketServer::getFederateFromSocket(FederationHandle the_federation, Socket* socket) const
+Socket* SocketServer::getBestEffortLink(Socket* reliable_link) const
+{
+    auto it = my_bestEffortLinks.find(reliable_link);
+    if (it != end(my_bestEffortLinks)) {
+        return it->second;
+    }
+    return reliable_link;
+}
+
+Socket* SocketServer::getLinkOfDatagram(FederationHandle the_federation,
+                                        FederateHandle the_federate,
+                                        unsigned long the_address,
+                                        unsigned int the_port) const
 {
-    for (const auto& tuple : *this) {
-        if ((tuple->Federation == the_federation)
-            && (tuple->BestEffortLink == socket || tuple->ReliableLink == socket)) {
-            return tuple->Federate;
+    try {
+        SocketTuple* tuple = getWithReferences(the_federation, the_federate);
+        if (tuple->ReliableLink && tuple->BestEffortLink && tuple->BestEffortLink->isPeer(the_address, the_port)) {
+            return tuple->ReliableLink;
         }
     }
+    catch (FederateNotExecutionMember&) {
+    }
+    return NULL;
+}
+
+FederateHandle SocketServer::getFederateFromSocket(FederationHandle the_federation, Socket* socket) const
+{
+    auto it = my_tuplesBySocket.find(socket);
+    if (it != end(my_tuplesBySocket) && it->second->Federation == the_federation) {
+        return it->second->Federate;
+    }
 
     throw RTIinternalError("Federate not found.");
 }
 
 SocketTuple* SocketServer::getWithSocket(long socket_descriptor) const
 {
-    list<SocketTuple*>::const_iterator i;
-    for (i = begin(); i != end(); ++i) {
-        if (((*i)->ReliableLink != NULL) && ((*i)->ReliableLink->returnSocket() == socket_descriptor))
-            return (*i);
-        if (((*i)->BestEffortLink != NULL) && ((*i)->BestEffortLink->returnSocket() == socket_descriptor))
-            return (*i);
+    auto it = my_tuplesBySocketDescriptor.find(socket_descriptor);
+    if (it != end(my_tuplesBySocketDescriptor)) {
+        return it->second;
+    }
+    it = my_tuplesByBestEffortDescriptor.find(socket_descriptor);
+    if (it != end(my_tuplesByBestEffortDescriptor)) {
+        return it->second;
     }
 
     throw RTIinternalError("Socket not found.");
 }
 
+void SocketServer::indexBestEffortDescriptor(long socket_descriptor)
+{
+    my_tuplesByBestEffortDescriptor.erase(socket_descriptor);
+    for (const auto& tuple : my_tuples) {
+        if (tuple->ReliableLink != NULL && my_bestEffortLinks.count(tuple->ReliableLink) > 0
+            && tuple->BestEffortLink->returnSocket() == socket_descriptor) {
+            my_tuplesByBestEffortDescriptor[socket_descriptor] = tuple.get();
+            return;
+        }
+    }
+}
+
 void SocketServer::open()
 {
 #ifdef WITH_GSSAPI
@@ -241,16 +349,31 @@ void SocketServer::open()
         throw RTIinternalError("Could not allocate new socket.");
 
     newLink->accept(ServerSocketTCP);
+#ifndef _WIN32
+    if (my_outputCapacity > 0) {
+        newLink->setOutputQueue(my_outputCapacity, my_slowConsumerPolicy);
+    }
+#endif
 
-    SocketTuple* newTuple = new SocketTuple(newLink);
+    addLink(newLink);
+}
+
+void SocketServer::addLink(SocketTCP* link)
+{
+    SocketTuple* newTuple = new SocketTuple(link);
 
 #ifdef CERTI_RTIG_USE_EPOLL    
     addElementEpoll(newTuple->ReliableLink->returnSocket());
+    // The descriptor may be the one of a closed link which was watched for output
+    my_epollOutput.erase(newTuple->ReliableLink->returnSocket());
 #endif
     if (newTuple == NULL)
         throw RTIinternalError("Could not allocate new tuple.");
 
-    push_front(newTuple);
+    my_tuples.emplace_front(newTuple);
+    my_tuplesBySocketDescriptor[newTuple->ReliableLink->returnSocket()] = newTuple;
+    my_tuplesBySocket[newTuple->ReliableLink] = newTuple;
+    my_tuplesBySocket[newTuple->BestEffortLink] = newTuple;
 }
 
 void SocketServer::setReferences(long socket,
@@ -268,7 +391,18 @@ void SocketServer::setReferences(long socket,
 
     tuple->Federation = federation_reference;
     tuple->Federate = federate_reference;
+
+    // An RTIA listening on every interface is reached at the address it connected from
+    if (address == 0) {
+        address = tuple->ReliableLink->returnAdress();
+    }
     tuple->BestEffortLink->attach(ServerSocketUDP->returnSocket(), address, port);
+    // Messages too large for a datagram go through the reliable link
+    tuple->BestEffortLink->setFallback(tuple->ReliableLink);
+    my_bestEffortLinks[tuple->ReliableLink] = tuple->BestEffortLink;
+    indexBestEffortDescriptor(tuple->BestEffortLink->returnSocket());
+
+    my_tuplesByReferences[federation_reference][federate_reference] = tuple;
 }
 
 #ifdef CERTI_RTIG_USE_POLL
@@ -276,25 +410,24 @@ void SocketServer::constructPollList()
 {
 	struct pollfd pfd;
 	std::memset(&pfd, 0, sizeof(pfd));
-    list<SocketTuple*>::iterator i;
-    for (i = begin(); i != end(); ++i) {
-        if ((*i)->ReliableLink != NULL) {
-            int fd = (*i)->ReliableLink->returnSocket();
-            pfd.fd = fd;
-            pfd.events = POLLIN;
-            _SocketVector.push_back(pfd);
-            //std::cout << "constructPollList called !!! socket " << pfd.fd << std::endl;
+    for (const auto& tuple : my_tuples) {
+        if (tuple->ReliableLink == NULL) {
+            continue;
         }
+        pfd.fd = tuple->ReliableLink->returnSocket();
+        pfd.events = POLLIN;
+        if (tuple->ReliableLink->hasPendingOutput()) {
+            pfd.events |= POLLOUT;
+        }
+        _SocketVector.push_back(pfd);
     }
 }
 
 Socket* SocketServer::getSocketFromFileDescriptor(int fd)
 {
-    list<SocketTuple*>::const_iterator i;
-    for (i = begin(); i != end(); ++i) {
-        if (((*i)->ReliableLink != NULL) && ((*i)->ReliableLink->returnSocket()== fd))
-            return (*i)->ReliableLink;
-    }
+    auto it = my_tuplesBySocketDescriptor.find(fd);
+    if (it != end(my_tuplesBySocketDescriptor))
+        return it->second->ReliableLink;
 
     return NULL;
 }
@@ -304,25 +437,46 @@ Socket* SocketServer::getSocketFromFileDescriptor(int fd)
 void SocketServer::constructEpollList()
 {
 	struct epoll_event ev;
-    list<SocketTuple*>::iterator i;
-    for (i = begin(); i != end(); ++i) {
-        if ((*i)->ReliableLink != NULL) {
-            int fd = (*i)->ReliableLink->returnSocket();
+    for (const auto& tuple : my_tuples) {
+        if (tuple->ReliableLink == NULL) {
+            continue;
+        }
+        ev.data.fd = tuple->ReliableLink->returnSocket();
+        ev.events = EPOLLIN;
+        epoll_ctl(_Epollfd, EPOLL_CTL_ADD, ev.data.fd, &ev);
+        // We should handle error here ...
+        // errExit("epoll_ctl");
+    }
+}
+void SocketServer::updateEpollOutput()
+{
+    struct epoll_event ev;
+    for (const auto& tuple : my_tuples) {
+        if (tuple->ReliableLink == NULL) {
+            continue;
+        }
+        const int fd = tuple->ReliableLink->returnSocket();
+        const bool pending = tuple->ReliableLink->hasPendingOutput();
+        const bool watched = my_epollOutput.count(fd) > 0;
+        if (pending != watched) {
             ev.data.fd = fd;
-            ev.events = EPOLLIN;
-            epoll_ctl(_Epollfd, EPOLL_CTL_ADD, fd, &ev);
-			// We should handle error here ...
-			// errExit("epoll_ctl");
+            ev.events = pending ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+            epoll_ctl(_Epollfd, EPOLL_CTL_MOD, fd, &ev);
+            if (pending) {
+                my_epollOutput.insert(fd);
+            }
+            else {
+                my_epollOutput.erase(fd);
+            }
         }
     }
 }
+
 Socket* SocketServer::getSocketFromFileDescriptor(int fd)
 {
-    list<SocketTuple*>::const_iterator i;
-    for (i = begin(); i != end(); ++i) {
-        if (((*i)->ReliableLink != NULL) && ((*i)->ReliableLink->returnSocket()== fd))
-            return (*i)->ReliableLink;
-    }
+    auto it = my_tuplesBySocketDescriptor.find(fd);
+    if (it != end(my_tuplesBySocketDescriptor))
+        return it->second->ReliableLink;
 
     return NULL;
 }
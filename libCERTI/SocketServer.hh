@@ -33,6 +33,10 @@
 #include <include/certi.hh>
 
 #include <list>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #ifdef CERTI_RTIG_USE_POLL
 #include <poll.h>
 #endif
@@ -67,8 +71,12 @@ public:
  * CFederationSocketServer (l'interface de la liste precedente au
  * niveau de la federation et de ses objets, qui contient en plus des
  * fonctionnalites de securite)
+ *
+ * Tuples are indexed by file descriptor, by socket object and by
+ * (Federation, Federate) references, so that every lookup done while
+ * routing a message is constant time whatever the number of federates.
  */
-class CERTI_EXPORT SocketServer : private std::list<SocketTuple*> {
+class CERTI_EXPORT SocketServer {
 public:
     SocketServer(SocketTCP* tcp_socket, SocketUDP* udp_socket);
 
@@ -99,9 +107,34 @@ public:
                FederationHandle& federation_referenced, // Returned
                FederateHandle& federate_referenced); // Returned
 
+#ifndef _WIN32
+    /** Queue the output of the links accepted from now on.
+     * See SocketTCP::setOutputQueue, the capacity is per link.
+     */
+    void setOutputQueue(const size_t capacity, const SocketTCP::SlowConsumerPolicy policy);
+
+    /** Write the queued output of every link, without blocking.
+     * @param[out] broken filled with the links found broken, which must be closed
+     * @return true if some output is still queued, waiting for its link to be writable
+     */
+    bool flushOutput(std::vector<Socket*>& broken);
+
+    /** Write the queued output of the given links only, without blocking.
+     * Links which are not reliable links of the server are ignored.
+     * @param[out] broken filled with the links found broken, which must be closed
+     * @return true if some output is still queued, waiting for its link to be writable
+     */
+    bool flushOutput(const std::vector<Socket*>& links, std::vector<Socket*>& broken);
+
+    /// Add the links with queued output to the fd_set, returns the highest descriptor.
+    int addToWriteFDSet(fd_set* select_fdset);
+#endif
+
     /** Change the FederationHandle and the FederateHandle associated with
      * "socket". Once the references have been set for a Socket, they can't
      * be changed. References can be zeros(but should not).
+     * The best effort link is attached to the given UDP address and port, in
+     * network order; a null address stands for the one of the reliable link.
      * Throw RTIinternalError if the References have already been set, or
      * if the Socket is not found.
      */
@@ -151,6 +184,8 @@ public:
 
 #ifdef CERTI_RTIG_USE_EPOLL   
 	void constructEpollList();	
+    /// Watch the links with queued output for writability, and stop watching the others.
+    void updateEpollOutput();
 	void createEpollFd()
     {
 		_Epollfd = epoll_create( 0xCAFE );
@@ -189,8 +224,27 @@ public:
 
     SocketTuple* getWithReferences(FederationHandle the_federation, FederateHandle the_federate) const;
 
+    /** Best effort link of the federate using the given reliable link,
+     * the reliable link itself if the federate has none.
+     */
+    Socket* getBestEffortLink(Socket* reliable_link) const;
+
+    /** Reliable link of the federate which sent a datagram, found by the
+     * references of its message. Return NULL unless the datagram comes from
+     * the address and port, in network order, of the federate best effort link.
+     */
+    Socket* getLinkOfDatagram(FederationHandle the_federation,
+                              FederateHandle the_federate,
+                              unsigned long the_address,
+                              unsigned int the_port) const;
+
     FederateHandle getFederateFromSocket(FederationHandle the_federation, Socket* socket) const;
 
+    void ___TESTS_ONLY___open(SocketTCP* link)
+    {
+        addLink(link);
+    }
+
 private:
     // The Server socket object(used for Accepts)
     SocketTCP* ServerSocketTCP;
@@ -200,6 +254,38 @@ private:
     // -- Private Methods --
     // ---------------------
     SocketTuple* getWithSocket(long socket_descriptor) const;
+
+    /// Index the best effort descriptor again, from the first tuple of my_tuples still attached to it.
+    void indexBestEffortDescriptor(long socket_descriptor);
+
+    /// Allocate the SocketTuple of an accepted link and index it.
+    void addLink(SocketTCP* link);
+
+    /// Owns every tuple, including the ones whose links were closed.
+    std::list<std::unique_ptr<SocketTuple>> my_tuples;
+
+    /// Tuples with an open reliable link, by file descriptor. Only used for lookups, links are served in my_tuples order.
+    std::unordered_map<long, SocketTuple*> my_tuplesBySocketDescriptor;
+
+    /** Tuples with an attached best effort link, by its file descriptor.
+     * Links attached to the UDP socket of the server share its descriptor, which
+     * resolves to the first such tuple of my_tuples, as a scan of the list would.
+     */
+    std::unordered_map<long, SocketTuple*> my_tuplesByBestEffortDescriptor;
+
+    /// Tuples by reliable or best effort socket object.
+    std::unordered_map<const Socket*, SocketTuple*> my_tuplesBySocket;
+
+    /// Tuples whose references were set, by federation then federate.
+    std::unordered_map<FederationHandle, std::unordered_map<FederateHandle, SocketTuple*>> my_tuplesByReferences;
+
+    /// Attached best effort links, by reliable link; like the references, only changed by joins and closes.
+    std::unordered_map<const Socket*, SocketUDP*> my_bestEffortLinks;
+
+#ifndef _WIN32
+    size_t my_outputCapacity{0};
+    SocketTCP::SlowConsumerPolicy my_slowConsumerPolicy{SocketTCP::SlowConsumerPolicy::Block};
+#endif
     
     #ifdef CERTI_RTIG_USE_POLL
     // use with poll
@@ -209,6 +295,8 @@ private:
 	#ifdef CERTI_RTIG_USE_EPOLL
     // use with epoll
 	int _Epollfd;
+    /// Descriptors currently watched for writability.
+    std::unordered_set<int> my_epollOutput;
 	#endif
 };
 
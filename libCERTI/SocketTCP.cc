@@ -29,6 +29,8 @@
 #include <cstring>
 #include <iostream>
 #ifndef _WIN32
+#include <poll.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #endif
 
@@ -85,6 +87,14 @@ void SocketTCP::winsockShutdown()
 
 // ----------------------------------------------------------------------------
 SocketTCP::SocketTCP()
+#ifndef _WIN32
+    : my_outputCapacity(0)
+    , my_slowConsumerPolicy(SlowConsumerPolicy::Block)
+    , my_outputOffset(0)
+    , my_outputSize(0)
+    , my_broken(false)
+    , my_droppedCount(0)
+#endif
 {
     _socket_tcp = 0;
     _est_init_tcp = false;
@@ -123,6 +133,11 @@ SocketTCP::~SocketTCP()
     cout.width(9);
     cout << RcvdBytesCount << " Bytes received" << endl;
 #endif
+#ifndef _WIN32
+    if (my_droppedCount > 0) {
+        Debug(D, pdCom) << "TCP Socket " << _socket_tcp << " dropped " << my_droppedCount << " messages" << std::endl;
+    }
+#endif
 }
 
 // ----------------------------------------------------------------------------
@@ -303,6 +318,13 @@ void SocketTCP::send(const unsigned char* buffer, size_t size)
 
     assert(_est_init_tcp);
 
+#ifndef _WIN32
+    if (my_outputCapacity > 0) {
+        queue(buffer, size, false);
+        return;
+    }
+#endif
+
     Debug(D, pdDebug) << "Beginning to send TCP message..." << std::endl;
 
     while (total_sent < expected_size) {
@@ -340,6 +362,154 @@ void SocketTCP::send(const unsigned char* buffer, size_t size)
     SentBytesCount += total_sent;
 }
 
+// ----------------------------------------------------------------------------
+void SocketTCP::sendDroppable(const unsigned char* buffer, size_t size)
+{
+#ifndef _WIN32
+    if (my_outputCapacity > 0) {
+        queue(buffer, size, true);
+        return;
+    }
+#endif
+    send(buffer, size);
+}
+
+#ifndef _WIN32
+// ----------------------------------------------------------------------------
+void SocketTCP::setOutputQueue(const size_t capacity, const SlowConsumerPolicy policy)
+{
+    std::lock_guard<std::mutex> lock(my_outputMutex);
+
+    my_outputCapacity = capacity;
+    my_slowConsumerPolicy = policy;
+}
+
+// ----------------------------------------------------------------------------
+bool SocketTCP::hasPendingOutput() const
+{
+    return my_outputSize > 0;
+}
+
+// ----------------------------------------------------------------------------
+bool SocketTCP::flush()
+{
+    std::lock_guard<std::mutex> lock(my_outputMutex);
+
+    writeOutput();
+    return my_outputSize > 0;
+}
+
+// ----------------------------------------------------------------------------
+bool SocketTCP::isBroken() const
+{
+    return my_broken;
+}
+
+// ----------------------------------------------------------------------------
+void SocketTCP::queue(const unsigned char* buffer, const size_t size, const bool droppable)
+{
+    std::unique_lock<std::mutex> lock(my_outputMutex);
+
+    if (my_broken) {
+        // Nobody reads this socket anymore, it is about to be closed
+        return;
+    }
+
+    // A message larger than the whole queue is accepted when the queue is empty
+    if (!my_output.empty() && my_outputSize + size > my_outputCapacity) {
+        writeOutput();
+    }
+
+    while (!my_output.empty() && my_outputSize + size > my_outputCapacity) {
+        if (my_slowConsumerPolicy == SlowConsumerPolicy::Disconnect) {
+            breakOutput("output queue is full");
+            return;
+        }
+        if (droppable && my_slowConsumerPolicy == SlowConsumerPolicy::DropBestEffort) {
+            ++my_droppedCount;
+            Debug(D, pdDebug) << "Output queue of socket " << _socket_tcp << " is full, message dropped" << std::endl;
+            return;
+        }
+
+        // Wait for the peer to read some data, the other writers and flush() may go on meanwhile
+        lock.unlock();
+        struct pollfd peer = {_socket_tcp, POLLOUT, 0};
+        const bool failed = poll(&peer, 1, -1) < 0 && errno != EINTR;
+        lock.lock();
+        if (failed) {
+            breakOutput("poll failed");
+            return;
+        }
+        writeOutput();
+        if (my_broken) {
+            return;
+        }
+    }
+
+    my_output.emplace_back(buffer, buffer + size);
+    my_outputSize += size;
+}
+
+// ----------------------------------------------------------------------------
+void SocketTCP::writeOutput()
+{
+    static constexpr int the_max_buffers_per_write{64};
+
+    while (!my_output.empty()) {
+        struct iovec buffers[the_max_buffers_per_write];
+        int count = 0;
+        for (auto it = begin(my_output); it != end(my_output) && count < the_max_buffers_per_write; ++it, ++count) {
+            const size_t offset = (count == 0) ? my_outputOffset : 0;
+            buffers[count].iov_base = it->data() + offset;
+            buffers[count].iov_len = it->size() - offset;
+        }
+
+        struct msghdr message;
+        memset(&message, 0, sizeof(message));
+        message.msg_iov = buffers;
+        message.msg_iovlen = count;
+
+        // Same as writev, without blocking nor raising SIGPIPE
+        auto sent = ::sendmsg(_socket_tcp, &message, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                breakOutput(strerror(errno));
+            }
+            return;
+        }
+
+        Debug(D, pdTrace) << "Sent " << sent << " bytes out of " << my_outputSize << " queued" << std::endl;
+        SentBytesCount += sent;
+        my_outputSize -= sent;
+
+        while (sent > 0) {
+            const size_t left = my_output.front().size() - my_outputOffset;
+            if (static_cast<size_t>(sent) < left) {
+                my_outputOffset += sent;
+                break;
+            }
+            sent -= left;
+            my_output.pop_front();
+            my_outputOffset = 0;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+void SocketTCP::breakOutput(const char* reason)
+{
+    Debug(D, pdExcept) << "Giving up TCP socket " << _socket_tcp << ": " << reason << std::endl;
+
+    my_broken = true;
+    my_output.clear();
+    my_outputOffset = 0;
+    my_outputSize = 0;
+}
+#endif
+
 // ----------------------------------------------------------------------------
 void SocketTCP::close()
 {
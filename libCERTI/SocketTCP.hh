@@ -23,6 +23,13 @@
 #include "Socket.hh"
 #include <include/certi.hh>
 
+#ifndef _WIN32
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <vector>
+#endif
+
 // This is the read buffer of TCP sockets. It must be at least as long
 // as the longest data ever received by a socket.
 // If the next line is commented out, no buffer will be used at all.
@@ -39,9 +46,21 @@ namespace certi {
   data has already been read, and is waiting in the internal buffer.
   Therefore, before returning to a select loop, be sure to call the
   IsDataReady method to check whether any data is waiting for processing.
+
+  A socket can also queue its output, see setOutputQueue. Sends then only
+  copy the data, which is written later by flush, many messages at once.
 */
 class CERTI_EXPORT SocketTCP : public Socket {
 public:
+#ifndef _WIN32
+    /// What a socket does with a message which does not fit in its full output queue.
+    enum class SlowConsumerPolicy {
+        Block, ///< wait until the peer has read enough
+        DropBestEffort, ///< drop the messages the peer can do without, wait for the others
+        Disconnect ///< give up the peer, the socket is broken from now on
+    };
+#endif
+
     SocketTCP();
     virtual ~SocketTCP();
     virtual void close();
@@ -52,8 +71,35 @@ public:
 
     int accept(SocketTCP* server);
     virtual void send(const unsigned char*, size_t);
+    virtual void sendDroppable(const unsigned char*, size_t);
     virtual void receive(void* buffer, unsigned long size);
 
+#ifndef _WIN32
+    /** Queue the output instead of writing it at once.
+     * @param capacity the number of bytes the queue may hold, 0 to write at once again
+     * @param policy what to do when a message does not fit in the queue
+     */
+    void setOutputQueue(const size_t capacity, const SlowConsumerPolicy policy);
+
+    /// True if some queued output is not written yet.
+    bool hasPendingOutput() const;
+
+    /** Write as much queued output as the socket takes without blocking.
+     * Errors do not throw but break the socket, see isBroken.
+     * @return true if some output is still queued
+     */
+    bool flush();
+
+    /// True once the peer was found gone or given up as too slow; the socket must be closed.
+    bool isBroken() const;
+
+    void ___TESTS_ONLY___attach(const SOCKET fd)
+    {
+        _socket_tcp = fd;
+        _est_init_tcp = true;
+    }
+#endif
+
     virtual bool isDataReady() const;
 
     virtual unsigned long returnAdress() const;
@@ -86,6 +132,16 @@ private:
     in_port_t getPort() const;
     in_addr_t getAddr() const;
 
+#ifndef _WIN32
+    void queue(const unsigned char* buffer, const size_t size, const bool droppable);
+
+    /// Write queued output until done or the socket would block, my_outputMutex must be held.
+    void writeOutput();
+
+    /// Drop the queued output and mark the socket broken, my_outputMutex must be held.
+    void breakOutput(const char* reason);
+#endif
+
     SOCKET _socket_tcp;
 #ifdef _WIN32
     static int winsockInits;
@@ -93,6 +149,20 @@ private:
     bool _est_init_tcp;
     struct sockaddr_in _sockIn;
 
+#ifndef _WIN32
+    size_t my_outputCapacity;
+    SlowConsumerPolicy my_slowConsumerPolicy;
+
+    std::mutex my_outputMutex;
+    std::deque<std::vector<unsigned char>> my_output;
+    /// Bytes of the first queued message already written.
+    size_t my_outputOffset;
+    /// Queued bytes not written yet, read without the mutex by hasPendingOutput.
+    std::atomic<size_t> my_outputSize;
+    std::atomic<bool> my_broken;
+    ByteCount_t my_droppedCount;
+#endif
+
 #ifdef SOCKTCP_BUFFER_LENGTH
     // This class can use a buffer to reduce the number of systems calls
     // when reading a lot of small amouts of data. Each time a Receive
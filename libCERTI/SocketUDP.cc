@@ -20,6 +20,7 @@
 #include "PrettyDebug.hh"
 #include "SocketUDP.hh"
 #include "certi.hh"
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -41,6 +42,20 @@ namespace certi {
 
 static PrettyDebug D("SOCKUDP", "(SocketUDP) - ");
 
+constexpr size_t SocketUDP::the_max_datagram_size;
+constexpr size_t SocketUDP::the_default_datagram_size;
+
+namespace {
+size_t readMaxDatagramSize()
+{
+    const char* value = getenv("CERTI_UDP_MAX_DATAGRAM");
+    if (!value || !*value) {
+        return SocketUDP::the_default_datagram_size;
+    }
+    return std::min(static_cast<size_t>(strtoul(value, nullptr, 10)), SocketUDP::the_max_datagram_size);
+}
+}
+
 // ----------------------------------------------------------------------------
 void SocketUDP::attach(int socket_ouvert, unsigned long Adresse, unsigned int port)
 {
@@ -52,7 +67,7 @@ void SocketUDP::attach(int socket_ouvert, unsigned long Adresse, unsigned int po
     // Building Distant Address
     memset((struct sockaddr_in*) &sock_distant, 0, sizeof(struct sockaddr_in));
 
-    sock_distant.sin_addr.s_addr = htonl(Adresse);
+    sock_distant.sin_addr.s_addr = Adresse;
     sock_distant.sin_family = AF_INET;
     sock_distant.sin_port = port;
 
@@ -73,12 +88,8 @@ int SocketUDP::bind()
 
 // ----------------------------------------------------------------------------
 //! Create an UDP client.
-void SocketUDP::createConnection(const char* /*server_name*/, unsigned int /*port*/)
+void SocketUDP::createConnection(const char* server_name, unsigned int port)
 {
-    struct sockaddr_in sock_temp;
-    char localhost[4096];
-    struct hostent* hp_local;
-
 #ifdef _WIN32 //netDot
     int taille = sizeof(struct sockaddr_in);
 #else
@@ -87,21 +98,18 @@ void SocketUDP::createConnection(const char* /*server_name*/, unsigned int /*por
 
     assert(!_est_init_udp);
 
-    // Building Local Address
-    memset(&sock_local, 0, sizeof(struct sockaddr_in));
-    hp_local = NULL;
-
-    gethostname(localhost, 4096);
-
-    if ((hp_local = gethostbyname(localhost)) == NULL) {
-        throw NetworkError("gethostbyname gave NULL answer for hostname <" + std::string(localhost) + "> with error <"
-                           + strerror(errno)
-                           + ">");
-    }
+    // Building Distant Address
+    in_addr_t server_addr;
+    host2addr(server_name, server_addr);
 
-    memcpy((char*) &sock_local.sin_addr, (char*) hp_local->h_addr, hp_local->h_length);
+    memset(&sock_distant, 0, sizeof(struct sockaddr_in));
+    sock_distant.sin_addr.s_addr = server_addr;
+    sock_distant.sin_family = AF_INET;
+    sock_distant.sin_port = htons((u_short) port);
 
-    // lors du BIND, le systeme alloue un port libre au socket _sock_udp
+    // Building Local Address, the server answers on the interface it is reached from
+    memset(&sock_local, 0, sizeof(struct sockaddr_in));
+    sock_local.sin_addr.s_addr = INADDR_ANY;
     sock_local.sin_family = AF_INET;
     sock_local.sin_port = 0;
 
@@ -114,8 +122,8 @@ void SocketUDP::createConnection(const char* /*server_name*/, unsigned int /*por
     }
 
     // recuperation du port lie au socket _socket_udp
+    struct sockaddr_in sock_temp;
     getsockname(_socket_udp, (sockaddr*) &sock_temp, &taille);
-    //HPUX: getsockname(_socket_udp, (sockaddr *)&sock_temp, (int*)&taille);
     sock_local.sin_port = sock_temp.sin_port;
     _est_init_udp = true;
 }
@@ -141,6 +149,16 @@ void SocketUDP::createServer(unsigned int port, in_addr_t addr)
         throw NetworkError("Cannot bind UDP Socket" + std::string(strerror(errno)));
     }
 
+    // The port chosen by the system when none is given
+    struct sockaddr_in sock_temp;
+#ifdef _WIN32
+    int taille = sizeof(struct sockaddr_in);
+#else
+    socklen_t taille = sizeof(struct sockaddr_in);
+#endif
+    getsockname(_socket_udp, (sockaddr*) &sock_temp, &taille);
+    sock_local.sin_port = sock_temp.sin_port;
+
     _est_init_udp = true;
 }
 
@@ -153,18 +171,16 @@ SocketUDP::SocketUDP()
 
     memset(&sock_local, 0, sizeof(struct sockaddr_in));
     memset(&sock_source, 0, sizeof(struct sockaddr_in));
-    Addr_Source = NULL;
-    Port_Source = 0;
-
     memset(&sock_distant, 0, sizeof(struct sockaddr_in));
-    hp_distant = NULL;
 
-    _sock_local_length = 0;
     _est_init_udp = false;
 
     SentBytesCount = 0;
     RcvdBytesCount = 0;
-    BufferSize = 0;
+
+    my_fallback = nullptr;
+    my_maxDatagramSize = readMaxDatagramSize();
+    my_datagramOffset = 0;
 
 #ifdef _WIN32 //netDot
     SocketTCP::winsockStartup();
@@ -199,6 +215,13 @@ SocketUDP::~SocketUDP()
 // ----------------------------------------------------------------------------
 void SocketUDP::send(const unsigned char* Message, size_t Size)
 {
+    if (my_fallback && Size > my_maxDatagramSize) {
+        Debug(D, pdDebug) << "Message of " << Size << " bytes too large for a datagram, sent through fallback link"
+                          << std::endl;
+        my_fallback->send(Message, Size);
+        return;
+    }
+
     Debug(D, pdDebug) << "Beginning to send UDP message... Size = " << Size << std::endl;
     assert(_est_init_udp);
 
@@ -211,6 +234,16 @@ void SocketUDP::send(const unsigned char* Message, size_t Size)
     SentBytesCount += sent;
 }
 
+// ----------------------------------------------------------------------------
+void SocketUDP::sendDroppable(const unsigned char* Message, size_t Size)
+{
+    if (my_fallback && Size > my_maxDatagramSize) {
+        my_fallback->sendDroppable(Message, Size);
+        return;
+    }
+    send(Message, Size);
+}
+
 // ----------------------------------------------------------------------------
 void SocketUDP::close()
 {
@@ -248,7 +281,7 @@ unsigned int SocketUDP::getPort() const
 */
 bool SocketUDP::isDataReady() const
 {
-    return BufferSize > 0;
+    return my_datagramOffset < my_datagram.size();
 }
 
 // ----------------------------------------------------------------------------
@@ -271,33 +304,77 @@ void SocketUDP::receive(void* Message, unsigned long Size)
     socklen_t taille = sizeof(struct sockaddr_in);
 #endif
 
-    int CR;
-
     assert(_est_init_udp);
 
     Debug(D, pdDebug) << "Beginning to receive UDP message..." << std::endl;
-    if (BufferSize == 0) {
-        CR = recvfrom(_socket_udp, Buffer, BUFFER_MAXSIZE, 0, (struct sockaddr*) &sock_source, &taille);
+    if (!isDataReady()) {
+        my_datagram.resize(the_max_datagram_size);
+        const int CR
+            = recvfrom(_socket_udp, my_datagram.data(), my_datagram.size(), 0, (struct sockaddr*) &sock_source, &taille);
         //HPUX:(struct sockaddr *)&sock_source, (int*) &taille);
-        if (CR <= 0) {
+        if (CR < 0) {
+            my_datagram.clear();
             perror("Recvfrom");
             throw NetworkError("cannot recvfrom");
         }
-        else {
-            RcvdBytesCount += CR;
-            BufferSize += CR;
-        }
+        RcvdBytesCount += CR;
+        my_datagram.resize(CR);
+        my_datagramOffset = 0;
     }
 
-    if (BufferSize < Size) {
-        perror("Taille du Buffer inferieure a celle demandee");
-        throw NetworkError("");
-    }
-    else {
-        BufferSize -= Size;
-        memcpy(Message, (void*) Buffer, Size);
-        memmove((void*) Buffer, (void*) (Buffer + Size), BufferSize);
+    if (my_datagram.size() - my_datagramOffset < Size) {
+        const auto dropped = dropDatagram();
+        Debug(D, pdExcept) << "Datagram of " << dropped << " bytes left too short for " << Size << std::endl;
+        throw NetworkError("Datagram shorter than its message");
     }
+
+    memcpy(Message, my_datagram.data() + my_datagramOffset, Size);
+    my_datagramOffset += Size;
+}
+
+// ----------------------------------------------------------------------------
+size_t SocketUDP::dropDatagram()
+{
+    const size_t dropped = my_datagram.size() - my_datagramOffset;
+    my_datagram.clear();
+    my_datagramOffset = 0;
+    return dropped;
+}
+
+// ----------------------------------------------------------------------------
+void SocketUDP::setFallback(Socket* link)
+{
+    my_fallback = link;
+}
+
+// ----------------------------------------------------------------------------
+size_t SocketUDP::getMaxDatagramSize() const
+{
+    return my_maxDatagramSize;
+}
+
+// ----------------------------------------------------------------------------
+void SocketUDP::setMaxDatagramSize(const size_t size)
+{
+    my_maxDatagramSize = std::min(size, the_max_datagram_size);
+}
+
+// ----------------------------------------------------------------------------
+bool SocketUDP::isPeer(const unsigned long address, const unsigned int port) const
+{
+    return _est_init_udp && sock_distant.sin_addr.s_addr == address && sock_distant.sin_port == port;
+}
+
+// ----------------------------------------------------------------------------
+unsigned long SocketUDP::getSourceAddr() const
+{
+    return sock_source.sin_addr.s_addr;
+}
+
+// ----------------------------------------------------------------------------
+unsigned int SocketUDP::getSourcePort() const
+{
+    return sock_source.sin_port;
 }
 
 // ----------------------------------------------------------------------------
@@ -22,17 +22,33 @@
 
 #include "Socket.hh"
 
-#define BUFFER_MAXSIZE 2000
+#include <vector>
 
 namespace certi {
 
+/** UDP socket, each send is one datagram.
+ *
+ * Receives are served from the last datagram read: when it is used up the
+ * next one is read. A receive asking for more than what is left of the
+ * datagram drops it and throws NetworkError, so that a truncated or garbled
+ * datagram never spills over the next one.
+ */
 class CERTI_EXPORT SocketUDP : public Socket {
 public:
+    /// Largest payload of an IPv4 datagram.
+    static constexpr size_t the_max_datagram_size{65507};
+
+    /** Datagram size used unless CERTI_UDP_MAX_DATAGRAM is set: an Ethernet
+     * frame less the IP and UDP headers, so that datagrams are not fragmented.
+     */
+    static constexpr size_t the_default_datagram_size{1472};
+
     SocketUDP();
     virtual ~SocketUDP();
 
     // Socket
     virtual void send(const unsigned char*, size_t);
+    virtual void sendDroppable(const unsigned char*, size_t);
 
     virtual void receive(void* Message, unsigned long Size);
 
@@ -44,15 +60,42 @@ public:
     virtual void close();
 
     // SocketUDP
+    /// Bind to an ephemeral port on every interface, and send to the given server.
     virtual void createConnection(const char* server_name, unsigned int port);
 
+    /// Bind to the given port, or to one chosen by the system if 0.
     void createServer(unsigned int port, in_addr_t addr = INADDR_ANY);
 
+    /** Send through an opened socket to a peer.
+     * @param address the peer address, in network order
+     * @param port the peer port, in network order
+     */
     void attach(int socket_ouvert, unsigned long Adresse, unsigned int port);
 
+    /// Port of the socket, in network order.
     unsigned int getPort() const;
+    /// Address the socket is bound to, in network order; 0 for every interface.
     unsigned long getAddr() const;
 
+    /** Send the messages larger than the maximum datagram size through another link.
+     * Without one, they are sent as a single datagram anyway.
+     */
+    void setFallback(Socket* link);
+
+    size_t getMaxDatagramSize() const;
+    void setMaxDatagramSize(const size_t size);
+
+    /// True if the socket sends to the given address and port, in network order.
+    bool isPeer(const unsigned long address, const unsigned int port) const;
+
+    /// Address of the sender of the last datagram read, in network order.
+    unsigned long getSourceAddr() const;
+    /// Port of the sender of the last datagram read, in network order.
+    unsigned int getSourcePort() const;
+
+    /// Drop what is left of the last datagram read, @return the number of bytes dropped.
+    size_t dropDatagram();
+
 private:
     void setPort(unsigned int port);
 
@@ -65,19 +108,19 @@ private:
     struct sockaddr_in sock_local;
 
     struct sockaddr_in sock_source;
-    char* Addr_Source;
-    unsigned int Port_Source;
     struct sockaddr_in sock_distant;
-    struct hostent* hp_distant;
 
-    int _sock_local_length;
     bool _est_init_udp;
 
     ByteCount_t SentBytesCount;
     ByteCount_t RcvdBytesCount;
 
-    unsigned long BufferSize;
-    char Buffer[4096];
+    Socket* my_fallback;
+    size_t my_maxDatagramSize;
+
+    /// The last datagram read, of which my_datagramOffset bytes were received.
+    std::vector<char> my_datagram;
+    size_t my_datagramOffset;
 };
 
 } // namespace certi
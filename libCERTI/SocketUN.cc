@@ -26,10 +26,17 @@
 #include <cstdio>
 #include <cstring>
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <string>
+#include <thread>
 #ifndef _WIN32
 #include <unistd.h>
+
+#include <libHLA/SHM.hh>
+
+#include "SHMChannel.hh"
 #endif
 
 using std::string;
@@ -177,7 +184,13 @@ int SocketUN::socketpair()
 // ----------------------------------------------------------------------------
 //! Does not open the socket, see Init methods.
 SocketUN::SocketUN(SignalHandlerType theType)
-    : _socket_un(-1), HandlerType(theType), SentBytesCount(0), RcvdBytesCount(0)
+    : _socket_un(-1)
+    , HandlerType(theType)
+    , SentBytesCount(0)
+    , RcvdBytesCount(0)
+#ifndef _WIN32
+    , _armed(false)
+#endif
 {
 #ifdef _WIN32
     SocketTCP::winsockStartup();
@@ -222,6 +235,26 @@ void SocketUN::send(const unsigned char* buffer, size_t size)
 
     Debug(D, pdTrace) << "Beginning to send UN message..." << std::endl;
 
+#ifndef _WIN32
+    if (_channel) {
+        while (total_sent < size) {
+            bool woke_peer;
+            sent = _channel->write(buffer + total_sent, size - total_sent, woke_peer);
+            total_sent += sent;
+
+            if (woke_peer) {
+                wakeUpPeer();
+            }
+
+            if (sent == 0) {
+                waitForSpace();
+            }
+        }
+        SentBytesCount += total_sent;
+        return;
+    }
+#endif
+
     while (total_sent < size) {
 #ifdef _WIN32
         sent = ::send(_socket_un, (char*) buffer + total_sent, size - total_sent, 0);
@@ -278,6 +311,23 @@ void SocketUN::error(const char* msg)
 */
 bool SocketUN::isDataReady()
 {
+#ifndef _WIN32
+    if (_channel) {
+        if (!_backlog.empty() || _channel->isDataReady()) {
+            settle();
+            return true;
+        }
+        if (!_armed) {
+            // From now on the peer rings the socket, so that a select on it wakes up
+            _armed = true;
+            if (_channel->armWait()) {
+                settle();
+                return true;
+            }
+        }
+        return false;
+    }
+#endif
 #ifdef SOCKUN_BUFFER_LENGTH
     return RBLength > 0;
 #else
@@ -307,6 +357,48 @@ void SocketUN::receive(const unsigned char* buffer, size_t Size)
 
     Debug(D, pdTrace) << "Beginning to receive U/W message, size " << Size << std::endl;
 
+#ifndef _WIN32
+    if (_channel) {
+        settle();
+
+        size_t total_received = std::min(Size, _backlog.size());
+        if (total_received > 0) {
+            memcpy(const_cast<unsigned char*>(buffer), _backlog.data(), total_received);
+            _backlog.erase(begin(_backlog), begin(_backlog) + total_received);
+        }
+        while (total_received < Size) {
+            bool woke_peer;
+            const auto received = _channel->read(
+                const_cast<unsigned char*>(buffer) + total_received, Size - total_received, woke_peer);
+            total_received += received;
+
+            if (woke_peer) {
+                wakeUpPeer();
+            }
+
+            if (received == 0 && spin()) {
+                continue;
+            }
+            if (received == 0) {
+                _armed = true;
+                if (_channel->armWait()) {
+                    settle();
+                }
+                else {
+                    if (!waitWakeUp()) {
+                        Debug(D, pdExcept) << "UN connection has been closed by peer." << std::endl;
+                        throw NetworkError("Connection closed by client.");
+                    }
+                    _armed = false;
+                }
+            }
+        }
+        RcvdBytesCount += total_received;
+        Debug(D, pdTrace) << "Received " << total_received << " bytes out of " << Size << std::endl;
+        return;
+    }
+#endif
+
     while (RBLength < Size) {
 #ifdef _WIN32
 #ifdef SOCKUN_BUFFER_LENGTH
@@ -361,4 +453,124 @@ void SocketUN::receive(const unsigned char* buffer, size_t Size)
     // G.Out(pdGendoc,"exit  SocketUN::receive");
 }
 
+#ifndef _WIN32
+// ----------------------------------------------------------------------------
+void SocketUN::useSharedMemory(const std::string& name, const bool creator)
+{
+    assert(0 <= _socket_un);
+
+    _channel.reset(new SHMChannel(name, creator));
+    _armed = false;
+
+    Debug(D, pdInit) << "UN socket " << _socket_un << " now carries data over shared memory " << name << std::endl;
+}
+
+// ----------------------------------------------------------------------------
+std::string SocketUN::buildSharedMemoryName()
+{
+    static std::atomic<unsigned> counter{0};
+
+    return libhla::ipc::SHM::buildShmName("CERTI_UN_" + std::to_string(getpid()) + "_"
+                                          + std::to_string(counter++));
+}
+
+// ----------------------------------------------------------------------------
+bool SocketUN::spin()
+{
+    // Answers usually come within a few microseconds, which is cheaper to wait for than a wake up,
+    // unless the peer needs our processor to answer
+    static const int the_spin_count{std::thread::hardware_concurrency() > 1 ? 2000 : 0};
+    for (int i{0}; i < the_spin_count; ++i) {
+        if (_channel->isDataReady()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+bool SocketUN::waitWakeUp(const bool interruptible)
+{
+    char wake_up;
+    long nReceived;
+    while ((nReceived = read(_socket_un, &wake_up, 1)) < 0) {
+        if (errno != EINTR) {
+            perror("UN Socket(RecevoirUN) : ");
+            throw NetworkError("Error while receiving UN message.");
+        }
+        if (interruptible && HandlerType == stSignalInterrupt) {
+            // Still armed, the wake up will be consumed by the next call
+            throw NetworkSignal("");
+        }
+    }
+    return nReceived == 1;
+}
+
+// ----------------------------------------------------------------------------
+void SocketUN::settle()
+{
+    if (!_armed) {
+        return;
+    }
+    if (_channel->disarmWait() && !waitWakeUp()) {
+        throw NetworkError("Connection closed by client.");
+    }
+    _armed = false;
+}
+
+// ----------------------------------------------------------------------------
+void SocketUN::wakeUpPeer()
+{
+    // Never interrupted: the peer waits for this byte and would not see the ring change
+    const char wake_up = 0;
+    while (write(_socket_un, &wake_up, 1) != 1) {
+        if (errno != EINTR) {
+            perror("UN Socket(EmettreUN) : ");
+            throw NetworkError("Error while waking up UN peer.");
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+void SocketUN::drain()
+{
+    unsigned char buffer[4096];
+    size_t received;
+    bool woke_peer;
+    while ((received = _channel->read(buffer, sizeof(buffer), woke_peer)) > 0) {
+        _backlog.insert(end(_backlog), buffer, buffer + received);
+        if (woke_peer) {
+            wakeUpPeer();
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+void SocketUN::waitForSpace()
+{
+    // Both peers may fill their rings at once: taking what the peer sent lets it go on and read ours
+    drain();
+
+    if (_channel->armFull()) {
+        if (_channel->disarmFull() && !waitWakeUp(false)) {
+            throw NetworkError("Connection closed by client.");
+        }
+        return;
+    }
+
+    // The peer clears the flag before ringing, any other wake up is for the data we may wait for
+    // Never interrupted either, part of the message is already in the ring
+    while (_channel->isFullArmed()) {
+        if (!waitWakeUp(false)) {
+            Debug(D, pdExcept) << "No data could be sent, connection closed?." << std::endl;
+            throw NetworkError("Could not send any data on UN socket.");
+        }
+        if (_channel->isFullArmed()) {
+            _armed = false;
+            drain();
+        }
+    }
+}
+#endif
+
 } // namespace certi
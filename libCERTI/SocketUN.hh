@@ -24,7 +24,14 @@
 #include "Socket.hh"
 #include "SocketTCP.hh"
 
+#include <memory>
+#include <vector>
+
 namespace certi {
+#ifndef _WIN32
+class SHMChannel;
+#endif
+
 // Signal Handler Types for a UNIX socket : - stSignalInterrupt :
 // return when read/write operation is interrupted by a signal. The
 // RW operation may not be complete. - stSignalIgnore : Ignore
@@ -51,6 +58,11 @@ typedef enum { stSignalInterrupt, stIgnoreSignal } SignalHandlerType;
  * data has already been read, and is waiting in the internal buffer.
  * Therefore, before returning to a select loop, be sure to call the
  * IsDataReady method to check whether any data is waiting for processing.
+ *
+ * Once useSharedMemory() has been called on both ends, data is carried by a
+ * shared memory channel and the socket only carries one byte wake ups when
+ * the reader waits for data, or the writer for space. The socket can still be used in a select loop,
+ * as long as IsDataReady is checked before going to sleep.
  */
 class CERTI_EXPORT SocketUN {
 public:
@@ -74,6 +86,18 @@ public:
     void send(const unsigned char*, size_t);
     void receive(const unsigned char*, size_t);
 
+#ifndef _WIN32
+    /** Carry further data over a shared memory channel.
+     * The creator must call it before the peer, both on a connected socket.
+     * @param name the name of the segment, see buildSharedMemoryName
+     * @param creator true on the end which creates the segment
+     */
+    void useSharedMemory(const std::string& name, const bool creator);
+
+    /// Build a segment name unique to this process.
+    static std::string buildSharedMemoryName();
+#endif
+
 protected:
     void error(const char*);
 
@@ -87,6 +111,27 @@ private:
     Socket::ByteCount_t SentBytesCount;
     Socket::ByteCount_t RcvdBytesCount;
 
+#ifndef _WIN32
+    /// Poll the channel for a short while, returns true if data arrived.
+    bool spin();
+    /// Wait for a wake up on the socket, returns false on end of file.
+    bool waitWakeUp(const bool interruptible = true);
+    /// Cancel an announced wait, consuming the wake up if it was sent.
+    void settle();
+    /// Wake the peer up through the socket.
+    void wakeUpPeer();
+    /// Move what the peer sent to the backlog, letting a peer waiting for space go on.
+    void drain();
+    /// Wait for space in the outgoing ring, draining the incoming one meanwhile.
+    void waitForSpace();
+
+    std::unique_ptr<SHMChannel> _channel;
+    /// True when the peer may be told to wake us up through the socket.
+    bool _armed;
+    /// Data drained from the channel while waiting for space, received first.
+    std::vector<unsigned char> _backlog;
+#endif
+
 #ifdef SOCKUN_BUFFER_LENGTH
     // This class can use a buffer to reduce the number of systems
     // calls when reading a lot of small amouts of data. Each time a
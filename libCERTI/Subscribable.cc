@@ -21,9 +21,9 @@
 // ----------------------------------------------------------------------------
 
 #include "InteractionBroadcastList.hh"
-#include "ObjectClassBroadcastList.hh"
 #include "PrettyDebug.hh"
 #include "RTIRegion.hh"
+#include "RoutingSpace.hh"
 #include "Subscribable.hh"
 #include "helper.hh"
 
@@ -154,17 +154,31 @@ void Subscribable::subscribe(FederateHandle fed, const RTIRegion* region)
 }
 
 // ----------------------------------------------------------------------------
-/** Add federates and associated attribute to a broadcast list.
-    @param lst Broadcast list where federates/handles should be added
-    @param region Region to check for overlap
-    @param handle Handle of this object (Subscribable subclass)
+/** Give the subscribers matching (overlapping) a region, see Subscriber::match.
+    The regions overlapping the given one are found once by the spatial index
+    of its routing space, the subscribers are then matched by a lookup.
+    @param region Region to check for overlap (0 for default region)
+    @param add Called with the handle of each matching subscriber
  */
-void Subscribable::addFederatesIfOverlap(ObjectClassBroadcastList& lst, const RTIRegion* region, Handle handle) const
-{
-    std::list<Subscriber>::const_iterator it = subscribers.begin();
-    for (; it != subscribers.end(); ++it) {
-        if (it->match(region))
-            lst.addFederate(it->getHandle(), handle);
+template <typename Add>
+void Subscribable::forEachOverlappingSubscriber(const RTIRegion* region, Add add) const
+{
+    if (region == 0) {
+        for (const auto& subscriber : subscribers) {
+            add(subscriber.getHandle());
+        }
+        return;
+    }
+
+    const RegionIndex& index = region->getRoutingSpace().getRegionIndex();
+    const RegionIndex::RegionSet& overlapping = index.getOverlappingRegions(*region);
+
+    for (const auto& subscriber : subscribers) {
+        const RTIRegion* r = subscriber.getRegion();
+        // Regions not created through the RootObject are not in the index
+        if (r == 0 || overlapping.count(r) != 0 || (!index.contains(*r) && subscriber.match(region))) {
+            add(subscriber.getHandle());
+        }
     }
 }
 
@@ -175,11 +189,17 @@ void Subscribable::addFederatesIfOverlap(ObjectClassBroadcastList& lst, const RT
  */
 void Subscribable::addFederatesIfOverlap(InteractionBroadcastList& lst, const RTIRegion* region) const
 {
-    std::list<Subscriber>::const_iterator it = subscribers.begin();
-    for (; it != subscribers.end(); ++it) {
-        if (it->match(region))
-            lst.addFederate(it->getHandle());
-    }
+    forEachOverlappingSubscriber(region, [&](FederateHandle federate) { lst.addFederate(federate); });
+}
+
+// ----------------------------------------------------------------------------
+/** Add federates to a list of handles.
+    @param lst List where federates should be added, they may be added twice
+    @param region Region to check for overlap
+ */
+void Subscribable::addFederatesIfOverlap(std::vector<FederateHandle>& lst, const RTIRegion* region) const
+{
+    forEachOverlappingSubscriber(region, [&](FederateHandle federate) { lst.push_back(federate); });
 }
 
 } // namespace certi
@@ -24,7 +24,6 @@
 #define CERTI_SUBSCRIBABLE_HH
 
 namespace certi {
-class ObjectClassBroadcastList;
 class InteractionBroadcastList;
 class RTIRegion;
 }
@@ -33,10 +32,11 @@ class RTIRegion;
 #include "Handle.hh"
 #include "Named.hh"
 #include <list>
+#include <vector>
 
 namespace certi {
 
-class Subscriber {
+class CERTI_EXPORT Subscriber {
 public:
     Subscriber(FederateHandle);
     Subscriber(FederateHandle, const RTIRegion*);
@@ -73,10 +73,21 @@ public:
     void unsubscribe(FederateHandle);
     void unsubscribe(FederateHandle, const RTIRegion*);
 
-    void addFederatesIfOverlap(ObjectClassBroadcastList&, const RTIRegion*, Handle) const;
     void addFederatesIfOverlap(InteractionBroadcastList&, const RTIRegion*) const;
+    void addFederatesIfOverlap(std::vector<FederateHandle>&, const RTIRegion*) const;
+
+    const std::list<Subscriber>& getSubscribers() const
+    {
+        return subscribers;
+    }
 
 private:
+    /** Call add with the handle of each subscriber whose region overlaps the given one.
+     *  Regions are matched through the spatial index of the routing space.
+     */
+    template <typename Add>
+    void forEachOverlappingSubscriber(const RTIRegion*, Add add) const;
+
     std::list<Subscriber> subscribers;
 };
 
@@ -0,0 +1,177 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+// ----------------------------------------------------------------------------
+
+#include "TickBatch.hh"
+
+#include <chrono>
+#include <cstdlib>
+
+#include "PrettyDebug.hh"
+
+namespace certi {
+
+static PrettyDebug D("TICKBATCH", __FILE__);
+
+namespace {
+/// Size of a batch when only its number of callbacks is given.
+static constexpr uint32_t the_default_max_bytes{64 * 1024};
+
+uint32_t readBudget(const char* name, const uint32_t defaultValue)
+{
+    const char* value = getenv(name);
+    if (!value || !*value) {
+        return defaultValue;
+    }
+    return static_cast<uint32_t>(strtoul(value, nullptr, 10));
+}
+}
+
+TickBatch::TickBatch()
+    : TickBatch(readBudget("CERTI_TICK_BATCH", 0), readBudget("CERTI_TICK_BATCH_BYTES", the_default_max_bytes))
+{
+}
+
+TickBatch::TickBatch(const uint32_t maxCount, const uint32_t maxBytes) : my_maxCount(maxCount), my_maxBytes(maxBytes)
+{
+    if (isEnabled()) {
+        Debug(D, pdInit) << "Ticks batch up to " << my_maxCount << " callbacks, " << my_maxBytes << " bytes"
+                         << std::endl;
+    }
+}
+
+bool TickBatch::isEnabled() const
+{
+    return my_maxCount > 0;
+}
+
+uint32_t TickBatch::getMaxCount() const
+{
+    return my_maxCount;
+}
+
+uint32_t TickBatch::getMaxBytes() const
+{
+    return my_maxBytes;
+}
+
+size_t TickBatch::getPendingCount() const
+{
+    return my_pending.size();
+}
+
+std::unique_ptr<M_Tick_Request> TickBatch::tick(SocketUN* socket,
+                                                libhla::MessageBuffer& buffer,
+                                                const bool multiple,
+                                                TickTime minimum,
+                                                TickTime maximum,
+                                                const Delivery& deliver)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const TickTime deadline = maximum;
+    auto elapsed = [&start] {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    // At least one callback is delivered, then only one unless multiple, and not after the deadline
+    size_t delivered = 0;
+    auto done = [&] { return delivered > 0 && (!multiple || elapsed() >= deadline); };
+
+    // @return true if every pending callback was delivered
+    auto deliverPending = [&] {
+        while (!my_pending.empty() && !done()) {
+            // Removed first, so that a callback which throws is not delivered again
+            std::unique_ptr<Message> callback = std::move(my_pending.front());
+            my_pending.pop_front();
+            ++delivered;
+            deliver(*callback);
+        }
+        return my_pending.empty();
+    };
+
+    // Callbacks left by the previous tick come first
+    if (!my_pending.empty()) {
+        if (!deliverPending() || done()) {
+            std::unique_ptr<M_Tick_Request> answer(new M_Tick_Request());
+            answer->setMultiple(true);
+            return answer;
+        }
+        // Callbacks were delivered, do not wait for others
+        minimum = 0.0;
+        maximum -= elapsed();
+    }
+
+    M_Tick_Request request;
+    request.setMultiple(multiple);
+    request.setMinTickTime(minimum);
+    request.setMaxTickTime(maximum);
+    request.setBatchCount(my_maxCount);
+    request.setBatchBytes(my_maxBytes);
+    request.send(socket, buffer);
+
+    // True while the RTIA waits for M_Tick_Request_Next or M_Tick_Request_Stop
+    bool awaited = false;
+    try {
+        while (true) {
+            std::unique_ptr<Message> message(M_Factory::receive(socket, buffer));
+
+            switch (message->getMessageType()) {
+            case Message::TICK_REQUEST: {
+                // The tick is over for the RTIA, its last callbacks are still to be delivered
+                std::unique_ptr<M_Tick_Request> answer(static_cast<M_Tick_Request*>(message.release()));
+                if (!deliverPending()) {
+                    answer->setMultiple(true);
+                }
+                return answer;
+            }
+
+            case Message::TICK_REQUEST_NEXT: {
+                awaited = true;
+                const bool more = deliverPending() && !done();
+                awaited = false;
+
+                Debug(D, pdDebug) << "End of batch, " << (more ? "next" : "stop") << std::endl;
+                if (more) {
+                    M_Tick_Request_Next next;
+                    next.send(socket, buffer);
+                }
+                else {
+                    // The answer follows, with the multiple flag set since the RTIA had more callbacks
+                    M_Tick_Request_Stop stop;
+                    stop.send(socket, buffer);
+                }
+            } break;
+
+            default:
+                my_pending.push_back(std::move(message));
+                break;
+            }
+        }
+    }
+    catch (...) {
+        if (awaited) {
+            // Ignore the answer and rethrow the original exception
+            M_Tick_Request_Stop stop;
+            stop.send(socket, buffer);
+            delete M_Factory::receive(socket, buffer);
+        }
+        throw;
+    }
+}
+
+} // namespace certi
@@ -0,0 +1,98 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This program is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_TICK_BATCH_HH
+#define CERTI_TICK_BATCH_HH
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+
+#include <include/certi.hh>
+#include <libHLA/MessageBuffer.hh>
+
+#include "M_Classes.hh"
+#include "SocketUN.hh"
+
+namespace certi {
+
+/**
+ * Federate side of the batched tick exchange with the RTIA.
+ *
+ * Without batching, the RTIA sends one callback and waits for
+ * M_Tick_Request_Next before evoking the next one, which costs a round trip
+ * per callback. With batching, the tick request carries a budget and the RTIA
+ * sends as many callbacks as fit in it at once, followed by
+ * M_Tick_Request_Next if it has more of them or by the answer to the tick
+ * request otherwise. The callbacks of a batch are then delivered here.
+ *
+ * Delivery stops when the maximum tick time is over, the callbacks left are
+ * delivered first by the next tick.
+ */
+class CERTI_EXPORT TickBatch {
+public:
+    typedef std::function<void(Message&)> Delivery;
+
+    /**
+     * Read the budget from the environment: CERTI_TICK_BATCH callbacks, and
+     * CERTI_TICK_BATCH_BYTES bytes if set. Batching is disabled if the first
+     * one is unset or 0.
+     */
+    TickBatch();
+
+    /// A budget of 0 callbacks disables batching, 0 bytes means no bound on the size.
+    TickBatch(const uint32_t maxCount, const uint32_t maxBytes);
+
+    TickBatch(const TickBatch&) = delete;
+    TickBatch& operator=(const TickBatch&) = delete;
+
+    bool isEnabled() const;
+
+    uint32_t getMaxCount() const;
+    uint32_t getMaxBytes() const;
+
+    /// Number of callbacks received but not delivered yet.
+    size_t getPendingCount() const;
+
+    /**
+     * Evoke callbacks as tick(minimum, maximum) does, delivering them through the given function.
+     *
+     * The buffer is used for the messages sent to the RTIA and for those received.
+     * An exception thrown by the delivery ends the tick, after the RTIA has been told to stop.
+     * @return the answer to the tick request, whose exception is left to the caller.
+     * Its multiple flag is set when callbacks may still be pending.
+     */
+    std::unique_ptr<M_Tick_Request> tick(SocketUN* socket,
+                                         libhla::MessageBuffer& buffer,
+                                         const bool multiple,
+                                         TickTime minimum,
+                                         TickTime maximum,
+                                         const Delivery& deliver);
+
+private:
+    uint32_t my_maxCount;
+    uint32_t my_maxBytes;
+
+    std::deque<std::unique_ptr<Message>> my_pending;
+};
+
+} // namespace certi
+
+#endif // CERTI_TICK_BATCH_HH
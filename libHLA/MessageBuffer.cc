@@ -176,6 +176,15 @@ void MessageBuffer::assumeSize(uint32_t size)
     }
 }
 
+void MessageBuffer::seek_read(uint32_t offset)
+{
+    if (offset > writeOffset) {
+        throw MessageBufferError("seek_read::invalid offset <" + std::to_string(offset) + "> beyond buffer size <"
+                                 + std::to_string(writeOffset) + ">");
+    }
+    readOffset = offset;
+}
+
 void MessageBuffer::assumeSizeFromReservedBytes()
 {
     uint32_t toBeAssumedSize;
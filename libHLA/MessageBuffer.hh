@@ -124,6 +124,12 @@ public:
 	 */
     void seek_write(uint32_t offset);
 
+    /**
+	 * Seek buffer in order to read from specified place
+	 * Will set the read pointer to the seeked offset.
+	 */
+    void seek_read(uint32_t offset);
+
     /**
 	 * Resize the current maximum buffer size (in bytes).
 	 * This is the size of the allocated buffer.
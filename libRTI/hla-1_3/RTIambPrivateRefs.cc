@@ -42,9 +42,10 @@ std::vector<std::pair<AttributeHandle, AttributeValue_t>> getAHVPSFromRequest(T*
     std::vector<std::pair<AttributeHandle, AttributeValue_t>> result;
     result.resize(size);
 
+    // The request is not used after the callback, its values are taken rather than copied
     for (uint32_t i = 0; i < size; ++i) {
         result[i].first = request->getAttributes(i);
-        result[i].second.assign(request->getValues(i).begin(), request->getValues(i).end());
+        result[i].second.swap(request->getValues(i));
     }
 
     return result;
@@ -27,6 +27,11 @@
 #include "Message.hh"
 #include "RootObject.hh"
 #include "MessageBuffer.hh"
+#include "TickBatch.hh"
+#include "FomNameCache.hh"
+#include "RTIA/RTIAThread.hh"
+
+#include <memory>
 
 using namespace certi ;
 
@@ -56,8 +61,17 @@ public:
 
     RootObject *_theRootObj ;
 
+    //! RTIA running in process, joined once socketUn is deleted.
+    std::unique_ptr<rtia::RTIAThread> rtiaThread ;
+
     SocketUN *socketUn ;
     MessageBuffer msgBufSend,msgBufReceive ;
+
+    //! Callbacks received in batches, when enabled.
+    TickBatch tickBatch ;
+
+    //! Names and handles of the FOM, received at join.
+    FomNameCache fomNames ;
 };
 
 // $Id: RTIambPrivateRefs.hh,v 1.1 2014/03/03 15:18:23 erk Exp $
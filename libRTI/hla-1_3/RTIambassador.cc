@@ -22,9 +22,11 @@
 // ----------------------------------------------------------------------------
 
 #include "RTI.hh"
+#include "RTIambExtensions.hh"
 #include "fedtime.hh"
 
 #include "RTIambPrivateRefs.hh"
+#include "RTIA/RTIAThread.hh"
 #include "RTItypesImp.hh"
 
 #include "M_Classes.hh"
@@ -45,6 +47,7 @@
 #include <iostream>
 #include <memory>
 #include <signal.h>
+#include <system_error>
 #include <typeinfo>
 
 #ifdef CERTI_REALTIME_EXTENSIONS
@@ -191,6 +194,49 @@ RTI::RTIambassador::RTIambassador() throw(RTI::MemoryExhausted, RTI::RTIinternal
     }
 #endif
 
+    // The RTIA runs as a thread of the federate instead of a process of its own
+    const bool inProcess = rtia::RTIAThread::isRequested();
+
+    std::string shmName;
+#ifndef _WIN32
+    // Opt-in shared memory transport, the RTIA attaches to the segment created here.
+    // Always used in process, the messages then never leave the memory.
+    if (inProcess || getenv("CERTI_SHM_TRANSPORT")) {
+        shmName = SocketUN::buildSharedMemoryName();
+        privateRefs->socketUn->useSharedMemory(shmName, true);
+    }
+#endif
+
+    if (inProcess) {
+        try {
+#if defined(RTIA_USE_TCP)
+            privateRefs->rtiaThread.reset(new rtia::RTIAThread(port, -1, shmName));
+#else
+            privateRefs->rtiaThread.reset(new rtia::RTIAThread(-1, pipeFd, shmName));
+#endif
+        }
+        catch (std::system_error& e) {
+            msg << "Cannot start the RTIA thread: " << e.what();
+            throw RTI::RTIinternalError(msg.str().c_str());
+        }
+
+#if defined(RTIA_USE_TCP)
+        if (privateRefs->socketUn->acceptUN(10 * 1000) == -1) {
+            throw RTI::RTIinternalError("Cannot connect to RTIA");
+        }
+#endif
+
+        M_Open_Connexion req, rep;
+        req.setVersionMajor(CERTI_Message::versionMajor);
+        req.setVersionMinor(CERTI_Message::versionMinor);
+
+        Debug(G, pdGendoc) << "        ====>executeService OPEN_CONNEXION" << std::endl;
+        privateRefs->executeService(&req, &rep);
+
+        Debug(G, pdGendoc) << "exit  RTIambassador::RTIambassador" << std::endl;
+        return;
+    }
+
 #ifdef _WIN32
     STARTUPINFO si;
     PROCESS_INFORMATION pi;
@@ -289,6 +335,12 @@ RTI::RTIambassador::RTIambassador() throw(RTI::MemoryExhausted, RTI::RTIinternal
 #endif
             close(fd);
         }
+        if (shmName.empty()) {
+            unsetenv("CERTI_SHM_CHANNEL");
+        }
+        else {
+            setenv("CERTI_SHM_CHANNEL", shmName.c_str(), 1);
+        }
         for (unsigned i = 0; i < rtiaList.size(); ++i) {
             std::stringstream stream;
 #if defined(RTIA_USE_TCP)
@@ -382,6 +434,27 @@ RTI::Boolean RTI::RTIambassador::tick2() throw(RTI::SpecifiedSaveLabelDoesNotExi
 RTI::Boolean RTI::RTIambassador::__tick_kernel(RTI::Boolean multiple, TickTime minimum, TickTime maximum) throw(
     RTI::SpecifiedSaveLabelDoesNotExist, RTI::ConcurrentAccessAttempted, RTI::RTIinternalError)
 {
+    if (privateRefs->tickBatch.isEnabled()) {
+        // The callbacks come in batches, delivered here
+        std::unique_ptr<M_Tick_Request> answer;
+        try {
+            answer = privateRefs->tickBatch.tick(
+                privateRefs->socketUn, privateRefs->msgBufSend, multiple, minimum, maximum, [this](Message& callback) {
+                    privateRefs->callFederateAmbassador(&callback);
+                });
+        }
+        catch (NetworkError& e) {
+            std::stringstream msg;
+            msg << "NetworkError in tick() while exchanging callbacks: " << e.reason();
+            throw RTI::RTIinternalError(msg.str().c_str());
+        }
+
+        if (answer->getExceptionType() != certi::Exception::Type::NO_EXCEPTION) {
+            privateRefs->processException(answer.get());
+        }
+        return RTI::Boolean(answer->getMultiple());
+    }
+
     M_Tick_Request vers_RTI;
     std::unique_ptr<Message> vers_Fed;
 
@@ -403,7 +476,7 @@ RTI::Boolean RTI::RTIambassador::__tick_kernel(RTI::Boolean multiple, TickTime m
     // Read response(s) from the local RTIA until Message::TICK_REQUEST is received.
     while (1) {
         try {
-            vers_Fed.reset(M_Factory::receive(privateRefs->socketUn));
+            vers_Fed.reset(M_Factory::receive(privateRefs->socketUn, privateRefs->msgBufReceive));
         }
         catch (NetworkError& e) {
             std::stringstream msg;
@@ -457,6 +530,27 @@ RTI::Boolean RTI::RTIambassador::tick(TickTime minimum, TickTime maximum) throw(
     return __tick_kernel(RTI_TRUE, minimum, maximum);
 }
 
+// ----------------------------------------------------------------------------
+RTI::ULong RTIambExtensions::queryPipelinedFailure(RTI::RTIambassador& rtiAmbassador,
+                                                   long& exceptionType,
+                                                   char*& reason) throw(RTI::FederateNotExecutionMember,
+                                                                        RTI::ConcurrentAccessAttempted,
+                                                                        RTI::RTIinternalError)
+{
+    M_Query_Pipelined_Failure req, rep;
+
+    rtiAmbassador.privateRefs->executeService(&req, &rep);
+    if (rep.getSequence() == 0) {
+        exceptionType = static_cast<long>(certi::Exception::Type::NO_EXCEPTION);
+        reason = NULL;
+    }
+    else {
+        exceptionType = static_cast<long>(rep.getFailure());
+        reason = hla_strdup(rep.getFailureReason());
+    }
+    return rep.getSequence();
+}
+
 #ifdef CERTI_REALTIME_EXTENSIONS
 // ----------------------------------------------------------------------------
 void RTI::RTIambassador::setPriorityforRTIAProcess(int priority, unsigned int sched_type) throw(RTIinternalError)
@@ -613,6 +707,7 @@ RTI::RTIambassador::joinFederationExecution(const char* yourName,
     Debug(G, pdGendoc) << "        ====>executeService JOIN_FEDERATION_EXECUTION" << std::endl;
 
     privateRefs->executeService(&req, &rep);
+    privateRefs->fomNames.assign(rep);
     Debug(G, pdGendoc) << "exit  RTIambassador::joinFederationExecution" << std::endl;
 
     PrettyDebug::setFederateName("LibRTI::" + std::string(yourName));
@@ -635,6 +730,7 @@ void RTI::RTIambassador::resignFederationExecution(ResignAction theAction) throw
 
     Debug(G, pdGendoc) << "        ====>executeService RESIGN_FEDERATION_EXECUTION" << std::endl;
     privateRefs->executeService(&req, &rep);
+    privateRefs->fomNames.clear();
 
     Debug(G, pdGendoc) << "exit RTIambassador::resignFederationExecution" << std::endl;
 }
@@ -2345,8 +2441,13 @@ RTI::ObjectClassHandle RTI::RTIambassador::getObjectClassHandle(const char* theN
 
     Debug(G, pdGendoc) << "enter RTIambassador::getObjectClassHandle" << std::endl;
 
+    if (auto handle = privateRefs->fomNames.getHandle(FomNameCache::Kind::ObjectClass, theName)) {
+        return handle;
+    }
+
     req.setClassName(theName);
     privateRefs->executeService(&req, &rep);
+    privateRefs->fomNames.addHandle(FomNameCache::Kind::ObjectClass, 0, theName, rep.getObjectClass());
 
     Debug(G, pdGendoc) << "exit RTIambassador::getObjectClassHandle" << std::endl;
 
@@ -2366,8 +2467,13 @@ char* RTI::RTIambassador::getObjectClassName(ObjectClassHandle handle) throw(RTI
 {
     M_Get_Object_Class_Name req, rep;
 
+    if (auto name = privateRefs->fomNames.getName(FomNameCache::Kind::ObjectClass, handle)) {
+        return hla_strdup(*name);
+    }
+
     req.setObjectClass(handle);
     privateRefs->executeService(&req, &rep);
+    privateRefs->fomNames.add(FomNameCache::Kind::ObjectClass, 0, handle, rep.getClassName());
     return hla_strdup(rep.getClassName());
 }
 
@@ -2387,9 +2493,14 @@ RTI::RTIambassador::getAttributeHandle(const char* theName,
     Debug(G, pdGendoc) << "enter RTI::RTIambassador::getAttributeHandle" << std::endl;
     M_Get_Attribute_Handle req, rep;
 
+    if (auto handle = privateRefs->fomNames.getHandle(FomNameCache::Kind::Attribute, theName, whichClass)) {
+        return handle;
+    }
+
     req.setAttributeName(theName);
     req.setObjectClass(whichClass);
     privateRefs->executeService(&req, &rep);
+    privateRefs->fomNames.addHandle(FomNameCache::Kind::Attribute, whichClass, theName, rep.getAttribute());
     Debug(G, pdGendoc) << "exit  RTI::RTIambassador::getAttributeHandle" << std::endl;
     return rep.getAttribute();
 }
@@ -2409,9 +2520,14 @@ char* RTI::RTIambassador::getAttributeName(AttributeHandle theHandle,
 {
     M_Get_Attribute_Name req, rep;
 
+    if (auto name = privateRefs->fomNames.getName(FomNameCache::Kind::Attribute, theHandle, whichClass)) {
+        return hla_strdup(*name);
+    }
+
     req.setAttribute(theHandle);
     req.setObjectClass(whichClass);
     privateRefs->executeService(&req, &rep);
+    privateRefs->fomNames.add(FomNameCache::Kind::Attribute, whichClass, theHandle, rep.getAttributeName());
     return hla_strdup(rep.getAttributeName());
 }
 
@@ -2422,9 +2538,14 @@ RTI::InteractionClassHandle RTI::RTIambassador::getInteractionClassHandle(const
 {
     M_Get_Interaction_Class_Handle req, rep;
 
+    if (auto handle = privateRefs->fomNames.getHandle(FomNameCache::Kind::InteractionClass, theName)) {
+        return handle;
+    }
+
     req.setClassName(theName);
 
     privateRefs->executeService(&req, &rep);
+    privateRefs->fomNames.addHandle(FomNameCache::Kind::InteractionClass, 0, theName, rep.getInteractionClass());
 
     return rep.getInteractionClass();
 }
@@ -2439,9 +2560,14 @@ char* RTI::RTIambassador::getInteractionClassName(InteractionClassHandle theHand
 {
     M_Get_Interaction_Class_Name req, rep;
 
+    if (auto name = privateRefs->fomNames.getName(FomNameCache::Kind::InteractionClass, theHandle)) {
+        return hla_strdup(*name);
+    }
+
     req.setInteractionClass(theHandle);
 
     privateRefs->executeService(&req, &rep);
+    privateRefs->fomNames.add(FomNameCache::Kind::InteractionClass, 0, theHandle, rep.getClassName());
 
     return hla_strdup(rep.getClassName());
 }
@@ -2458,10 +2584,15 @@ RTI::RTIambassador::getParameterHandle(const char* theName,
 {
     M_Get_Parameter_Handle req, rep;
 
+    if (auto handle = privateRefs->fomNames.getHandle(FomNameCache::Kind::Parameter, theName, whichClass)) {
+        return handle;
+    }
+
     req.setParameterName(theName);
     req.setInteractionClass(whichClass);
 
     privateRefs->executeService(&req, &rep);
+    privateRefs->fomNames.addHandle(FomNameCache::Kind::Parameter, whichClass, theName, rep.getParameter());
 
     return rep.getParameter();
 }
@@ -2477,10 +2608,15 @@ char* RTI::RTIambassador::getParameterName(ParameterHandle theHandle,
 {
     M_Get_Parameter_Name req, rep;
 
+    if (auto name = privateRefs->fomNames.getName(FomNameCache::Kind::Parameter, theHandle, whichClass)) {
+        return hla_strdup(*name);
+    }
+
     req.setParameter(theHandle);
     req.setInteractionClass(whichClass);
 
     privateRefs->executeService(&req, &rep);
+    privateRefs->fomNames.add(FomNameCache::Kind::Parameter, whichClass, theHandle, rep.getParameterName());
 
     return hla_strdup(rep.getParameterName());
 }
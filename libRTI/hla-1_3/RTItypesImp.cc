@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <string.h>
+#include <utility>
 
 using namespace certi;
 
@@ -46,6 +47,13 @@ AttributeHandleValuePairSetImp::AttributeHandleValuePairSetImp(const std::vector
     _transport = RELIABLE;
 }
 
+AttributeHandleValuePairSetImp::AttributeHandleValuePairSetImp(std::vector<AttributeHandleValuePair_t>&& val)
+    : _set(std::move(val))
+{
+    _order = RECEIVE;
+    _transport = RELIABLE;
+}
+
 AttributeHandleValuePairSetImp::~AttributeHandleValuePairSetImp()
 {
 }
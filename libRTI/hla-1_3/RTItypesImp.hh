@@ -66,6 +66,7 @@ class RTI_EXPORT AttributeHandleValuePairSetImp : public RTI::AttributeHandleVal
 public:
     AttributeHandleValuePairSetImp(RTI::ULong);
     AttributeHandleValuePairSetImp(const std::vector<AttributeHandleValuePair_t> &);
+    AttributeHandleValuePairSetImp(std::vector<AttributeHandleValuePair_t> &&);
 
     virtual ~AttributeHandleValuePairSetImp();
 
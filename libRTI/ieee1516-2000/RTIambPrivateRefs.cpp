@@ -79,11 +79,11 @@ rti1516::AttributeHandleValueMap* getAHVMFromRequest(T* request)
     uint32_t size = request->getAttributesSize();
     rti1516::AttributeHandleValueMap* result = new rti1516::AttributeHandleValueMap();
 
+    // Values are only read during the callback, they point into the request instead of being copied
     for (uint32_t i = 0; i < size; ++i) {
         rti1516::AttributeHandle attribute
             = rti1516::AttributeHandleFriend::createRTI1516Handle(request->getAttributes(i));
-        rti1516::VariableLengthData varData(&(request->getValues(i)[0]), request->getValues(i).size());
-        result->insert(std::pair<rti1516::AttributeHandle, rti1516::VariableLengthData>(attribute, varData));
+        (*result)[attribute].setDataPointer(request->getValues(i).data(), request->getValues(i).size());
     }
 
     return result;
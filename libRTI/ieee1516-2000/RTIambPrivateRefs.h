@@ -26,6 +26,11 @@
 #include "Message.hh"
 #include "RootObject.hh"
 #include "MessageBuffer.hh"
+#include "TickBatch.hh"
+#include "FomNameCache.hh"
+#include "RTIA/RTIAThread.hh"
+
+#include <memory>
 
 using namespace certi ;
 
@@ -55,8 +60,17 @@ public:
 
     RootObject *_theRootObj ;
 
+    //! RTIA running in process, joined once socketUn is deleted.
+    std::unique_ptr<rtia::RTIAThread> rtiaThread ;
+
     SocketUN *socketUn ;
     MessageBuffer msgBufSend,msgBufReceive ;
+
+    //! Callbacks received in batches, when enabled.
+    TickBatch tickBatch ;
+
+    //! Names and handles of the FOM, received at join.
+    FomNameCache fomNames ;
 };
 
 // $Id: RTIambPrivateRefs.h,v 1.1 2014/03/03 16:41:48 erk Exp $
@@ -62,10 +62,8 @@ void RTI1516ambassador::assignPHVMAndExecuteService(const rti1516::ParameterHand
     uint32_t i = 0;
     for (rti1516::ParameterHandleValueMap::const_iterator it = PHVM.begin(); it != PHVM.end(); ++it, ++i) {
         req.setParameters(rti1516::ParameterHandleFriend::toCertiHandle(it->first), i);
-        certi::ParameterValue_t paramValue;
-        paramValue.resize(it->second.size());
-        memcpy(&(paramValue[0]), it->second.data(), it->second.size());
-        req.setValues(paramValue, i);
+        // Serialized straight from the caller's buffer, which outlives the service
+        req.setValuesView(it->second.data(), it->second.size(), i);
     }
     privateRefs->executeService(&req, &rep);
 }
@@ -78,10 +76,8 @@ void RTI1516ambassador::assignAHVMAndExecuteService(const rti1516::AttributeHand
     uint32_t i = 0;
     for (rti1516::AttributeHandleValueMap::const_iterator it = AHVM.begin(); it != AHVM.end(); ++it, ++i) {
         req.setAttributes(rti1516::AttributeHandleFriend::toCertiHandle(it->first), i);
-        certi::AttributeValue_t attrValue;
-        attrValue.resize(it->second.size());
-        memcpy(&(attrValue[0]), it->second.data(), it->second.size());
-        req.setValues(attrValue, i);
+        // Serialized straight from the caller's buffer, which outlives the service
+        req.setValuesView(it->second.data(), it->second.size(), i);
     }
     privateRefs->executeService(&req, &rep);
 }
@@ -148,6 +144,28 @@ bool RTI1516ambassador::__tick_kernel(bool multiple,
                                       TickTime maximum) throw(rti1516::SpecifiedSaveLabelDoesNotExist,
                                                               rti1516::RTIinternalError)
 {
+    if (privateRefs->tickBatch.isEnabled()) {
+        // The callbacks come in batches, delivered here
+        std::unique_ptr<M_Tick_Request> answer;
+        try {
+            answer = privateRefs->tickBatch.tick(
+                privateRefs->socketUn, privateRefs->msgBufSend, multiple, minimum, maximum, [this](Message& callback) {
+                    privateRefs->callFederateAmbassador(&callback);
+                });
+        }
+        catch (NetworkError& e) {
+            std::stringstream msg;
+            msg << "NetworkError in tick() while exchanging callbacks: " << e.reason();
+            const std::string reason = msg.str();
+            throw rti1516::RTIinternalError(std::wstring(reason.begin(), reason.end()));
+        }
+
+        if (answer->getExceptionType() != Exception::Type::NO_EXCEPTION) {
+            privateRefs->processException(answer.get());
+        }
+        return answer->getMultiple();
+    }
+
     M_Tick_Request vers_RTI;
     std::unique_ptr<Message> vers_Fed;
 
@@ -169,7 +187,7 @@ bool RTI1516ambassador::__tick_kernel(bool multiple,
     // Read response(s) from the local RTIA until Message::TICK_REQUEST is received.
     while (1) {
         try {
-            vers_Fed.reset(M_Factory::receive(privateRefs->socketUn));
+            vers_Fed.reset(M_Factory::receive(privateRefs->socketUn, privateRefs->msgBufReceive));
         }
         catch (NetworkError& e) {
             std::stringstream msg;
@@ -297,6 +315,7 @@ rti1516::FederateHandle RTI1516ambassador::joinFederationExecution(
     
     Debug(G, pdGendoc) << "        ====>executeService JOIN_FEDERATION_EXECUTION" << std::endl;
     privateRefs->executeService(&req, &rep);
+    privateRefs->fomNames.assign(rep);
     
     Debug(G, pdGendoc) << "exit  RTI1516ambassador::joinFederationExecution" << std::endl;
     PrettyDebug::setFederateName("LibRTI::" + std::string(federateTypeAsString));
@@ -322,6 +341,7 @@ void RTI1516ambassador::resignFederationExecution(rti1516::ResignAction /*resign
     req.setResignAction(certi::DELETE_OBJECTS_AND_RELEASE_ATTRIBUTES);
     Debug(G, pdGendoc) << "        ====>executeService RESIGN_FEDERATION_EXECUTION" << std::endl;
     privateRefs->executeService(&req, &rep);
+    privateRefs->fomNames.clear();
     Debug(G, pdGendoc) << "exit RTI1516ambassador::resignFederationExecution" << std::endl;
 }
 
@@ -1928,8 +1948,13 @@ rti1516::ObjectClassHandle RTI1516ambassador::getObjectClassHandle(std::wstring
     Debug(G, pdGendoc) << "enter RTI1516ambassador::getObjectClassHandle" << std::endl;
 
     std::string nameAsString(theName.begin(), theName.end());
+    if (auto handle = privateRefs->fomNames.getHandle(FomNameCache::Kind::ObjectClass, nameAsString)) {
+        return rti1516::ObjectClassHandleFriend::createRTI1516Handle(handle);
+    }
+
     req.setClassName(nameAsString);
     privateRefs->executeService(&req, &rep);
+    privateRefs->fomNames.addHandle(FomNameCache::Kind::ObjectClass, 0, nameAsString, rep.getObjectClass());
 
     Debug(G, pdGendoc) << "exit RTI1516ambassador::getObjectClassHandle" << std::endl;
     rti1516::ObjectClassHandle rti1516Handle
@@ -1945,6 +1970,10 @@ std::wstring RTI1516ambassador::getObjectClassName(rti1516::ObjectClassHandle th
     M_Get_Object_Class_Name req, rep;
 
     certi::ObjectClassHandle certiHandle = rti1516::ObjectClassHandleFriend::toCertiHandle(theHandle);
+    if (auto name = privateRefs->fomNames.getName(FomNameCache::Kind::ObjectClass, certiHandle)) {
+        return std::wstring(name->begin(), name->end());
+    }
+
     req.setObjectClass(certiHandle);
     try {
         privateRefs->executeService(&req, &rep);
@@ -1952,6 +1981,7 @@ std::wstring RTI1516ambassador::getObjectClassName(rti1516::ObjectClassHandle th
     catch (rti1516::ObjectClassNotDefined& e) {
         throw rti1516::InvalidObjectClassHandle(e.what());
     }
+    privateRefs->fomNames.add(FomNameCache::Kind::ObjectClass, 0, certiHandle, rep.getClassName());
 
     std::string nameString = rep.getClassName();
     std::wstring nameWString(nameString.begin(), nameString.end());
@@ -1972,8 +2002,13 @@ RTI1516ambassador::getAttributeHandle(rti1516::ObjectClassHandle whichClass,
     M_Get_Attribute_Handle req, rep;
 
     std::string nameAsString(theAttributeName.begin(), theAttributeName.end());
+    const auto certiClass = rti1516::ObjectClassHandleFriend::toCertiHandle(whichClass);
+    if (auto handle = privateRefs->fomNames.getHandle(FomNameCache::Kind::Attribute, nameAsString, certiClass)) {
+        return rti1516::AttributeHandleFriend::createRTI1516Handle(handle);
+    }
+
     req.setAttributeName(nameAsString);
-    req.setObjectClass(rti1516::ObjectClassHandleFriend::toCertiHandle(whichClass));
+    req.setObjectClass(certiClass);
 
     try {
         privateRefs->executeService(&req, &rep);
@@ -1986,6 +2021,7 @@ RTI1516ambassador::getAttributeHandle(rti1516::ObjectClassHandle whichClass,
             throw rti1516::NameNotFound(e.what());
         }
     }
+    privateRefs->fomNames.addHandle(FomNameCache::Kind::Attribute, certiClass, nameAsString, rep.getAttribute());
 
     Debug(G, pdGendoc) << "exit  RTI::RTI1516ambassador::getAttributeHandle" << std::endl;
     return rti1516::AttributeHandleFriend::createRTI1516Handle(rep.getAttribute());
@@ -2002,8 +2038,14 @@ RTI1516ambassador::getAttributeName(rti1516::ObjectClassHandle whichClass,
 {
     M_Get_Attribute_Name req, rep;
 
-    req.setAttribute(rti1516::AttributeHandleFriend::toCertiHandle(theHandle));
-    req.setObjectClass(rti1516::ObjectClassHandleFriend::toCertiHandle(whichClass));
+    const auto certiAttribute = rti1516::AttributeHandleFriend::toCertiHandle(theHandle);
+    const auto certiClass = rti1516::ObjectClassHandleFriend::toCertiHandle(whichClass);
+    if (auto name = privateRefs->fomNames.getName(FomNameCache::Kind::Attribute, certiAttribute, certiClass)) {
+        return std::wstring(name->begin(), name->end());
+    }
+
+    req.setAttribute(certiAttribute);
+    req.setObjectClass(certiClass);
     try {
         privateRefs->executeService(&req, &rep);
     }
@@ -2024,6 +2066,8 @@ RTI1516ambassador::getAttributeName(rti1516::ObjectClassHandle whichClass,
         }
     }
 
+    privateRefs->fomNames.add(FomNameCache::Kind::Attribute, certiClass, certiAttribute, rep.getAttributeName());
+
     //return hla_strdup(rep.getAttributeName());
 
     std::string nameString = rep.getAttributeName();
@@ -2038,9 +2082,14 @@ rti1516::InteractionClassHandle RTI1516ambassador::getInteractionClassHandle(std
 {
     M_Get_Interaction_Class_Handle req, rep;
     std::string nameString(theName.begin(), theName.end());
+    if (auto handle = privateRefs->fomNames.getHandle(FomNameCache::Kind::InteractionClass, nameString)) {
+        return rti1516::InteractionClassHandleFriend::createRTI1516Handle(handle);
+    }
+
     req.setClassName(nameString);
 
     privateRefs->executeService(&req, &rep);
+    privateRefs->fomNames.addHandle(FomNameCache::Kind::InteractionClass, 0, nameString, rep.getInteractionClass());
 
     return rti1516::InteractionClassHandleFriend::createRTI1516Handle(rep.getInteractionClass());
 }
@@ -2050,7 +2099,12 @@ std::wstring RTI1516ambassador::getInteractionClassName(rti1516::InteractionClas
     rti1516::InvalidInteractionClassHandle, rti1516::FederateNotExecutionMember, rti1516::RTIinternalError)
 {
     M_Get_Interaction_Class_Name req, rep;
-    req.setInteractionClass(rti1516::InteractionClassHandleFriend::toCertiHandle(theHandle));
+    const auto certiHandle = rti1516::InteractionClassHandleFriend::toCertiHandle(theHandle);
+    if (auto name = privateRefs->fomNames.getName(FomNameCache::Kind::InteractionClass, certiHandle)) {
+        return std::wstring(name->begin(), name->end());
+    }
+
+    req.setInteractionClass(certiHandle);
     try {
         privateRefs->executeService(&req, &rep);
     }
@@ -2063,6 +2117,8 @@ std::wstring RTI1516ambassador::getInteractionClassName(rti1516::InteractionClas
         }
     }
 
+    privateRefs->fomNames.add(FomNameCache::Kind::InteractionClass, 0, certiHandle, rep.getClassName());
+
     //return hla_strdup(rep.getClassName());
     std::string nameString = rep.getClassName();
     std::wstring nameWString(nameString.begin(), nameString.end());
@@ -2080,8 +2136,13 @@ RTI1516ambassador::getParameterHandle(rti1516::InteractionClassHandle whichClass
 {
     M_Get_Parameter_Handle req, rep;
     std::string nameString(theName.begin(), theName.end());
+    const auto certiClass = rti1516::InteractionClassHandleFriend::toCertiHandle(whichClass);
+    if (auto handle = privateRefs->fomNames.getHandle(FomNameCache::Kind::Parameter, nameString, certiClass)) {
+        return rti1516::ParameterHandleFriend::createRTI1516Handle(handle);
+    }
+
     req.setParameterName(nameString);
-    req.setInteractionClass(rti1516::InteractionClassHandleFriend::toCertiHandle(whichClass));
+    req.setInteractionClass(certiClass);
 
     try {
         privateRefs->executeService(&req, &rep);
@@ -2095,6 +2156,8 @@ RTI1516ambassador::getParameterHandle(rti1516::InteractionClassHandle whichClass
         }
     }
 
+    privateRefs->fomNames.addHandle(FomNameCache::Kind::Parameter, certiClass, nameString, rep.getParameter());
+
     return rti1516::ParameterHandleFriend::createRTI1516Handle(rep.getParameter());
 }
 
@@ -2109,8 +2172,14 @@ RTI1516ambassador::getParameterName(rti1516::InteractionClassHandle whichClass,
 {
     M_Get_Parameter_Name req, rep;
 
-    req.setParameter(rti1516::ParameterHandleFriend::toCertiHandle(theHandle));
-    req.setInteractionClass(rti1516::InteractionClassHandleFriend::toCertiHandle(whichClass));
+    const auto certiParameter = rti1516::ParameterHandleFriend::toCertiHandle(theHandle);
+    const auto certiClass = rti1516::InteractionClassHandleFriend::toCertiHandle(whichClass);
+    if (auto name = privateRefs->fomNames.getName(FomNameCache::Kind::Parameter, certiParameter, certiClass)) {
+        return std::wstring(name->begin(), name->end());
+    }
+
+    req.setParameter(certiParameter);
+    req.setInteractionClass(certiClass);
 
     try {
         privateRefs->executeService(&req, &rep);
@@ -2124,6 +2193,8 @@ RTI1516ambassador::getParameterName(rti1516::InteractionClassHandle whichClass,
         }
     }
 
+    privateRefs->fomNames.add(FomNameCache::Kind::Parameter, certiClass, certiParameter, rep.getParameterName());
+
     //return hla_strdup(rep.getParameterName());
     std::string nameString = rep.getParameterName();
     std::wstring nameWString(nameString.begin(), nameString.end());
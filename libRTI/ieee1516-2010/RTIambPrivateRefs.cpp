@@ -82,11 +82,11 @@ rti1516e::AttributeHandleValueMap* getAHVMFromRequest(T* request)
     uint32_t size = request->getAttributesSize();
     rti1516e::AttributeHandleValueMap* result = new rti1516e::AttributeHandleValueMap();
 
+    // Values are only read during the callback, they point into the request instead of being copied
     for (uint32_t i = 0; i < size; ++i) {
         rti1516e::AttributeHandle attribute
             = rti1516e::AttributeHandleFriend::createRTI1516Handle(request->getAttributes(i));
-        rti1516e::VariableLengthData varData(&(request->getValues(i)[0]), request->getValues(i).size());
-        result->insert(std::pair<rti1516e::AttributeHandle, rti1516e::VariableLengthData>(attribute, varData));
+        (*result)[attribute].setDataPointer(request->getValues(i).data(), request->getValues(i).size());
     }
 
     return result;
@@ -29,6 +29,9 @@
 #include "Message.hh"
 #include "MessageBuffer.hh"
 #include "RootObject.hh"
+#include "TickBatch.hh"
+#include "FomNameCache.hh"
+#include "RTIA/RTIAThread.hh"
 #include <RTI/certiRTI1516.h>
 
 namespace certi {
@@ -59,7 +62,16 @@ struct RTI1516ambassador::Private {
 
     RootObject* root_object{nullptr};
 
+    /// RTIA running in process, destroyed after socket_un so that it sees the end of the link.
+    std::unique_ptr<rtia::RTIAThread> rtia_thread{nullptr};
+
     std::unique_ptr<SocketUN> socket_un{nullptr};
     MessageBuffer msgBufSend, msgBufReceive;
+
+    /// Callbacks received in batches, when enabled.
+    TickBatch tick_batch{};
+
+    /// Names and handles of the FOM, received at join.
+    FomNameCache fom_names{};
 };
 }
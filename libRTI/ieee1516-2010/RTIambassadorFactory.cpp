@@ -27,12 +27,14 @@
 #include <cstring>
 #include <iostream>
 #include <memory>
+#include <system_error>
 #ifndef _WIN32
 #include <csignal>
 #include <unistd.h>
 #endif
 
 #include "PrettyDebug.hh"
+#include "RTIA/RTIAThread.hh"
 #include "RTIambPrivateRefs.h"
 #include "RTIambassadorImplementation.h"
 
@@ -95,6 +97,49 @@ rti1516e::RTIambassadorFactory::createRTIambassador() throw(rti1516e::RTIinterna
     }
 #endif
 
+    // The RTIA runs as a thread of the federate instead of a process of its own
+    const bool inProcess = certi::rtia::RTIAThread::isRequested();
+
+    std::string shmName;
+#ifndef _WIN32
+    // Opt-in shared memory transport, the RTIA attaches to the segment created here.
+    // Always used in process, the messages then never leave the memory.
+    if (inProcess || getenv("CERTI_SHM_TRANSPORT")) {
+        shmName = certi::SocketUN::buildSharedMemoryName();
+        p_ambassador->p->socket_un->useSharedMemory(shmName, true);
+    }
+#endif
+
+    if (inProcess) {
+        try {
+#if defined(RTIA_USE_TCP)
+            p_ambassador->p->rtia_thread.reset(new certi::rtia::RTIAThread(port, -1, shmName));
+#else
+            p_ambassador->p->rtia_thread.reset(new certi::rtia::RTIAThread(-1, pipeFd, shmName));
+#endif
+        }
+        catch (std::system_error& e) {
+            msg << "Cannot start the RTIA thread: " << e.what();
+            throw rti1516e::RTIinternalError(msg.str());
+        }
+
+#if defined(RTIA_USE_TCP)
+        if (p_ambassador->p->socketUn->acceptUN(10 * 1000) == -1) {
+            throw rti1516e::RTIinternalError(wstringize() << "Cannot connect to RTIA");
+        }
+#endif
+
+        certi::M_Open_Connexion req, rep;
+        req.setVersionMajor(certi::CERTI_Message::versionMajor);
+        req.setVersionMinor(certi::CERTI_Message::versionMinor);
+
+        Debug(G1516, pdGendoc) << "        ====>executeService OPEN_CONNEXION" << std::endl;
+        p_ambassador->p->executeService(&req, &rep);
+
+        Debug(G1516, pdGendoc) << "exit  RTIambassador::RTIambassador" << std::endl;
+        return std::auto_ptr<rti1516e::RTIambassador>(p_ambassador);
+    }
+
 #ifdef _WIN32
     STARTUPINFO si;
     PROCESS_INFORMATION pi;
@@ -190,6 +235,12 @@ rti1516e::RTIambassadorFactory::createRTIambassador() throw(rti1516e::RTIinterna
 #endif
             close(fd);
         }
+        if (shmName.empty()) {
+            unsetenv("CERTI_SHM_CHANNEL");
+        }
+        else {
+            setenv("CERTI_SHM_CHANNEL", shmName.c_str(), 1);
+        }
         for (unsigned i = 0; i < rtiaList.size(); ++i) {
             std::stringstream stream;
 #if defined(RTIA_USE_TCP)
@@ -70,10 +70,8 @@ void RTI1516ambassador::assignPHVMAndExecuteService(const rti1516e::ParameterHan
     uint32_t i = 0;
     for (rti1516e::ParameterHandleValueMap::const_iterator it = PHVM.begin(); it != PHVM.end(); ++it, ++i) {
         req.setParameters(rti1516e::ParameterHandleFriend::toCertiHandle(it->first), i);
-        certi::ParameterValue_t paramValue;
-        paramValue.resize(it->second.size());
-        memcpy(&(paramValue[0]), it->second.data(), it->second.size());
-        req.setValues(paramValue, i);
+        // Serialized straight from the caller's buffer, which outlives the service
+        req.setValuesView(it->second.data(), it->second.size(), i);
     }
     p->executeService(&req, &rep);
 }
@@ -86,10 +84,8 @@ void RTI1516ambassador::assignAHVMAndExecuteService(const rti1516e::AttributeHan
     uint32_t i = 0;
     for (rti1516e::AttributeHandleValueMap::const_iterator it = AHVM.begin(); it != AHVM.end(); ++it, ++i) {
         req.setAttributes(rti1516e::AttributeHandleFriend::toCertiHandle(it->first), i);
-        certi::AttributeValue_t attrValue;
-        attrValue.resize(it->second.size());
-        memcpy(&(attrValue[0]), it->second.data(), it->second.size());
-        req.setValues(attrValue, i);
+        // Serialized straight from the caller's buffer, which outlives the service
+        req.setValuesView(it->second.data(), it->second.size(), i);
     }
     p->executeService(&req, &rep);
 }
@@ -134,6 +130,25 @@ RTI1516ambassador::~RTI1516ambassador()
 bool RTI1516ambassador::__tick_kernel(bool multiple, TickTime minimum, TickTime maximum) throw(
     rti1516e::SpecifiedSaveLabelDoesNotExist, rti1516e::NotConnected, rti1516e::RTIinternalError)
 {
+    if (p->tick_batch.isEnabled()) {
+        // The callbacks come in batches, delivered here
+        std::unique_ptr<M_Tick_Request> answer;
+        try {
+            answer = p->tick_batch.tick(
+                p->socket_un.get(), p->msgBufSend, multiple, minimum, maximum, [this](Message& callback) {
+                    p->callFederateAmbassador(&callback);
+                });
+        }
+        catch (NetworkError& e) {
+            throw rti1516e::RTIinternalError(L"NetworkError in tick() while exchanging callbacks: " + e.wreason());
+        }
+
+        if (answer->getExceptionType() != Exception::Type::NO_EXCEPTION) {
+            p->processException(answer.get());
+        }
+        return answer->getMultiple();
+    }
+
     M_Tick_Request vers_RTI;
     std::auto_ptr<Message> vers_Fed;
 
@@ -152,7 +167,7 @@ bool RTI1516ambassador::__tick_kernel(bool multiple, TickTime minimum, TickTime
     // Read response(s) from the local RTIA until Message::TICK_REQUEST is received.
     while (1) {
         try {
-            vers_Fed.reset(M_Factory::receive(p->socket_un.get()));
+            vers_Fed.reset(M_Factory::receive(p->socket_un.get(), p->msgBufReceive));
         }
         catch (NetworkError& e) {
             throw rti1516e::RTIinternalError(L"NetworkError in tick() while receiving response: " + e.wreason());
@@ -394,6 +409,7 @@ rti1516e::FederateHandle RTI1516ambassador::joinFederationExecution(
 
     Debug(G, pdGendoc) << "        ====>executeService JOIN_FEDERATION_EXECUTION" << std::endl;
     p->executeService(&req, &rep);
+    p->fom_names.assign(rep);
 
     PrettyDebug::setFederateName("LibRTI::" + std::string{begin(federateType), end(federateType)});
 
@@ -418,6 +434,7 @@ void RTI1516ambassador::resignFederationExecution(rti1516e::ResignAction /*resig
     req.setResignAction(certi::DELETE_OBJECTS_AND_RELEASE_ATTRIBUTES);
     Debug(G, pdGendoc) << "        ====>executeService RESIGN_FEDERATION_EXECUTION" << std::endl;
     p->executeService(&req, &rep);
+    p->fom_names.clear();
     Debug(G, pdGendoc) << "exit RTI1516ambassador::resignFederationExecution" << std::endl;
 }
 
@@ -2249,8 +2266,13 @@ rti1516e::ObjectClassHandle RTI1516ambassador::getObjectClassHandle(std::wstring
     Debug(G, pdGendoc) << "enter RTI1516ambassador::getObjectClassHandle" << std::endl;
 
     std::string nameAsString(theName.begin(), theName.end());
+    if (auto handle = p->fom_names.getHandle(FomNameCache::Kind::ObjectClass, nameAsString)) {
+        return rti1516e::ObjectClassHandleFriend::createRTI1516Handle(handle);
+    }
+
     req.setClassName(nameAsString);
     p->executeService(&req, &rep);
+    p->fom_names.addHandle(FomNameCache::Kind::ObjectClass, 0, nameAsString, rep.getObjectClass());
 
     Debug(G, pdGendoc) << "exit RTI1516ambassador::getObjectClassHandle" << std::endl;
     rti1516e::ObjectClassHandle rti1516Handle
@@ -2268,6 +2290,10 @@ RTI1516ambassador::getObjectClassName(rti1516e::ObjectClassHandle theHandle) thr
     M_Get_Object_Class_Name req, rep;
 
     certi::ObjectClassHandle certiHandle = rti1516e::ObjectClassHandleFriend::toCertiHandle(theHandle);
+    if (auto name = p->fom_names.getName(FomNameCache::Kind::ObjectClass, certiHandle)) {
+        return std::wstring(name->begin(), name->end());
+    }
+
     req.setObjectClass(certiHandle);
     try {
         p->executeService(&req, &rep);
@@ -2275,6 +2301,7 @@ RTI1516ambassador::getObjectClassName(rti1516e::ObjectClassHandle theHandle) thr
     catch (rti1516e::ObjectClassNotDefined& e) {
         throw rti1516e::InvalidObjectClassHandle(e.what());
     }
+    p->fom_names.add(FomNameCache::Kind::ObjectClass, 0, certiHandle, rep.getClassName());
 
     std::string nameString = rep.getClassName();
     std::wstring nameWString(nameString.begin(), nameString.end());
@@ -2341,8 +2368,13 @@ RTI1516ambassador::getAttributeHandle(rti1516e::ObjectClassHandle whichClass,
     M_Get_Attribute_Handle req, rep;
 
     std::string nameAsString(theAttributeName.begin(), theAttributeName.end());
+    const auto certiClass = rti1516e::ObjectClassHandleFriend::toCertiHandle(whichClass);
+    if (auto handle = p->fom_names.getHandle(FomNameCache::Kind::Attribute, nameAsString, certiClass)) {
+        return rti1516e::AttributeHandleFriend::createRTI1516Handle(handle);
+    }
+
     req.setAttributeName(nameAsString);
-    req.setObjectClass(rti1516e::ObjectClassHandleFriend::toCertiHandle(whichClass));
+    req.setObjectClass(certiClass);
 
     try {
         p->executeService(&req, &rep);
@@ -2355,6 +2387,7 @@ RTI1516ambassador::getAttributeHandle(rti1516e::ObjectClassHandle whichClass,
             throw rti1516e::NameNotFound(e.what());
         }
     }
+    p->fom_names.addHandle(FomNameCache::Kind::Attribute, certiClass, nameAsString, rep.getAttribute());
 
     Debug(G, pdGendoc) << "exit  RTI::RTI1516ambassador::getAttributeHandle" << std::endl;
     return rti1516e::AttributeHandleFriend::createRTI1516Handle(rep.getAttribute());
@@ -2371,8 +2404,14 @@ RTI1516ambassador::getAttributeName(rti1516e::ObjectClassHandle whichClass,
 {
     M_Get_Attribute_Name req, rep;
 
-    req.setAttribute(rti1516e::AttributeHandleFriend::toCertiHandle(theHandle));
-    req.setObjectClass(rti1516e::ObjectClassHandleFriend::toCertiHandle(whichClass));
+    const auto certiAttribute = rti1516e::AttributeHandleFriend::toCertiHandle(theHandle);
+    const auto certiClass = rti1516e::ObjectClassHandleFriend::toCertiHandle(whichClass);
+    if (auto name = p->fom_names.getName(FomNameCache::Kind::Attribute, certiAttribute, certiClass)) {
+        return std::wstring(name->begin(), name->end());
+    }
+
+    req.setAttribute(certiAttribute);
+    req.setObjectClass(certiClass);
     try {
         p->executeService(&req, &rep);
     }
@@ -2393,6 +2432,8 @@ RTI1516ambassador::getAttributeName(rti1516e::ObjectClassHandle whichClass,
         }
     }
 
+    p->fom_names.add(FomNameCache::Kind::Attribute, certiClass, certiAttribute, rep.getAttributeName());
+
     //return hla_strdup(rep.getAttributeName());
 
     std::string nameString = rep.getAttributeName();
@@ -2429,9 +2470,14 @@ rti1516e::InteractionClassHandle RTI1516ambassador::getInteractionClassHandle(st
 {
     M_Get_Interaction_Class_Handle req, rep;
     std::string nameString(theName.begin(), theName.end());
+    if (auto handle = p->fom_names.getHandle(FomNameCache::Kind::InteractionClass, nameString)) {
+        return rti1516e::InteractionClassHandleFriend::createRTI1516Handle(handle);
+    }
+
     req.setClassName(nameString);
 
     p->executeService(&req, &rep);
+    p->fom_names.addHandle(FomNameCache::Kind::InteractionClass, 0, nameString, rep.getInteractionClass());
 
     return rti1516e::InteractionClassHandleFriend::createRTI1516Handle(rep.getInteractionClass());
 }
@@ -2444,7 +2490,12 @@ std::wstring RTI1516ambassador::getInteractionClassName(rti1516e::InteractionCla
     rti1516e::RTIinternalError)
 {
     M_Get_Interaction_Class_Name req, rep;
-    req.setInteractionClass(rti1516e::InteractionClassHandleFriend::toCertiHandle(theHandle));
+    const auto certiHandle = rti1516e::InteractionClassHandleFriend::toCertiHandle(theHandle);
+    if (auto name = p->fom_names.getName(FomNameCache::Kind::InteractionClass, certiHandle)) {
+        return std::wstring(name->begin(), name->end());
+    }
+
+    req.setInteractionClass(certiHandle);
     try {
         p->executeService(&req, &rep);
     }
@@ -2457,6 +2508,8 @@ std::wstring RTI1516ambassador::getInteractionClassName(rti1516e::InteractionCla
         }
     }
 
+    p->fom_names.add(FomNameCache::Kind::InteractionClass, 0, certiHandle, rep.getClassName());
+
     //return hla_strdup(rep.getClassName());
     std::string nameString = rep.getClassName();
     std::wstring nameWString(nameString.begin(), nameString.end());
@@ -2475,8 +2528,13 @@ RTI1516ambassador::getParameterHandle(rti1516e::InteractionClassHandle whichClas
 {
     M_Get_Parameter_Handle req, rep;
     std::string nameString(theName.begin(), theName.end());
+    const auto certiClass = rti1516e::InteractionClassHandleFriend::toCertiHandle(whichClass);
+    if (auto handle = p->fom_names.getHandle(FomNameCache::Kind::Parameter, nameString, certiClass)) {
+        return rti1516e::ParameterHandleFriend::createRTI1516Handle(handle);
+    }
+
     req.setParameterName(nameString);
-    req.setInteractionClass(rti1516e::InteractionClassHandleFriend::toCertiHandle(whichClass));
+    req.setInteractionClass(certiClass);
 
     try {
         p->executeService(&req, &rep);
@@ -2490,6 +2548,8 @@ RTI1516ambassador::getParameterHandle(rti1516e::InteractionClassHandle whichClas
         }
     }
 
+    p->fom_names.addHandle(FomNameCache::Kind::Parameter, certiClass, nameString, rep.getParameter());
+
     return rti1516e::ParameterHandleFriend::createRTI1516Handle(rep.getParameter());
 }
 
@@ -2505,8 +2565,14 @@ RTI1516ambassador::getParameterName(rti1516e::InteractionClassHandle whichClass,
 {
     M_Get_Parameter_Name req, rep;
 
-    req.setParameter(rti1516e::ParameterHandleFriend::toCertiHandle(theHandle));
-    req.setInteractionClass(rti1516e::InteractionClassHandleFriend::toCertiHandle(whichClass));
+    const auto certiParameter = rti1516e::ParameterHandleFriend::toCertiHandle(theHandle);
+    const auto certiClass = rti1516e::InteractionClassHandleFriend::toCertiHandle(whichClass);
+    if (auto name = p->fom_names.getName(FomNameCache::Kind::Parameter, certiParameter, certiClass)) {
+        return std::wstring(name->begin(), name->end());
+    }
+
+    req.setParameter(certiParameter);
+    req.setInteractionClass(certiClass);
 
     try {
         p->executeService(&req, &rep);
@@ -2520,6 +2586,8 @@ RTI1516ambassador::getParameterName(rti1516e::InteractionClassHandle whichClass,
         }
     }
 
+    p->fom_names.add(FomNameCache::Kind::Parameter, certiClass, certiParameter, rep.getParameterName());
+
     //return hla_strdup(rep.getParameterName());
     std::string nameString = rep.getParameterName();
     std::wstring nameWString(nameString.begin(), nameString.end());
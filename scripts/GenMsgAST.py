@@ -863,6 +863,7 @@ class MessageType(ASTElement):
         name,
         fields,
         merge,
+        pooled=False,
         ):
         """
         The class constructor
@@ -872,6 +873,8 @@ class MessageType(ASTElement):
         @type merge: a C{MessageType}  
         @param fields: the fields we want to describe in the C{MessageType} object
         @type fields:  C{list} of C{MessageType.MessageField}
+        @param pooled: whether the instances of this C{MessageType} are pooled
+        @type pooled: C{bool}
         """
         super(MessageType, self).__init__(name=name)
         self.fields = fields
@@ -884,6 +887,11 @@ class MessageType(ASTElement):
         @ivar: the merger of this C{MessageType}
         @type: a C{MessageType}  
         """
+        self.pooled = pooled
+        """
+        @ivar: TRUE if the memory of the instances of this C{MessageType} is reused
+        @type: C{bool}
+        """
 
         self.enum = None
         """
@@ -901,6 +909,8 @@ class MessageType(ASTElement):
         @return: the representation of the C{MessageType} object
         """
         res = 'message %s ' % self.name
+        if self.pooled:
+            res = 'pooled ' + res
         return res
 
     def hasMerge(self):
@@ -50,6 +50,7 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
     def __init__(self, MessageAST):
         super(CXXGenerator, self).__init__(MessageAST, '//')
         self.included = dict()
+        self.currentMessage = None
         self.typedefed = dict()
         self.builtinTypeMap = {
             'onoff': 'bool',
@@ -134,6 +135,41 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
             for ns in nameSpaceList:
                 stream.write(self.getIndent() + '} ' + self.commentLineBeginWith + ' end of namespace %s \n' % ns)
 
+    def isViewable(self, field):
+        """A repeated native represented as repeated bytes may be serialized from views on the caller's bytes."""
+        if field.qualifier != 'repeated':
+            return False
+        repLine = self.getRepresentationFor(field.typeid.name)
+        return (repLine is not None and repLine.hasQualifier()
+                and repLine.qualifier == 'repeated' and repLine.representation == 'byte')
+
+    def fieldsOf(self, msg):
+        fields = []
+        for field in msg.fields:
+            if isinstance(field, GenMsgAST.MessageType.CombinedField):
+                fields.extend(field.fields)
+            else:
+                fields.append(field)
+        return fields
+
+    def pooledVectors(self, msg):
+        """The vectors of a pooled message, whose capacity is kept for the next message."""
+        vectors = []
+        if msg.pooled:
+            for field in self.fieldsOf(msg):
+                if field.qualifier == 'repeated':
+                    vectors.append(field.name)
+                    if self.isViewable(field):
+                        vectors.append('_%sViews' % field.name)
+        return vectors
+
+    def writeResizeStatement(self, stream, msg, name, size):
+        stream.write(self.getIndent())
+        if msg is not None and msg.pooled:
+            stream.write('MessagePool<%s>::resize(%s, %s);\n' % (msg.name, name, size))
+        else:
+            stream.write('%s.resize(%s);\n' % (name, size))
+
     def writeOneGetterSetterDecl(self, stream, field):
         targetTypeName = self.getTargetTypeName(field.typeid.name)
 
@@ -158,6 +194,9 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
                 stream.write(self.getIndent() + targetTypeName + '& get' + self.upperFirst(field.name) + '(uint32_t rank);\n')
                 stream.write(self.getIndent() + 'void set' + self.upperFirst(field.name) + '(const ' + targetTypeName + '& new' + self.upperFirst(field.name) + ', uint32_t rank);\n')
                 stream.write(self.getIndent() + 'void remove' + self.upperFirst(field.name) + '(uint32_t rank);\n')
+                if self.isViewable(field):
+                    stream.write(self.getIndent() + '/// Serialize the value of rank from bytes of the caller, which must outlive the serialization.\n')
+                    stream.write(self.getIndent() + 'void set' + self.upperFirst(field.name) + 'View(const void* data, uint32_t size, uint32_t rank);\n')
             else:
                 stream.write(self.getIndent() + 'const ' + targetTypeName + '& get' + self.upperFirst(field.name) + '() const;\n')
                 stream.write(self.getIndent() + 'void set' + self.upperFirst(field.name) + '(const ' + targetTypeName + '& new' + self.upperFirst(field.name) + ');\n')
@@ -249,7 +288,7 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
                 stream.write(self.getIndent() + 'void ' + msg.name + '::set' + self.upperFirst(field.name) + 'Size(uint32_t num)\n')
                 stream.write(self.getIndent() + '{\n')
                 self.indent()
-                stream.write(self.getIndent() + field.name + '.resize(num);\n')
+                self.writeResizeStatement(stream, msg, field.name, 'num')
                 self.unIndent()
                 stream.write(self.getIndent() + '}\n\n')
 
@@ -278,6 +317,12 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
                 stream.write(self.getIndent() + '{\n')
                 self.indent()
                 stream.write(self.getIndent() + field.name + '[rank] = new' + self.upperFirst(field.name) + ';\n')
+                if self.isViewable(field):
+                    stream.write(self.getIndent() + 'if (rank < _' + field.name + 'Views.size()) {\n')
+                    self.indent()
+                    stream.write(self.getIndent() + '_' + field.name + 'Views[rank] = ValueView();\n')
+                    self.unIndent()
+                    stream.write(self.getIndent() + '}\n')
                 self.unIndent()
                 stream.write(self.getIndent() + '}\n\n')
 
@@ -285,8 +330,29 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
                 stream.write(self.getIndent() + '{\n')
                 self.indent()
                 stream.write(self.getIndent() + field.name + '.erase(' + field.name + '.begin() + rank);\n')
+                if self.isViewable(field):
+                    stream.write(self.getIndent() + 'if (rank < _' + field.name + 'Views.size()) {\n')
+                    self.indent()
+                    stream.write(self.getIndent() + '_' + field.name + 'Views.erase(_' + field.name + 'Views.begin() + rank);\n')
+                    self.unIndent()
+                    stream.write(self.getIndent() + '}\n')
                 self.unIndent()
                 stream.write(self.getIndent() + '}\n\n')
+
+                if self.isViewable(field):
+                    stream.write(self.getIndent() + 'void ' + msg.name + '::set' + self.upperFirst(field.name) + 'View(const void* data, uint32_t size, uint32_t rank)\n')
+                    stream.write(self.getIndent() + '{\n')
+                    self.indent()
+                    stream.write(self.getIndent() + self.commentLineBeginWith + ' Views are only allocated by the messages using them\n')
+                    stream.write(self.getIndent() + 'if (_' + field.name + 'Views.size() < ' + field.name + '.size()) {\n')
+                    self.indent()
+                    stream.write(self.getIndent() + '_' + field.name + 'Views.resize(' + field.name + '.size());\n')
+                    self.unIndent()
+                    stream.write(self.getIndent() + '}\n')
+                    stream.write(self.getIndent() + field.name + '[rank].clear();\n')
+                    stream.write(self.getIndent() + '_' + field.name + 'Views[rank] = ValueView(data, size);\n')
+                    self.unIndent()
+                    stream.write(self.getIndent() + '}\n\n')
             else:
                 stream.write(self.getIndent() + 'const ' + targetTypeName + '& ' + msg.name + '::get' + self.upperFirst(field.name) + '() const\n')
                 stream.write(self.getIndent() + '{\n')
@@ -336,6 +402,11 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
             stream.write(self.getIndent() + 'bool _has%s {false};\n'
                          % self.upperFirst(field.name))
 
+        # viewable field generate the views set in place of values
+        if self.isViewable(field):
+            stream.write(self.getIndent() + 'std::vector<ValueView> _%sViews;\n'
+                         % field.name)
+
     def generateEnum(self, stream, enum):
         self.writeComment(stream, enum)
         stream.write(self.getIndent())
@@ -387,6 +458,9 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
 
         stream.write(self.commentLineBeginWith
                      + ' ****-**** Global System includes ****-****\n')
+        if [msg for msg in self.AST.messages if msg.pooled]:
+            stream.write('#include <cstddef>\n')
+            self.included['#include <cstddef>'] = 1
         stream.write('#include <string>\n')
         self.included['#include <string>'] = 1
         stream.write('#include <vector>\n')
@@ -500,9 +574,23 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
                     stream.write(self.getIndent() + msg.name + '();\n')
                 else:
                     stream.write(self.getIndent() + msg.name + '() = default;\n')
-                        
-                stream.write(self.getIndent() + virtual + '~'
-                             + msg.name + '() = default;\n')
+
+                if self.pooledVectors(msg):
+                    # the vectors are taken from the pool, and given back to it
+                    stream.write(self.getIndent() + '%s(const %s& other);\n' % (msg.name, msg.name))
+                    stream.write(self.getIndent() + '%s(%s&& other) = default;\n' % (msg.name, msg.name))
+                    stream.write(self.getIndent() + '%s& operator=(const %s& other);\n' % (msg.name, msg.name))
+                    stream.write(self.getIndent() + '%s& operator=(%s&& other) = default;\n' % (msg.name, msg.name))
+                    stream.write(self.getIndent() + virtual + '~' + msg.name + '();\n')
+                else:
+                    stream.write(self.getIndent() + virtual + '~'
+                                 + msg.name + '() = default;\n')
+
+                if msg.pooled:
+                    stream.write(self.getIndent() + '\n')
+                    stream.write(self.getIndent() + '/// The memory of a destroyed message is reused by the next one, see MessagePool.\n')
+                    stream.write(self.getIndent() + 'static void* operator new(std::size_t size);\n')
+                    stream.write(self.getIndent() + 'static void operator delete(void* block, std::size_t size);\n')
                 
                 stream.write(self.getIndent() + '\n')
                  
@@ -596,6 +684,16 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
                     stream.write(' ,%s' % exception)
                 stream.write('); \n')
 
+                # the buffer of the connection, the one above is per thread
+                stream.write(self.getIndent()
+                             + 'static %s* %s(%s stream, %s& msgBuffer) throw ('
+                             % (self.AST.factory.receiver
+                                + (self.serializeBufferType, )))
+                stream.write('%s' % self.exception[0])
+                for exception in self.exception[1:]:
+                    stream.write(' ,%s' % exception)
+                stream.write('); \n')
+
             self.unIndent()
 
             # end public
@@ -676,6 +774,16 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
                     if methodName != None and repLine.hasQualifier():
                         if repLine.qualifier == 'repeated':
                             stream.write(self.commentLineBeginWith + "serialize native whose representation is 'repeated' %s \n" % repLine.representation)
+                            if self.isViewable(field):
+                                stream.write(self.getIndent() + 'if (i < _' + field.name + 'Views.size() && _' + field.name + 'Views[i].data) {\n')
+                                self.indent()
+                                stream.write(self.getIndent() + 'msgBuffer.' + self.getSerializeMethodName('uint32'))
+                                stream.write('(_' + field.name + 'Views[i].size);\n')
+                                stream.write(self.getIndent() + 'msgBuffer.' + self.getSerializeMethodName(repLine.representation) + 's')
+                                stream.write('(_' + field.name + 'Views[i].data, _' + field.name + 'Views[i].size);\n')
+                                stream.write(self.getIndent() + 'continue;\n')
+                                self.unIndent()
+                                stream.write(self.getIndent() + '}\n')
                             stream.write(self.getIndent() + 'msgBuffer.'+ self.getSerializeMethodName('uint32'))
                             stream.write('('+field.name + indexField + '.size()' +');\n')
                             stream.write(self.getIndent() + 'msgBuffer.'+ self.getSerializeMethodName(repLine.representation)+'s')
@@ -766,9 +874,9 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
             stream.write(self.getIndent())
             stream.write('uint32_t ' + field.name
                          + 'Size = msgBuffer.read_uint32();\n')
-            stream.write(self.getIndent())
-            stream.write(field.name + '.resize(' + field.name
-                         + 'Size);\n')
+            self.writeResizeStatement(stream, self.currentMessage, field.name, field.name + 'Size')
+            if self.isViewable(field):
+                stream.write(self.getIndent() + '_' + field.name + 'Views.clear();\n')
             stream.write(self.getIndent())
             stream.write('for (uint32_t i = 0; i < ' + field.name
                          + 'Size; ++i) {\n')
@@ -910,30 +1018,35 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
 
         self.indent()
         stream.write(self.getIndent() + self.commentLineBeginWith
-                     + ' FIXME This is not thread safe\n')
-        stream.write(self.getIndent() + 'static %s msgBuffer;\n'
+                     + ' One buffer per thread, the RTIA may run in the federate process\n')
+        stream.write(self.getIndent() + 'static thread_local %s msgBuffer;\n'
                      % self.serializeBufferType)
-        stream.write(self.getIndent() + '%s  msgGen;\n' % receiver[0])
-        stream.write(self.getIndent() + '''%s* msg;
+        stream.write(self.getIndent() + 'return %s::%s(stream, msgBuffer);\n'
+                     % (receiver[1], receiver[2]))
+        self.unIndent()
+        stream.write(self.getIndent() + '''} /* end of %s::%s */ 
 
-''' % receiver[0])
-        stream.write(self.getIndent() + self.commentLineBeginWith
-                     + ' receive generic message \n')
-        stream.write(self.getIndent()
-                     + 'msgGen.receive(stream,msgBuffer);\n')
-        stream.write(self.getIndent() + self.commentLineBeginWith
-                     + ' create specific message from type \n')
+'''
+                     % (receiver[1], receiver[2]))
 
-        stream.write(self.getIndent() + 'msg = ')
-        stream.write(self.AST.factory.name + '::'
-                     + self.AST.factory.creator[1] + '(msgGen.%s);\n'
-                     % self.messageTypeGetter)
+        stream.write(self.getIndent() + '%s* %s::%s(%s stream, %s& msgBuffer) throw ('
+                     % (receiver + (self.serializeBufferType, )))
+        stream.write('%s' % self.exception[0])
+        for exception in self.exception[1:]:
+            stream.write(' ,%s' % exception)
+        stream.write(') { \n')
 
-        stream.write(self.getIndent()
-                     + 'msgBuffer.assumeSizeFromReservedBytes();\n')
+        self.indent()
+        stream.write(self.getIndent() + self.commentLineBeginWith
+                     + ' receive the message, then decode it once its type is known \n')
+        stream.write(self.getIndent() + '%s::receiveBytes(stream, msgBuffer);\n'
+                     % receiver[0])
+        stream.write(self.getIndent() + 'std::unique_ptr<%s> msg(%s::%s(%s::peekType(msgBuffer)));\n'
+                     % (receiver[0], self.AST.factory.name,
+                        self.AST.factory.creator[1], receiver[0]))
         stream.write(self.getIndent() + 'msg->deserialize(msgBuffer);\n'
                      )
-        stream.write(self.getIndent() + 'return msg;\n')
+        stream.write(self.getIndent() + 'return msg.release();\n')
         self.unIndent()
         stream.write(self.getIndent() + '''} /* end of %s::%s */ 
 
@@ -953,12 +1066,48 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
             else:
                 applyObject(stream, field)
 
+    def writePooledCopyAndDestructor(self, stream, msg):
+        """A copy takes the vectors of the pool, the destructor gives them back."""
+        stream.write(self.getIndent() + '%s::%s(const %s& other) : %s()\n' % (msg.name, msg.name, msg.name, msg.name))
+        stream.write('{\n')
+        self.indent()
+        stream.write(self.getIndent() + '*this = other;\n')
+        self.unIndent()
+        stream.write(self.getIndent() + '}\n\n')
+
+        stream.write(self.getIndent() + '%s& %s::operator=(const %s& other)\n' % (msg.name, msg.name, msg.name))
+        stream.write('{\n')
+        self.indent()
+        if msg.hasMerge():
+            stream.write(self.getIndent() + 'Super::operator=(other);\n')
+        for field in self.fieldsOf(msg):
+            if field.qualifier == 'repeated':
+                stream.write(self.getIndent() + 'MessagePool<%s>::assign(%s, other.%s);\n' % (msg.name, field.name, field.name))
+                if self.isViewable(field):
+                    stream.write(self.getIndent() + '_%sViews = other._%sViews;\n' % (field.name, field.name))
+            else:
+                stream.write(self.getIndent() + '%s = other.%s;\n' % (field.name, field.name))
+                if field.qualifier == 'optional':
+                    stream.write(self.getIndent() + '_has%s = other._has%s;\n' % (self.upperFirst(field.name), self.upperFirst(field.name)))
+        stream.write(self.getIndent() + 'return *this;\n')
+        self.unIndent()
+        stream.write(self.getIndent() + '}\n\n')
+
+        stream.write(self.getIndent() + '%s::~%s()\n' % (msg.name, msg.name))
+        stream.write('{\n')
+        self.indent()
+        for vector in self.pooledVectors(msg):
+            stream.write(self.getIndent() + 'MessagePool<%s>::keep(%s);\n' % (msg.name, vector))
+        self.unIndent()
+        stream.write(self.getIndent() + '}\n\n')
+
     def generateBody(self, stream, factoryOnly=False):
         """
         Generate the body.
         """
         self.addGeneratedByLine(stream)
         # add necessary standard includes
+        stream.write('#include <memory>\n')
         stream.write('#include <string>\n')
         stream.write('#include <vector>\n')
         # [Try to] add corresponding header include
@@ -968,6 +1117,8 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
             supposedHeaderName = os.path.basename(supposedHeaderName)
             supposedHeaderName = os.path.splitext(supposedHeaderName)[0]
             stream.write('#include "' + supposedHeaderName + '.hh"\n')
+        if [msg for msg in self.AST.messages if msg.pooled]:
+            stream.write('#include "MessagePool.hh"\n')
 
         # Generate namespace for specified package package
         # we may have nested namespace
@@ -991,6 +1142,25 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
                         stream.write(self.getIndent() + 'this->type = ' + msg.name.upper().replace(self.replacePrefix[0], self.replacePrefix[1], 1) + ';\n')
                     else:
                         stream.write(self.getIndent() + 'this->type = ' + msg.name.upper() + ';\n')
+                    for vector in self.pooledVectors(msg):
+                        stream.write(self.getIndent() + 'MessagePool<%s>::take(%s);\n' % (msg.name, vector))
+                    self.unIndent()
+                    stream.write(self.getIndent() + '}\n\n')
+
+                if self.pooledVectors(msg):
+                    self.writePooledCopyAndDestructor(stream, msg)
+
+                if msg.pooled:
+                    stream.write(self.getIndent() + 'void* %s::operator new(std::size_t size)\n' % msg.name)
+                    stream.write('{\n')
+                    self.indent()
+                    stream.write(self.getIndent() + 'return MessagePool<%s>::allocate(size);\n' % msg.name)
+                    self.unIndent()
+                    stream.write(self.getIndent() + '}\n\n')
+                    stream.write(self.getIndent() + 'void %s::operator delete(void* block, std::size_t size)\n' % msg.name)
+                    stream.write('{\n')
+                    self.indent()
+                    stream.write(self.getIndent() + 'MessagePool<%s>::release(block, size);\n' % msg.name)
                     self.unIndent()
                     stream.write(self.getIndent() + '}\n\n')
 
@@ -1023,7 +1193,9 @@ class CXXGenerator(GenMsgBase.CodeGenerator):
                         stream.write(self.getIndent() + self.commentLineBeginWith + ' Call parent class\n')
                         stream.write(self.getIndent() + 'Super::deserialize(msgBuffer);\n')
                     stream.write(self.getIndent() + self.commentLineBeginWith + ' Specific deserialization code\n')
+                    self.currentMessage = msg
                     self.applyToFields(stream, msg.fields, self.writeDeSerializeFieldStatement)
+                    self.currentMessage = None
                     self.unIndent()
                     stream.write(self.getIndent() + '}\n\n')
 
@@ -193,6 +193,7 @@ reserved = {
     'native': 'NATIVE',
     'language': 'LANGUAGE',
     'message': 'MESSAGE',
+    'pooled': 'POOLED',
     'merge': 'MERGE',
     'enum': 'ENUM',
     'default': 'DEFAULT',
@@ -434,24 +435,32 @@ def p_factory_receiver(p):
 
 
 def p_message(p):
-    '''message : MESSAGE ID LBRACE RBRACE 
-               | MESSAGE ID LBRACE field_list RBRACE 
-               | MESSAGE ID COLON MERGE ID LBRACE RBRACE 
-               | MESSAGE ID COLON MERGE ID LBRACE field_list RBRACE'''
+    '''message : message_keyword ID LBRACE RBRACE 
+               | message_keyword ID LBRACE field_list RBRACE 
+               | message_keyword ID COLON MERGE ID LBRACE RBRACE 
+               | message_keyword ID COLON MERGE ID LBRACE field_list RBRACE'''
 
     if len(p) == 5:
-        p[0] = GenMsgAST.MessageType(p[2], [], None)
+        p[0] = GenMsgAST.MessageType(p[2], [], None, p[1])
     elif len(p) == 6:
         p[4].reverse()
-        p[0] = GenMsgAST.MessageType(p[2], p[4], None)
+        p[0] = GenMsgAST.MessageType(p[2], p[4], None, p[1])
     elif len(p) == 8:
-        p[0] = GenMsgAST.MessageType(p[2], [], p[5])
+        p[0] = GenMsgAST.MessageType(p[2], [], p[5], p[1])
     elif len(p) == 9:
         p[7].reverse()
-        p[0] = GenMsgAST.MessageType(p[2], p[7], p[5])
+        p[0] = GenMsgAST.MessageType(p[2], p[7], p[5], p[1])
     p[0].linespan = (p.linespan(1)[0], p.linespan(len(p) - 1)[1])
 
 
+def p_message_keyword(p):
+    '''message_keyword : MESSAGE
+                       | POOLED MESSAGE'''
+
+    # a pooled message reuses the memory of the previous ones
+    p[0] = len(p) == 3
+
+
 def p_native(p):
     '''native : NATIVE ID LBRACE native_line_list RBRACE'''
 
@@ -0,0 +1,49 @@
+/* ----------------------------------------------------------------------------
+ * CERTI - HLA RunTime Infrastructure
+ * Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+ *
+ * This program is free software ; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation ; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY ; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program ; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+ * USA
+ */
+
+// Print the binary audit file of the RTIG as text.
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+#include <include/certi.hh>
+#include <libCERTI/AuditFile.hh>
+
+int main(int argc, char** argv)
+{
+    const std::string file_name = argc > 1 ? argv[1] : RTIG_AUDIT_FILENAME;
+
+    std::ifstream audit_file(file_name, std::ios::binary);
+    if (!audit_file.is_open()) {
+        std::cerr << "Could not open audit file " << file_name << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    try {
+        certi::AuditFile::decode(audit_file, std::cout);
+    }
+    catch (certi::Exception& e) {
+        std::cerr << file_name << ": " << e.reason() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "libCERTI/AuditFile.hh"
+
+using ::certi::AuditFile;
+using ::certi::AuditLine;
+
+namespace {
+static const std::string file_name{"auditfile_test.audit"};
+
+static const auto normal = AuditLine::Status(::certi::Exception::Type::NO_EXCEPTION);
+
+/// Remove the audit file written by a test.
+class AuditFileTest : public ::testing::Test {
+protected:
+    AuditFileTest()
+    {
+        std::remove(file_name.c_str());
+    }
+
+    ~AuditFileTest()
+    {
+        std::remove(file_name.c_str());
+    }
+
+    /// The text lines of the audit file, without the legend and the dates.
+    static std::vector<std::string> decodedLines()
+    {
+        std::ifstream file(file_name, std::ios::binary);
+        std::stringstream text;
+        AuditFile::decode(file, text);
+
+        std::vector<std::string> lines;
+        std::string line;
+        std::getline(text, line);
+        while (std::getline(text, line)) {
+            lines.push_back(line.substr(line.find('\t') + 1));
+        }
+        return lines;
+    }
+};
+}
+
+TEST_F(AuditFileTest, LinesAboveTheLevelAreWritten)
+{
+    {
+        AuditFile audit(file_name);
+
+        audit.startLine(1, 2, AuditLine::Type(3));
+        audit.setLevel(AuditLine::Level(9));
+        audit << "Socket " << 7;
+        audit.endLine(normal, " - OK");
+
+        // Below AUDIT_CURRENT_LEVEL
+        audit.startLine(1, 2, AuditLine::Type(4));
+        audit.endLine(normal, " - OK");
+
+        // An error is always written
+        audit.startLine(1, 2, AuditLine::Type(5));
+        audit.endLine(AuditLine::Status(::certi::Exception::Type::RTIinternalError), "failed");
+
+        audit.flush();
+        ASSERT_EQ(3u, decodedLines().size());
+    }
+
+    auto lines = decodedLines();
+    ASSERT_EQ(4u, lines.size());
+    ASSERT_EQ("0\t0\t128\t10\t0\t", lines[0]);
+    ASSERT_EQ("1\t2\t3\t9\t0\tSocket 7 - OK", lines[1]);
+    ASSERT_EQ("1\t2\t5\t0\t" + std::to_string(static_cast<int>(::certi::Exception::Type::RTIinternalError))
+                  + "\tfailed",
+              lines[2]);
+    ASSERT_EQ("0\t0\t129\t10\t0\t", lines[3]);
+
+    // A new run appends its lines
+    AuditFile(file_name).flush();
+    ASSERT_EQ(6u, decodedLines().size());
+}
+
+TEST_F(AuditFileTest, LinesAreDroppedWhenTheBufferIsFull)
+{
+    {
+        AuditFile audit(file_name, 128);
+
+        audit.startLine(1, 2, AuditLine::Type(3));
+        audit.setLevel(AuditLine::Level(9));
+        audit << std::string(200, 'x');
+        audit.endLine(normal, "");
+        audit.flush();
+
+        ASSERT_EQ(1u, audit.getDroppedLines());
+    }
+
+    auto lines = decodedLines();
+    ASSERT_EQ(3u, lines.size());
+    ASSERT_EQ("0\t0\t130\t10\t0\t1 audit lines lost", lines[1]);
+}
+
+TEST_F(AuditFileTest, DecodeRejectsOtherFiles)
+{
+    std::stringstream text("date\tfed-o\tfed\ttype\tlevel\tstatus\tcomment\n");
+    std::stringstream output;
+    ASSERT_THROW(AuditFile::decode(text, output), ::certi::RTIinternalError);
+
+    {
+        AuditFile audit(file_name);
+    }
+    std::ifstream file(file_name, std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    std::stringstream truncated(content.substr(0, content.size() - 3));
+    ASSERT_THROW(AuditFile::decode(truncated, output), ::certi::RTIinternalError);
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include <libCERTI/FomNameCache.hh>
+#include <libCERTI/M_Classes.hh>
+
+using ::certi::FomNameCache;
+using ::certi::M_Join_Federation_Execution_V4;
+
+using Kind = FomNameCache::Kind;
+
+namespace {
+void setName(::certi::FomName& fomName, const ::certi::Handle owner, const ::certi::Handle handle, const std::string& name)
+{
+    fomName.setOwner(owner);
+    fomName.setHandle(handle);
+    fomName.setName(name);
+}
+
+M_Join_Federation_Execution_V4 joinAnswer()
+{
+    M_Join_Federation_Execution_V4 answer;
+    answer.setObjectClassNamesSize(2);
+    setName(answer.getObjectClassNames(0), 0, 1, "ObjectRoot");
+    setName(answer.getObjectClassNames(1), 0, 2, "Data");
+    answer.setAttributeNamesSize(2);
+    setName(answer.getAttributeNames(0), 1, 1, "privilegeToDelete");
+    setName(answer.getAttributeNames(1), 2, 3, "Attr1");
+    answer.setInteractionClassNamesSize(1);
+    setName(answer.getInteractionClassNames(0), 0, 1, "InteractionRoot");
+    answer.setParameterNamesSize(1);
+    setName(answer.getParameterNames(0), 1, 4, "Param");
+    return answer;
+}
+}
+
+TEST(FomNameCache, NamesOfTheJoinAnswerAreFound)
+{
+    FomNameCache cache;
+    ASSERT_EQ(0u, cache.getHandle(Kind::ObjectClass, "Data"));
+
+    auto answer = joinAnswer();
+    libhla::MessageBuffer buffer;
+    answer.serialize(buffer);
+    M_Join_Federation_Execution_V4 received;
+    received.deserialize(buffer);
+    cache.assign(received);
+
+    ASSERT_EQ(2u, cache.getHandle(Kind::ObjectClass, "Data"));
+    ASSERT_EQ("Data", *cache.getName(Kind::ObjectClass, 2));
+    ASSERT_EQ(3u, cache.getHandle(Kind::Attribute, "Attr1", 2));
+    ASSERT_EQ("Attr1", *cache.getName(Kind::Attribute, 3, 2));
+    ASSERT_EQ(1u, cache.getHandle(Kind::InteractionClass, "InteractionRoot"));
+    ASSERT_EQ("Param", *cache.getName(Kind::Parameter, 4, 1));
+
+    // Attributes and parameters are names of their class
+    ASSERT_EQ(0u, cache.getHandle(Kind::Attribute, "Attr1", 1));
+    ASSERT_EQ(nullptr, cache.getName(Kind::Attribute, 3, 1));
+    ASSERT_EQ(0u, cache.getHandle(Kind::Parameter, "Attr1", 2));
+
+    cache.clear();
+    ASSERT_EQ(0u, cache.getHandle(Kind::ObjectClass, "Data"));
+    ASSERT_EQ(nullptr, cache.getName(Kind::ObjectClass, 2));
+}
+
+TEST(FomNameCache, OnlyNamesResolvedExactlyAreAdded)
+{
+    FomNameCache cache;
+    cache.assign(joinAnswer());
+
+    // The qualified names
+    cache.addHandle(Kind::ObjectClass, 0, "ObjectRoot.Data", 2);
+    ASSERT_EQ(2u, cache.getHandle(Kind::ObjectClass, "ObjectRoot.Data"));
+    cache.addHandle(Kind::ObjectClass, 0, "Data.Sub", 5);
+    ASSERT_EQ(5u, cache.getHandle(Kind::ObjectClass, "Data.Sub"));
+
+    // not the short ones
+    cache.addHandle(Kind::ObjectClass, 0, "Sub", 5);
+    ASSERT_EQ(0u, cache.getHandle(Kind::ObjectClass, "Sub"));
+    cache.addHandle(Kind::ObjectClass, 0, "ObjectRoot.Sub", 5);
+    ASSERT_EQ(0u, cache.getHandle(Kind::ObjectClass, "ObjectRoot.Sub"));
+
+    // unless they are the name of the class
+    cache.add(Kind::ObjectClass, 0, 6, "Other");
+    cache.addHandle(Kind::ObjectClass, 0, "ObjectRoot.Other", 6);
+    ASSERT_EQ(6u, cache.getHandle(Kind::ObjectClass, "ObjectRoot.Other"));
+
+    cache.addHandle(Kind::Attribute, 5, "Attr2", 4);
+    ASSERT_EQ(4u, cache.getHandle(Kind::Attribute, "Attr2", 5));
+    ASSERT_EQ(nullptr, cache.getName(Kind::Attribute, 4, 5));
+}
@@ -0,0 +1,39 @@
+#ifdef BENCHMARK_LBTS
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+
+#include <libCERTI/LBTS.hh>
+
+using ::certi::LBTS;
+
+namespace {
+static constexpr int regulators{200};
+static constexpr int rounds{1000};
+}
+
+/// Every regulator advances in turn, as null messages do in a federation.
+TEST(LBTSBenchmark, NullMessagesFromManyRegulators)
+{
+    LBTS lbts;
+    for (int i{1}; i <= regulators; ++i) {
+        lbts.insert(i, 0.0);
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int round{1}; round <= rounds; ++round) {
+        for (int i{1}; i <= regulators; ++i) {
+            lbts.update(i, static_cast<double>(round));
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    ASSERT_EQ(::certi::FederationTime(rounds), lbts.getLBTSValue());
+
+    std::cerr << "LBTS update with " << regulators << " regulators: "
+              << std::chrono::nanoseconds(end - start).count() / (rounds * regulators) << " ns" << std::endl;
+}
+
+#endif
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <libCERTI/Exception.hh>
+#include <libCERTI/LBTS.hh>
+
+using ::certi::FederationTime;
+using ::certi::LBTS;
+
+TEST(LBTSTest, EmptyIsInfinite)
+{
+    LBTS lbts;
+    ASSERT_TRUE(lbts.getLBTSValue().isPositiveInfinity());
+}
+
+TEST(LBTSTest, LBTSIsTheSmallestClock)
+{
+    LBTS lbts;
+    lbts.insert(1, 10.0);
+    lbts.insert(2, 5.0);
+    lbts.insert(3, 7.0);
+
+    ASSERT_EQ(FederationTime(5.0), lbts.getLBTSValue());
+
+    lbts.update(2, 8.0);
+    ASSERT_EQ(FederationTime(7.0), lbts.getLBTSValue());
+
+    lbts.remove(3);
+    ASSERT_EQ(FederationTime(8.0), lbts.getLBTSValue());
+}
+
+TEST(LBTSTest, OwnClockIsIgnored)
+{
+    LBTS lbts;
+    lbts.setFederate(1);
+    lbts.insert(1, 1.0);
+    lbts.insert(2, 5.0);
+
+    ASSERT_EQ(FederationTime(5.0), lbts.getLBTSValue());
+
+    lbts.remove(2);
+    ASSERT_TRUE(lbts.getLBTSValue().isPositiveInfinity());
+}
+
+TEST(LBTSTest, UpdateNeverMovesClockBackward)
+{
+    LBTS lbts;
+    lbts.insert(1, 10.0);
+    lbts.update(1, 5.0);
+
+    ASSERT_EQ(FederationTime(10.0), lbts.get(1));
+}
+
+TEST(LBTSTest, SetMovesClockBackward)
+{
+    LBTS lbts;
+    lbts.insert(1, 10.0);
+    lbts.insert(2, 20.0);
+    lbts.set(2, 5.0);
+
+    ASSERT_EQ(FederationTime(5.0), lbts.get(2));
+    ASSERT_EQ(FederationTime(5.0), lbts.getLBTSValue());
+}
+
+TEST(LBTSTest, AnonymousUpdateMovesAllLateClocks)
+{
+    LBTS lbts;
+    lbts.insert(1, 2.0);
+    lbts.insert(2, 4.0);
+    lbts.insert(3, 9.0);
+    lbts.update(0, 6.0);
+
+    ASSERT_TRUE(lbts.hasReceivedAnonymousUpdate());
+    ASSERT_EQ(FederationTime(6.0), lbts.get(1));
+    ASSERT_EQ(FederationTime(6.0), lbts.get(2));
+    ASSERT_EQ(FederationTime(9.0), lbts.get(3));
+    ASSERT_EQ(FederationTime(6.0), lbts.getLBTSValue());
+}
+
+TEST(LBTSTest, UnknownFederateThrows)
+{
+    LBTS lbts;
+    lbts.insert(1, 0.0);
+
+    ASSERT_THROW(lbts.insert(1, 0.0), ::certi::RTIinternalError);
+    ASSERT_THROW(lbts.update(2, 0.0), ::certi::RTIinternalError);
+    ASSERT_THROW(lbts.set(2, 0.0), ::certi::RTIinternalError);
+    ASSERT_THROW(lbts.get(2), ::certi::RTIinternalError);
+    ASSERT_THROW(lbts.remove(2), ::certi::RTIinternalError);
+}
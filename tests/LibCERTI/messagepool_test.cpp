@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <libCERTI/NM_Classes.hh>
+
+using ::certi::AttributeValue_t;
+using ::certi::NM_Message_Null;
+using ::certi::NM_Reflect_Attribute_Values;
+using ::certi::NM_Update_Attribute_Values;
+using ::certi::NetworkMessage;
+
+namespace {
+AttributeValue_t value(const std::string& text)
+{
+    return AttributeValue_t(begin(text), end(text));
+}
+
+std::unique_ptr<NM_Reflect_Attribute_Values> reflect(const uint32_t size, const std::string& text)
+{
+    std::unique_ptr<NM_Reflect_Attribute_Values> message(new NM_Reflect_Attribute_Values());
+    message->setObject(42);
+    message->setAttributesSize(size);
+    message->setValuesSize(size);
+    for (uint32_t i = 0; i < size; ++i) {
+        message->setAttributes(i + 1, i);
+        message->setValues(value(text), i);
+    }
+    return message;
+}
+}
+
+TEST(MessagePool, MemoryOfADeletedMessageIsReused)
+{
+    std::unique_ptr<NetworkMessage> message(new NM_Update_Attribute_Values());
+    const auto* block = message.get();
+
+    message.reset();
+    message.reset(new NM_Update_Attribute_Values());
+    ASSERT_EQ(block, message.get());
+
+    // Types are pooled apart
+    std::unique_ptr<NetworkMessage> null(new NM_Message_Null());
+    ASSERT_NE(static_cast<void*>(null.get()), static_cast<void*>(message.get()));
+}
+
+TEST(MessagePool, NewMessageIsEmptyButKeepsTheBuffers)
+{
+    reflect(3, std::string(100, 'v')).reset();
+
+    auto message = std::unique_ptr<NM_Reflect_Attribute_Values>(new NM_Reflect_Attribute_Values());
+    ASSERT_EQ(0u, message->getAttributesSize());
+    ASSERT_EQ(0u, message->getValuesSize());
+    ASSERT_LE(3u, message->getAttributes().capacity());
+    ASSERT_LE(3u, message->getValues().capacity());
+
+    message->setValuesSize(2);
+    ASSERT_TRUE(message->getValues(0).empty());
+    ASSERT_LE(100u, message->getValues(0).capacity());
+    ASSERT_LE(100u, message->getValues(1).capacity());
+}
+
+TEST(MessagePool, DeserializedMessageKeepsTheBuffers)
+{
+    libhla::MessageBuffer buffer;
+    reflect(2, std::string(50, 'v'))->serialize(buffer);
+
+    auto message = reflect(2, std::string(200, 'w'));
+    message.reset();
+
+    message.reset(new NM_Reflect_Attribute_Values());
+    message->deserialize(buffer);
+    ASSERT_EQ(value(std::string(50, 'v')), message->getValues(1));
+    ASSERT_LE(200u, message->getValues(1).capacity());
+}
+
+TEST(MessagePool, CopiesAreEqual)
+{
+    auto original = reflect(3, "value");
+    original->setLabel("label");
+
+    NM_Reflect_Attribute_Values copy(*original);
+    ASSERT_EQ(42u, copy.getObject());
+    ASSERT_EQ(original->getAttributes(), copy.getAttributes());
+    ASSERT_EQ(original->getValues(), copy.getValues());
+    ASSERT_EQ("label", copy.getLabel());
+
+    auto smaller = reflect(1, "other");
+    copy = *smaller;
+    ASSERT_EQ(smaller->getAttributes(), copy.getAttributes());
+    ASSERT_EQ(smaller->getValues(), copy.getValues());
+
+    auto moved = std::move(copy);
+    ASSERT_EQ(smaller->getValues(), moved.getValues());
+}
+
+TEST(MessagePool, MessageMayBeDeletedByAnotherThread)
+{
+    auto message = reflect(2, "value");
+
+    std::thread other([&message] {
+        const auto* block = message.get();
+        message.reset();
+        message = reflect(2, "other");
+        ASSERT_EQ(block, message.get());
+        message.reset();
+    });
+    other.join();
+
+    // The blocks of the other thread were released when it exited
+    message = reflect(2, "value");
+    ASSERT_EQ(value("value"), message->getValues(1));
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include "libCERTI/NM_Classes.hh"
 #include "libCERTI/NetworkMessage.hh"
 
 #include <include/make_unique.hh>
@@ -29,3 +30,94 @@ TEST(NetworkMessageTest, CopyCtorInUniquePtrExistsAndWorks)
     ASSERT_EQ(msg.getFederate(), msg2->getFederate());
     ASSERT_EQ(msg.getFederation(), msg2->getFederation());
 }
+
+namespace {
+void serialize(NetworkMessage& msg, libhla::MessageBuffer& buffer)
+{
+    msg.serialize(buffer);
+    buffer.updateReservedBytes();
+    buffer.assumeSizeFromReservedBytes();
+}
+}
+
+TEST(NetworkMessageTest, PeekTypeLeavesTheMessageToDecode)
+{
+    ::certi::NM_Update_Attribute_Values msg;
+    msg.setFederate(1);
+    msg.setObject(42);
+
+    libhla::MessageBuffer buffer;
+    serialize(msg, buffer);
+
+    auto type = NetworkMessage::peekType(buffer);
+    ASSERT_EQ(NetworkMessage::Type::UPDATE_ATTRIBUTE_VALUES, type);
+
+    std::unique_ptr<NetworkMessage> decoded(::certi::NM_Factory::create(type));
+    decoded->deserialize(buffer);
+    ASSERT_EQ(1u, decoded->getFederate());
+    ASSERT_EQ(42u, static_cast<::certi::NM_Update_Attribute_Values*>(decoded.get())->getObject());
+}
+
+TEST(NetworkMessageTest, PeekTypeThrowsOnInvalidType)
+{
+    libhla::MessageBuffer buffer;
+    buffer.write_int32(0x7fffffff);
+    buffer.updateReservedBytes();
+    buffer.assumeSizeFromReservedBytes();
+
+    ASSERT_THROW(NetworkMessage::peekType(buffer), ::certi::NetworkError);
+}
+
+TEST(NetworkMessageTest, NullMessageCarriesTheTimeStateOnlyWhenSet)
+{
+    ::certi::NM_Message_Null msg;
+    msg.setFederate(1);
+    msg.setDate(2.5);
+
+    libhla::MessageBuffer buffer;
+    serialize(msg, buffer);
+    const auto plain_size = buffer.size();
+
+    ::certi::NM_Message_Null decoded;
+    decoded.deserialize(buffer);
+    ASSERT_FALSE(decoded.hasTimeState());
+
+    ::certi::NM_Time_State state;
+    state.setTime(2.0);
+    state.setLookahead(0.5);
+    state.setState(true);
+    msg.setTimeState(state);
+
+    buffer.reset();
+    serialize(msg, buffer);
+    ASSERT_LT(plain_size, buffer.size());
+
+    ::certi::NM_Message_Null with_state;
+    with_state.deserialize(buffer);
+    ASSERT_TRUE(with_state.hasTimeState());
+    ASSERT_EQ(2.5, with_state.getDate().getTime());
+    ASSERT_EQ(2.0, with_state.getTimeState().getTime());
+    ASSERT_EQ(0.5, with_state.getTimeState().getLookahead());
+    ASSERT_TRUE(with_state.getTimeState().getState());
+}
+
+TEST(NetworkMessageTest, OnlyBestEffortReceiveOrderTrafficIsDroppable)
+{
+    ::certi::NM_Reflect_Attribute_Values reflection;
+    ASSERT_FALSE(reflection.isDroppable());
+
+    reflection.setBestEffort(true);
+    ASSERT_TRUE(reflection.isDroppable());
+
+    reflection.setDate(1.0);
+    ASSERT_FALSE(reflection.isDroppable());
+
+    ::certi::NM_Receive_Interaction interaction;
+    ASSERT_FALSE(interaction.isDroppable());
+    interaction.setBestEffort(true);
+    ASSERT_TRUE(interaction.isDroppable());
+
+    ::certi::NM_Message_Null other;
+    other.setBestEffort(true);
+    ASSERT_FALSE(other.isDroppable());
+}
@@ -1,7 +1,7 @@
-#ifdef BENCHMARK_ARRAY_FILL
-
 #include <gtest/gtest.h>
 
+#ifdef BENCHMARK_ARRAY_FILL
+
 #include <chrono>
 
 enum State {
@@ -306,3 +306,82 @@ TEST(ObjectClassBroadcastListBenchmark, initFill_notSub)
 }
 
 #endif
+
+#ifdef BENCHMARK_RAV_FAN_OUT
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <libCERTI/ObjectClassBroadcastList.hh>
+#include <libCERTI/SocketTCP.hh>
+
+#include "../mocks/securityserver_mock.h"
+
+namespace {
+
+/** Bytes serialized by the RTIG to deliver one update to every subscriber.
+ * Each response is encoded once whatever its number of recipients.
+ */
+uint32_t encodedBytesPerUpdate(const uint32_t subscribers, const uint32_t valueSize)
+{
+    static constexpr ::certi::AttributeHandle attributes{4};
+
+    std::vector<std::unique_ptr<::certi::SocketTCP>> sockets;
+    for (auto i(0u); i < subscribers; ++i) {
+        sockets.emplace_back(new ::certi::SocketTCP{});
+    }
+
+    ::certi::SocketServer s{new ::certi::SocketTCP{}, nullptr};
+    ::certi::AuditFile a{"tmp"};
+    MockSecurityServer ss(s, a, ::certi::FederationHandle(1));
+    for (auto i(0u); i < subscribers; ++i) {
+        EXPECT_CALL(ss, getSocketLink(::certi::FederateHandle(i + 2), ::testing::_))
+            .WillRepeatedly(::testing::Return(sockets[i].get()));
+    }
+
+    auto message = new ::certi::NM_Reflect_Attribute_Values;
+    message->setFederate(1);
+    message->setAttributesSize(attributes);
+    message->setValuesSize(attributes);
+    for (auto i(0u); i < attributes; ++i) {
+        message->setAttributes(i + 1, i);
+        message->setValues(::certi::AttributeValue_t(valueSize / attributes, 'x'), i);
+    }
+
+    ::certi::ObjectClassBroadcastList l(std::unique_ptr<::certi::NetworkMessage>{message}, attributes);
+    for (auto i(0u); i < subscribers; ++i) {
+        for (auto attr(1u); attr <= attributes; ++attr) {
+            l.addFederate(i + 2, attr);
+        }
+    }
+
+    uint32_t encoded{0};
+    MessageBuffer buffer;
+    for (auto& response : l.preparePendingMessage(ss)) {
+        buffer.reset();
+        response.message()->serialize(buffer);
+        encoded += buffer.size();
+    }
+
+    return encoded;
+}
+}
+
+TEST(ObjectClassBroadcastListBenchmark, RAVFanOutEncodedBytesPerSubscriberCount)
+{
+    static constexpr uint32_t valueSize{4096};
+
+    auto reference = encodedBytesPerUpdate(1, valueSize);
+
+    for (auto subscribers : {1u, 10u, 40u, 100u}) {
+        auto encoded = encodedBytesPerUpdate(subscribers, valueSize);
+
+        std::cerr << "RAV fan-out of " << valueSize << " bytes to " << subscribers
+                  << " subscribers: " << encoded << " bytes encoded" << std::endl;
+
+        ASSERT_EQ(reference, encoded);
+    }
+}
+
+#endif
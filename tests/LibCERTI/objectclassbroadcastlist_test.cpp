@@ -646,6 +646,61 @@ TEST(ObjectClassBroadcastListTest, PreparePendingRAVMessageAllWaitingSendsBaseMe
     ASSERT_MB_EQ(mb, mb2);
 }
 
+TEST(ObjectClassBroadcastListTest, PreparePendingRAVMessageAllWaitingShareOneResponse)
+{
+    auto message = new ::certi::NM_Reflect_Attribute_Values;
+    message->setFederate(sender_handle);
+    message->setAttributesSize(max_handle);
+
+    ::certi::SocketServer s{new certi::SocketTCP{}, nullptr};
+    ::certi::AuditFile a{"tmp"};
+    MockSecurityServer ss(s, a, ::certi::FederationHandle(3));
+    EXPECT_CALL(ss, getSocketLink(federate_handle, _)).WillOnce(::testing::ReturnNull());
+    EXPECT_CALL(ss, getSocketLink(federate2_handle, _)).WillOnce(::testing::ReturnNull());
+    EXPECT_CALL(ss, getSocketLink(federate3_handle, _)).WillOnce(::testing::ReturnNull());
+
+    ObjectClassBroadcastList l(std::unique_ptr<NetworkMessage>{message}, max_handle);
+
+    for (auto i(0u); i <= max_handle; ++i) {
+        l.addFederate(federate_handle, i);
+        l.addFederate(federate2_handle, i);
+    }
+    l.addFederate(federate3_handle, attr_handle);
+
+    auto result = l.preparePendingMessage(ss);
+
+    // one reduced message for federate3, one shared complete message
+    ASSERT_EQ(2u, result.size());
+    ASSERT_EQ(1u, result.front().sockets().size());
+    ASSERT_EQ(2u, result.back().sockets().size());
+}
+
+TEST(ObjectClassBroadcastListTest, ReleasePendingRAVMessageAllWaitingGetTheMessage)
+{
+    auto message = new ::certi::NM_Reflect_Attribute_Values;
+    message->setFederate(sender_handle);
+    message->setAttributesSize(max_handle);
+
+    ::certi::SocketServer s{new certi::SocketTCP{}, nullptr};
+    ::certi::AuditFile a{"tmp"};
+    MockSecurityServer ss(s, a, ::certi::FederationHandle(3));
+    EXPECT_CALL(ss, getSocketLink(federate_handle, _)).WillOnce(::testing::ReturnNull());
+    EXPECT_CALL(ss, getSocketLink(federate3_handle, _)).WillOnce(::testing::ReturnNull());
+
+    ObjectClassBroadcastList l(std::unique_ptr<NetworkMessage>{message}, max_handle);
+
+    for (auto i(0u); i <= max_handle; ++i) {
+        l.addFederate(federate_handle, i);
+    }
+    l.addFederate(federate3_handle, attr_handle);
+
+    auto result = l.releasePendingMessage(ss);
+
+    ASSERT_EQ(2u, result.size());
+    ASSERT_NE(message, result.front().message());
+    ASSERT_EQ(message, result.back().message());
+}
+
 /*TEST(ObjectClassBroadcastListTest, SendPendingRAVMessageNotAllWaitingSendsSmallerMessage)
 {
     auto message = new ::certi::NM_Reflect_Attribute_Values;
@@ -0,0 +1,66 @@
+#ifdef BENCHMARK_OBJECT_SET
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include <libCERTI/Object.hh>
+#include <libCERTI/ObjectAttribute.hh>
+#include <libCERTI/ObjectSet.hh>
+
+using ::certi::ObjectAttribute;
+using ::certi::ObjectSet;
+
+namespace {
+static constexpr ::certi::ObjectHandle instances{1000000};
+static constexpr ::certi::AttributeHandle attributes{8};
+
+long long microseconds(std::chrono::high_resolution_clock::duration duration)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+}
+}
+
+/// Registering, finding and deleting many instances, as the RTIG does for large federations.
+TEST(ObjectSetBenchmark, RegisterLookupDeleteManyInstances)
+{
+    ObjectSet objects(nullptr);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (::certi::ObjectHandle handle{1}; handle <= instances; ++handle) {
+        auto object = objects.registerObjectInstance(1, 1, handle, "object" + std::to_string(handle));
+        object->reserveAttributes(attributes);
+        for (::certi::AttributeHandle attribute{1}; attribute <= attributes; ++attribute) {
+            object->addAttribute(ObjectAttribute(attribute, 1, nullptr));
+        }
+    }
+    auto registered = std::chrono::high_resolution_clock::now();
+
+    size_t found{0};
+    for (::certi::ObjectHandle handle{1}; handle <= instances; ++handle) {
+        found += objects.getObject(handle)->getAttribute(handle % attributes + 1)->getOwner();
+    }
+    auto by_handle = std::chrono::high_resolution_clock::now();
+
+    for (::certi::ObjectHandle handle{1}; handle <= instances; ++handle) {
+        found += objects.getObjectInstanceHandle("object" + std::to_string(handle)) == handle;
+    }
+    auto by_name = std::chrono::high_resolution_clock::now();
+
+    for (::certi::ObjectHandle handle{1}; handle <= instances; ++handle) {
+        objects.deleteObjectInstance(1, handle, "");
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    ASSERT_EQ(2 * instances, found);
+    ASSERT_EQ(0u, objects.size());
+
+    std::cerr << instances << " instances of " << attributes << " attributes: register "
+              << microseconds(registered - start) << " us, lookup by handle " << microseconds(by_handle - registered)
+              << " us, by name " << microseconds(by_name - by_handle) << " us, delete "
+              << microseconds(end - by_name) << " us" << std::endl;
+}
+
+#endif
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <libCERTI/Object.hh>
+#include <libCERTI/ObjectAttribute.hh>
+#include <libCERTI/ObjectSet.hh>
+
+using ::certi::Object;
+using ::certi::ObjectAttribute;
+using ::certi::ObjectSet;
+
+TEST(ObjectSet, RegisteredObjectIsFoundByHandleAndName)
+{
+    ObjectSet objects(nullptr);
+    auto object = objects.registerObjectInstance(1, 2, 3, "object");
+
+    ASSERT_EQ(object, objects.getObject(3));
+    ASSERT_EQ(object, objects.getObjectByName("object"));
+    ASSERT_EQ(3u, objects.getObjectInstanceHandle("object"));
+    ASSERT_EQ(2u, objects.getObjectClass(3));
+    ASSERT_EQ(1u, objects.size());
+
+    ASSERT_THROW(objects.getObject(2), ::certi::ObjectNotKnown);
+    ASSERT_THROW(objects.getObject(4), ::certi::ObjectNotKnown);
+    ASSERT_THROW(objects.registerObjectInstance(1, 2, 3, "other"), ::certi::ObjectAlreadyRegistered);
+    ASSERT_THROW(objects.registerObjectInstance(1, 2, 4, "object"), ::certi::ObjectAlreadyRegistered);
+}
+
+TEST(ObjectSet, UnnamedObjectIsFoundByDefaultName)
+{
+    ObjectSet objects(nullptr);
+    auto object = objects.registerObjectInstance(1, 2, 3, "");
+
+    ASSERT_EQ("HLAobject_3", object->getName());
+    ASSERT_EQ(object, objects.getObjectByName("HLAobject_3"));
+    ASSERT_EQ(nullptr, objects.getObjectByName(""));
+
+    // A second unnamed object gets its own name
+    objects.registerObjectInstance(1, 2, 4, "");
+    ASSERT_EQ(2u, objects.size());
+}
+
+TEST(ObjectSet, DeletedObjectMemoryIsReused)
+{
+    ObjectSet objects(nullptr);
+    auto object = objects.registerObjectInstance(1, 2, 3, "object");
+    objects.deleteObjectInstance(1, 3, "");
+
+    ASSERT_THROW(objects.getObject(3), ::certi::ObjectNotKnown);
+    ASSERT_EQ(nullptr, objects.getObjectByName("object"));
+    ASSERT_EQ(0u, objects.size());
+
+    ASSERT_EQ(object, objects.registerObjectInstance(1, 2, 4, "object"));
+}
+
+TEST(ObjectSet, KillFederateDeletesItsObjectsAndReleasesItsAttributes)
+{
+    ObjectSet objects(nullptr);
+    for (::certi::ObjectHandle handle{1}; handle <= 6; ++handle) {
+        auto object = objects.registerObjectInstance(handle % 2 + 1, 1, handle, "");
+        object->addAttribute(ObjectAttribute(1, 1, nullptr));
+    }
+
+    objects.killFederate(1);
+
+    std::vector<::certi::ObjectHandle> handles;
+    objects.getAllObjectInstancesFromFederate(2, handles);
+    ASSERT_EQ(std::vector<::certi::ObjectHandle>({1, 3, 5}), handles);
+    ASSERT_EQ(3u, objects.size());
+    ASSERT_EQ(0u, objects.getObject(1)->getAttribute(1)->getOwner());
+}
+
+TEST(Object, AttributesAreFoundWhateverTheirHandles)
+{
+    Object object(1);
+    object.reserveAttributes(3);
+    object.addAttribute(ObjectAttribute(5, 1, nullptr));
+    object.addAttribute(ObjectAttribute(1, 2, nullptr));
+    object.addAttribute(ObjectAttribute(2, 3, nullptr));
+
+    ASSERT_EQ(2u, object.getAttribute(1)->getOwner());
+    ASSERT_EQ(3u, object.getAttribute(2)->getOwner());
+    ASSERT_EQ(1u, object.getAttribute(5)->getOwner());
+    ASSERT_EQ(1u, object.getAttributes().front().getHandle());
+    ASSERT_EQ(5u, object.getAttributes().back().getHandle());
+
+    ASSERT_THROW(object.getAttribute(3), ::certi::AttributeNotDefined);
+    ASSERT_THROW(object.addAttribute(ObjectAttribute(2, 1, nullptr)), ::certi::RTIinternalError);
+}
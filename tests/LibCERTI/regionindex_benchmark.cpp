@@ -0,0 +1,72 @@
+#ifdef BENCHMARK_REGION_INDEX
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <libCERTI/RTIRegion.hh>
+#include <libCERTI/RegionIndex.hh>
+#include <libCERTI/RoutingSpace.hh>
+
+using ::certi::RegionIndex;
+using ::certi::RTIRegion;
+
+namespace {
+static constexpr int subscriptions{5000};
+static constexpr int updates{1000};
+}
+
+/// Matching update regions against many subscription regions, with and without the index.
+TEST(RegionIndexBenchmark, ManySubscriptionRegions)
+{
+    ::certi::RoutingSpace space;
+    space.setHandle(1);
+    space.addDimension(::certi::Dimension(1));
+    space.addDimension(::certi::Dimension(2));
+
+    std::mt19937 random(42);
+    std::uniform_int_distribution<uint32_t> position(0, 100000);
+    std::uniform_int_distribution<uint32_t> width(0, 1000);
+
+    RegionIndex index;
+    std::vector<std::unique_ptr<RTIRegion>> regions;
+    for (int i = 0; i < subscriptions + updates; ++i) {
+        regions.emplace_back(new RTIRegion(i + 1, space, 1));
+        auto x = position(random);
+        auto y = position(random);
+        regions.back()->setRangeLowerBound(0, 1, x);
+        regions.back()->setRangeUpperBound(0, 1, x + width(random));
+        regions.back()->setRangeLowerBound(0, 2, y);
+        regions.back()->setRangeUpperBound(0, 2, y + width(random));
+        index.update(*regions.back());
+    }
+
+    size_t exhaustive_matches{0};
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = subscriptions; i < subscriptions + updates; ++i) {
+        for (int j = 0; j < subscriptions; ++j) {
+            exhaustive_matches += regions[j]->overlaps(*regions[i]);
+        }
+    }
+    auto middle = std::chrono::high_resolution_clock::now();
+
+    size_t indexed_matches{0};
+    for (int i = subscriptions; i < subscriptions + updates; ++i) {
+        for (const auto& region : index.getOverlappingRegions(*regions[i])) {
+            indexed_matches += region->getHandle() <= subscriptions;
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    ASSERT_EQ(exhaustive_matches, indexed_matches);
+
+    std::cerr << "Matching " << updates << " update regions against " << subscriptions
+              << " subscriptions: exhaustive " << std::chrono::duration_cast<std::chrono::microseconds>(middle - start).count() << " us, indexed "
+              << std::chrono::duration_cast<std::chrono::microseconds>(end - middle).count() << " us" << std::endl;
+}
+
+#endif
@@ -0,0 +1,220 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <libCERTI/RTIRegion.hh>
+#include <libCERTI/RegionIndex.hh>
+#include <libCERTI/RootObject.hh>
+#include <libCERTI/RoutingSpace.hh>
+
+using ::certi::RegionIndex;
+using ::certi::RTIRegion;
+
+namespace {
+/// A two dimensions routing space and a few helpers to create regions in it.
+class RegionIndexTest : public ::testing::Test {
+protected:
+    RegionIndexTest()
+    {
+        space.setHandle(1);
+        space.addDimension(::certi::Dimension(1));
+        space.addDimension(::certi::Dimension(2));
+    }
+
+    RTIRegion& createRegion(uint32_t x1, uint32_t x2, uint32_t y1, uint32_t y2)
+    {
+        regions.emplace_back(new RTIRegion(regions.size() + 1, space, 1));
+        setBounds(*regions.back(), x1, x2, y1, y2);
+        return *regions.back();
+    }
+
+    void setBounds(RTIRegion& region, uint32_t x1, uint32_t x2, uint32_t y1, uint32_t y2)
+    {
+        region.setRangeLowerBound(0, 1, x1);
+        region.setRangeUpperBound(0, 1, x2);
+        region.setRangeLowerBound(0, 2, y1);
+        region.setRangeUpperBound(0, 2, y2);
+    }
+
+    ::certi::RoutingSpace space;
+    std::vector<std::unique_ptr<RTIRegion>> regions;
+    RegionIndex index;
+};
+}
+
+TEST_F(RegionIndexTest, EmptyIndexHasNoOverlap)
+{
+    auto& region = createRegion(0, 10, 0, 10);
+    ASSERT_TRUE(index.getOverlappingRegions(region).empty());
+}
+
+TEST_F(RegionIndexTest, OverlappingRegionsAreFound)
+{
+    auto& a = createRegion(0, 10, 0, 10);
+    auto& b = createRegion(5, 15, 5, 15);
+    auto& c = createRegion(20, 30, 0, 10);
+    index.update(a);
+    index.update(b);
+    index.update(c);
+
+    ASSERT_EQ(3u, index.size());
+    ASSERT_EQ((RegionIndex::RegionSet{&a, &b}), index.getOverlappingRegions(a));
+    ASSERT_EQ((RegionIndex::RegionSet{&c}), index.getOverlappingRegions(c));
+}
+
+TEST_F(RegionIndexTest, UpdateFollowsNewExtents)
+{
+    auto& a = createRegion(0, 10, 0, 10);
+    auto& b = createRegion(20, 30, 20, 30);
+    index.update(a);
+    index.update(b);
+    ASSERT_EQ(0u, index.getOverlappingRegions(a).count(&b));
+
+    setBounds(b, 5, 30, 5, 30);
+    index.update(b);
+    ASSERT_EQ(1u, index.getOverlappingRegions(a).count(&b));
+}
+
+TEST_F(RegionIndexTest, RemovedRegionIsNotFound)
+{
+    auto& a = createRegion(0, 10, 0, 10);
+    auto& b = createRegion(0, 10, 0, 10);
+    index.update(a);
+    index.update(b);
+    index.remove(b);
+
+    ASSERT_FALSE(index.contains(b));
+    ASSERT_EQ((RegionIndex::RegionSet{&a}), index.getOverlappingRegions(a));
+    ASSERT_NO_THROW(index.remove(b));
+}
+
+TEST_F(RegionIndexTest, CopyKeepsTheIndexedRegions)
+{
+    auto& a = createRegion(0, 10, 0, 10);
+    auto& b = createRegion(5, 15, 5, 15);
+    index.update(a);
+    index.update(b);
+
+    RegionIndex copy(index);
+    ASSERT_EQ(2u, copy.size());
+    ASSERT_EQ((RegionIndex::RegionSet{&a, &b}), copy.getOverlappingRegions(a));
+
+    copy.remove(b);
+    ASSERT_EQ((RegionIndex::RegionSet{&a, &b}), index.getOverlappingRegions(a));
+}
+
+TEST(RootObjectRegionIndexTest, IndexSurvivesSpacesAddedLater)
+{
+    ::certi::RootObject root;
+
+    ::certi::RoutingSpace space;
+    space.addDimension(::certi::Dimension(1));
+    space.addDimension(::certi::Dimension(2));
+    root.addRoutingSpace(space);
+
+    auto a = root.createRegion(1, 1);
+    auto b = root.createRegion(1, 1);
+
+    for (auto i(0u); i < 32; ++i) {
+        root.addRoutingSpace(space);
+    }
+
+    auto& region = *root.getRegion(a);
+    ASSERT_EQ(1u, region.getSpaceHandle());
+    ASSERT_EQ(&root.getRoutingSpace(1), &region.getRoutingSpace());
+    ASSERT_EQ((RegionIndex::RegionSet{&region, root.getRegion(b)}),
+              root.getRoutingSpace(1).getRegionIndex().getOverlappingRegions(region));
+}
+
+TEST_F(RegionIndexTest, RegionOfAnotherSpaceDoesNotOverlap)
+{
+    ::certi::RoutingSpace other;
+    other.setHandle(2);
+    other.addDimension(::certi::Dimension(1));
+    other.addDimension(::certi::Dimension(2));
+
+    auto& a = createRegion(0, 10, 0, 10);
+    index.update(a);
+
+    RTIRegion b{42, other, 1};
+    ASSERT_TRUE(index.getOverlappingRegions(b).empty());
+}
+
+TEST_F(RegionIndexTest, SameResultAsExhaustiveSearch)
+{
+    std::mt19937 random(42);
+    std::uniform_int_distribution<uint32_t> position(0, 10000);
+    std::uniform_int_distribution<uint32_t> width(0, 500);
+
+    auto randomBounds = [&](RTIRegion& region) {
+        auto x = position(random);
+        auto y = position(random);
+        setBounds(region, x, x + width(random), y, y + width(random));
+    };
+
+    for (int i = 0; i < 1000; ++i) {
+        auto& region = createRegion(0, 0, 0, 0);
+        randomBounds(region);
+        index.update(region);
+    }
+    // Some regions move, and the grid is recomputed on the way
+    for (int i = 0; i < 2000; ++i) {
+        auto& region = *regions[random() % regions.size()];
+        randomBounds(region);
+        index.update(region);
+    }
+    // The default region covers the whole space
+    auto& everywhere = *regions.front();
+    everywhere.replaceExtents({space.createExtent()});
+    index.update(everywhere);
+
+    for (const auto& region : regions) {
+        RegionIndex::RegionSet expected;
+        for (const auto& other : regions) {
+            if (other->overlaps(*region)) {
+                expected.insert(other.get());
+            }
+        }
+        ASSERT_EQ(expected, index.getOverlappingRegions(*region)) << "Region " << region->getHandle();
+    }
+}
+
+TEST_F(RegionIndexTest, ExtentsOfFewerDimensionsSpanTheMissingAxes)
+{
+    std::mt19937 random(7);
+    std::uniform_int_distribution<uint32_t> position(0, 10000);
+
+    for (int i = 0; i < 1000; ++i) {
+        auto x = position(random);
+        auto y = position(random);
+        index.update(createRegion(x, x + 100, y, y + 100));
+    }
+
+    // Bounded on the first axis only
+    auto& strip = createRegion(0, 0, 0, 0);
+    ::certi::Extent x_only(1);
+    x_only.setRangeLowerBound(1, 5000);
+    x_only.setRangeUpperBound(1, 5500);
+    strip.replaceExtents({x_only});
+    index.update(strip);
+
+    // Not bounded at all
+    auto& everywhere = createRegion(0, 0, 0, 0);
+    everywhere.replaceExtents({::certi::Extent(0)});
+    index.update(everywhere);
+
+    size_t crossed = 0;
+    for (const auto& region : regions) {
+        if (region.get() == &strip || region.get() == &everywhere) {
+            continue;
+        }
+        const auto& overlapping = index.getOverlappingRegions(*region);
+        ASSERT_EQ(strip.overlaps(*region), overlapping.count(&strip) == 1) << "Region " << region->getHandle();
+        ASSERT_EQ(1u, overlapping.count(&everywhere)) << "Region " << region->getHandle();
+        crossed += strip.overlaps(*region);
+    }
+    // The strip crosses the whole second axis
+    ASSERT_LT(20u, crossed);
+}
@@ -0,0 +1,70 @@
+#ifdef BENCHMARK_SOCKET_SERVER
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+
+#include <libCERTI/SocketServer.hh>
+
+#include "../fakes/sockettcp_fake.h"
+
+using ::certi::SocketServer;
+
+namespace {
+static constexpr int lookups{100000};
+
+/// Average cost, in ns, of the lookups done for every message routed by the RTIG.
+void benchmarkLookups(const unsigned int federates)
+{
+    ::certi::SocketUDP udp;
+    SocketServer s(new ::certi::SocketTCP{}, &udp);
+
+    std::vector<::certi::Socket*> links;
+    for (auto i(0u); i < federates; ++i) {
+        auto link = new FakeSocketTcp{static_cast<SOCKET>(i + 10)};
+        links.push_back(link);
+        s.___TESTS_ONLY___open(link);
+        s.setReferences(i + 10, ::certi::FederationHandle(1), i + 1, 0, 0);
+    }
+
+    ::certi::Socket* found{nullptr};
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i{0}; i < lookups; ++i) {
+        found = s.getSocketLink(::certi::FederationHandle(1), (i % federates) + 1);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    ASSERT_EQ(links[(lookups - 1) % federates], found);
+
+    std::cerr << "getSocketLink with " << federates
+              << " federates: " << std::chrono::nanoseconds(end - start).count() / lookups << " ns" << std::endl;
+
+    ::certi::FederateHandle federate{0};
+    start = std::chrono::high_resolution_clock::now();
+    for (int i{0}; i < lookups; ++i) {
+        federate = s.getFederateFromSocket(::certi::FederationHandle(1), links[i % federates]);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    ASSERT_EQ(((lookups - 1) % federates) + 1, federate);
+
+    std::cerr << "getFederateFromSocket with " << federates
+              << " federates: " << std::chrono::nanoseconds(end - start).count() / lookups << " ns" << std::endl;
+}
+}
+
+TEST(SocketServerBenchmark, LookupCost10Federates)
+{
+    benchmarkLookups(10);
+}
+
+TEST(SocketServerBenchmark, LookupCost100Federates)
+{
+    benchmarkLookups(100);
+}
+
+TEST(SocketServerBenchmark, LookupCost1000Federates)
+{
+    benchmarkLookups(1000);
+}
+
+#endif
@@ -2,6 +2,9 @@
 
 #include <libCERTI/SocketServer.hh>
 
+#include <vector>
+
+#include "../fakes/sockettcp_fake.h"
 #include "../mocks/sockettcp_mock.h"
 
 using ::certi::SocketServer;
@@ -25,3 +28,123 @@ TEST(SocketServer, CtorAcceptsNullUdpSocket)
 //     
 //     SocketServer s(&socket, nullptr);
 // }
+
+TEST(SocketServer, GetSocketLinkThrowsOnUnknownReferences)
+{
+    ::certi::SocketUDP udp;
+    SocketServer s(new ::certi::SocketTCP{}, &udp);
+
+    ASSERT_THROW(s.getSocketLink(::certi::FederationHandle(1), 1), ::certi::FederateNotExecutionMember);
+}
+
+TEST(SocketServer, SetReferencesIndexesTheLink)
+{
+    ::certi::SocketUDP udp;
+    SocketServer s(new ::certi::SocketTCP{}, &udp);
+
+    auto link = new FakeSocketTcp{10};
+    s.___TESTS_ONLY___open(link);
+    s.___TESTS_ONLY___open(new FakeSocketTcp{11});
+
+    s.setReferences(10, ::certi::FederationHandle(1), 2, 0, 0);
+
+    ASSERT_EQ(link, s.getSocketLink(::certi::FederationHandle(1), 2));
+    ASSERT_EQ(2u, s.getFederateFromSocket(::certi::FederationHandle(1), link));
+    ASSERT_THROW(s.getFederateFromSocket(::certi::FederationHandle(2), link), ::certi::RTIinternalError);
+}
+
+TEST(SocketServer, SetReferencesThrowsOnUnknownSocket)
+{
+    ::certi::SocketUDP udp;
+    SocketServer s(new ::certi::SocketTCP{}, &udp);
+
+    ASSERT_THROW(s.setReferences(10, ::certi::FederationHandle(1), 2, 0, 0), ::certi::RTIinternalError);
+}
+
+TEST(SocketServer, CloseKeepsReferencesWithoutLink)
+{
+    ::certi::SocketUDP udp;
+    SocketServer s(new ::certi::SocketTCP{}, &udp);
+
+    s.___TESTS_ONLY___open(new FakeSocketTcp{10});
+    s.setReferences(10, ::certi::FederationHandle(1), 2, 0, 0);
+
+    ::certi::FederationHandle federation{0};
+    ::certi::FederateHandle federate{0};
+    s.close(10, federation, federate);
+
+    ASSERT_EQ(::certi::FederationHandle(1), federation);
+    ASSERT_EQ(2u, federate);
+    ASSERT_EQ(nullptr, s.getSocketLink(::certi::FederationHandle(1), 2));
+    ASSERT_THROW(s.close(10, federation, federate), ::certi::RTIinternalError);
+}
+
+TEST(SocketServer, SetReferencesAttachesTheBestEffortLink)
+{
+    ::certi::SocketUDP udp;
+    SocketServer s(new ::certi::SocketTCP{}, &udp);
+
+    auto link = new FakeSocketTcp{10};
+    s.___TESTS_ONLY___open(link);
+    s.setReferences(10, ::certi::FederationHandle(1), 2, htonl(INADDR_LOOPBACK), htons(6000));
+
+    auto bestEffort = s.getBestEffortLink(link);
+    ASSERT_NE(link, bestEffort);
+    ASSERT_EQ(bestEffort, s.getSocketLink(::certi::FederationHandle(1), 2, ::certi::BEST_EFFORT));
+
+    // Datagrams are only accepted from the address given by the federate
+    ASSERT_EQ(link, s.getLinkOfDatagram(::certi::FederationHandle(1), 2, htonl(INADDR_LOOPBACK), htons(6000)));
+    ASSERT_EQ(nullptr, s.getLinkOfDatagram(::certi::FederationHandle(1), 2, htonl(INADDR_LOOPBACK), htons(6001)));
+    ASSERT_EQ(nullptr, s.getLinkOfDatagram(::certi::FederationHandle(1), 3, htonl(INADDR_LOOPBACK), htons(6000)));
+
+    ::certi::FederationHandle federation{0};
+    ::certi::FederateHandle federate{0};
+    s.close(10, federation, federate);
+    ASSERT_EQ(link, s.getBestEffortLink(link));
+}
+
+TEST(SocketServer, ActiveSocketsAreServedLatestOpenedFirst)
+{
+    ::certi::SocketUDP udp;
+    SocketServer s(new ::certi::SocketTCP{}, &udp);
+
+    std::vector<FakeSocketTcp*> links;
+    for (int fd : {12, 10, 14, 11, 13}) {
+        links.push_back(new FakeSocketTcp{fd});
+        s.___TESTS_ONLY___open(links.back());
+    }
+
+    fd_set fds;
+    FD_ZERO(&fds);
+    ASSERT_EQ(14, s.addToFDSet(&fds));
+
+    // As the list of links always did, whatever the descriptors
+    for (auto it = links.rbegin(); it != links.rend(); ++it) {
+        ASSERT_EQ(*it, s.getActiveSocket(&fds));
+        FD_CLR((*it)->returnSocket(), &fds);
+    }
+    ASSERT_EQ(nullptr, s.getActiveSocket(&fds));
+}
+
+TEST(SocketServer, BestEffortDescriptorResolvesToItsFederate)
+{
+    ::certi::SocketUDP udp;
+    SocketServer s(new ::certi::SocketTCP{}, &udp);
+
+    s.___TESTS_ONLY___open(new FakeSocketTcp{10});
+    s.___TESTS_ONLY___open(new FakeSocketTcp{11});
+    s.setReferences(10, ::certi::FederationHandle(1), 2, htonl(INADDR_LOOPBACK), htons(6000));
+    s.setReferences(11, ::certi::FederationHandle(1), 3, htonl(INADDR_LOOPBACK), htons(6001));
+
+    // Both best effort links share the descriptor of the server, the latest opened link comes first
+    ::certi::FederationHandle federation{0};
+    ::certi::FederateHandle federate{0};
+    s.close(udp.returnSocket(), federation, federate);
+    ASSERT_EQ(::certi::FederationHandle(1), federation);
+    ASSERT_EQ(3u, federate);
+
+    s.close(udp.returnSocket(), federation, federate);
+    ASSERT_EQ(2u, federate);
+
+    ASSERT_THROW(s.close(udp.returnSocket(), federation, federate), ::certi::RTIinternalError);
+}
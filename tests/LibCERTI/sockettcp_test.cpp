@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <libCERTI/SocketTCP.hh>
+
+using ::certi::SocketTCP;
+
+namespace {
+/// A queued socket, the RTIG side of a link, and the federate side as a raw descriptor.
+class SocketTCPOutputQueueTest : public ::testing::Test {
+protected:
+    SocketTCPOutputQueueTest()
+    {
+        int fds[2];
+        socketpair(AF_UNIX, SOCK_STREAM, 0, fds);
+        rtig.___TESTS_ONLY___attach(fds[0]);
+        federate = fds[1];
+
+        // Keep the kernel buffers small so that the queue fills up quickly
+        int size = 4096;
+        setsockopt(fds[0], SOL_SOCKET, SO_SNDBUF, &size, sizeof(size));
+        setsockopt(fds[1], SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+    }
+
+    ~SocketTCPOutputQueueTest()
+    {
+        if (federate >= 0) {
+            close(federate);
+        }
+    }
+
+    /// Bytes the federate can read without blocking.
+    std::vector<unsigned char> readAvailable()
+    {
+        std::vector<unsigned char> result;
+        unsigned char buffer[4096];
+        ssize_t count;
+        while ((count = recv(federate, buffer, sizeof(buffer), MSG_DONTWAIT)) > 0) {
+            result.insert(end(result), buffer, buffer + count);
+        }
+        return result;
+    }
+
+    SocketTCP rtig;
+    int federate;
+
+    const std::vector<unsigned char> message = std::vector<unsigned char>(1000, 42);
+};
+}
+
+TEST_F(SocketTCPOutputQueueTest, SendIsWrittenOnFlush)
+{
+    rtig.setOutputQueue(64 * 1024, SocketTCP::SlowConsumerPolicy::Block);
+
+    const unsigned char first[] = {1, 2, 3};
+    const unsigned char second[] = {4, 5};
+    rtig.send(first, sizeof(first));
+    rtig.send(second, sizeof(second));
+
+    ASSERT_TRUE(rtig.hasPendingOutput());
+    ASSERT_TRUE(readAvailable().empty());
+
+    ASSERT_FALSE(rtig.flush());
+    ASSERT_FALSE(rtig.hasPendingOutput());
+    ASSERT_EQ((std::vector<unsigned char>{1, 2, 3, 4, 5}), readAvailable());
+}
+
+TEST_F(SocketTCPOutputQueueTest, FlushKeepsWhatTheSocketDoesNotTake)
+{
+    rtig.setOutputQueue(1024 * 1024, SocketTCP::SlowConsumerPolicy::Block);
+
+    std::vector<unsigned char> sent(256 * 1024);
+    std::iota(begin(sent), end(sent), 0);
+    rtig.send(sent.data(), sent.size());
+
+    std::vector<unsigned char> received;
+    while (rtig.flush()) {
+        auto available = readAvailable();
+        received.insert(end(received), begin(available), end(available));
+    }
+    auto available = readAvailable();
+    received.insert(end(received), begin(available), end(available));
+
+    ASSERT_EQ(sent, received);
+    ASSERT_FALSE(rtig.isBroken());
+}
+
+TEST_F(SocketTCPOutputQueueTest, DisconnectPolicyBreaksSocketWhenQueueIsFull)
+{
+    rtig.setOutputQueue(10 * message.size(), SocketTCP::SlowConsumerPolicy::Disconnect);
+
+    for (int i = 0; i < 1000 && !rtig.isBroken(); ++i) {
+        rtig.send(message.data(), message.size());
+    }
+
+    ASSERT_TRUE(rtig.isBroken());
+    ASSERT_FALSE(rtig.hasPendingOutput());
+}
+
+TEST_F(SocketTCPOutputQueueTest, DropPolicyDropsOnlyDroppableMessages)
+{
+    rtig.setOutputQueue(10 * message.size(), SocketTCP::SlowConsumerPolicy::DropBestEffort);
+
+    for (int i = 0; i < 1000; ++i) {
+        rtig.sendDroppable(message.data(), message.size());
+    }
+    ASSERT_FALSE(rtig.isBroken());
+
+    // A message which cannot be dropped waits for the federate to read
+    std::thread reader([this] {
+        std::vector<unsigned char> buffer(64 * 1024);
+        while (recv(federate, buffer.data(), buffer.size(), 0) > 0) {
+        }
+    });
+    rtig.send(message.data(), message.size());
+    while (rtig.flush()) {
+        usleep(100);
+    }
+
+    shutdown(federate, SHUT_RD);
+    reader.join();
+    ASSERT_FALSE(rtig.isBroken());
+}
+
+TEST_F(SocketTCPOutputQueueTest, BlockPolicyWaitsForTheFederate)
+{
+    rtig.setOutputQueue(10 * message.size(), SocketTCP::SlowConsumerPolicy::Block);
+
+    std::vector<unsigned char> received;
+    std::thread reader([&] {
+        unsigned char buffer[4096];
+        while (received.size() < 100 * message.size()) {
+            auto count = recv(federate, buffer, sizeof(buffer), 0);
+            if (count <= 0) {
+                break;
+            }
+            received.insert(end(received), buffer, buffer + count);
+        }
+    });
+
+    for (int i = 0; i < 100; ++i) {
+        rtig.sendDroppable(message.data(), message.size());
+    }
+    while (rtig.flush()) {
+        usleep(100);
+    }
+    reader.join();
+
+    ASSERT_EQ(100 * message.size(), received.size());
+}
+
+TEST_F(SocketTCPOutputQueueTest, BlockedWriterLetsOthersFlush)
+{
+    rtig.setOutputQueue(10 * message.size(), SocketTCP::SlowConsumerPolicy::Block);
+
+    // Fill the socket, then a writer fills the queue and waits for the federate
+    size_t count = 0;
+    do {
+        rtig.send(message.data(), message.size());
+        ++count;
+    } while (!rtig.flush());
+    std::thread writer([this] {
+        for (int i = 0; i < 20; ++i) {
+            rtig.send(message.data(), message.size());
+        }
+    });
+    count += 20;
+    usleep(10000);
+
+    // The waiting writer does not hold the queue
+    EXPECT_TRUE(rtig.flush());
+
+    std::vector<unsigned char> received;
+    while (received.size() < count * message.size()) {
+        rtig.flush();
+        auto available = readAvailable();
+        received.insert(end(received), begin(available), end(available));
+        usleep(100);
+    }
+    writer.join();
+    ASSERT_FALSE(rtig.isBroken());
+    ASSERT_FALSE(rtig.hasPendingOutput());
+}
+
+TEST_F(SocketTCPOutputQueueTest, FlushBreaksSocketWhenFederateIsGone)
+{
+    rtig.setOutputQueue(64 * 1024, SocketTCP::SlowConsumerPolicy::Block);
+
+    close(federate);
+    federate = -1;
+
+    rtig.send(message.data(), message.size());
+    ASSERT_NO_THROW(rtig.flush());
+    ASSERT_TRUE(rtig.isBroken());
+}
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <poll.h>
+
+#include <memory>
+#include <string>
+
+#include <libCERTI/NM_Classes.hh>
+#include <libCERTI/SocketUDP.hh>
+
+#include "../mocks/sockettcp_mock.h"
+
+using ::certi::NetworkMessage;
+using ::certi::SocketUDP;
+
+namespace {
+/// A server on the loopback and a client sending to it, as the RTIG and an RTIA.
+class SocketUDPTest : public ::testing::Test {
+protected:
+    SocketUDPTest()
+    {
+        server.createServer(0, htonl(INADDR_LOOPBACK));
+        client.createConnection("127.0.0.1", ntohs(server.getPort()));
+    }
+
+    bool isReadable(SocketUDP& socket)
+    {
+        struct pollfd fd = {socket.returnSocket(), POLLIN, 0};
+        return poll(&fd, 1, 1000) == 1;
+    }
+
+    static ::certi::NM_Update_Attribute_Values update(const uint32_t size)
+    {
+        ::certi::NM_Update_Attribute_Values message;
+        message.setFederation(1);
+        message.setFederate(2);
+        message.setObject(3);
+        message.setAttributesSize(1);
+        message.setAttributes(4, 0);
+        message.setValuesSize(1);
+        message.setValues(::certi::AttributeValue_t(size, 'v'), 0);
+        message.setSequence(5);
+        return message;
+    }
+
+    SocketUDP server;
+    SocketUDP client;
+    libhla::MessageBuffer buffer;
+};
+}
+
+TEST_F(SocketUDPTest, MessageRoundTrip)
+{
+    auto message = update(10);
+    message.send(&client, buffer);
+
+    ASSERT_TRUE(isReadable(server));
+    std::unique_ptr<NetworkMessage> received(NetworkMessage::receiveDatagram(&server, buffer));
+    ASSERT_TRUE(received);
+    ASSERT_EQ(NetworkMessage::Type::UPDATE_ATTRIBUTE_VALUES, received->getMessageType());
+    ASSERT_EQ(5u, static_cast<::certi::NM_Update_Attribute_Values&>(*received).getSequence());
+    ASSERT_EQ(::certi::AttributeValue_t(10, 'v'),
+              static_cast<::certi::NM_Update_Attribute_Values&>(*received).getValues(0));
+    ASSERT_FALSE(server.isDataReady());
+
+    // The server answers the client at the address the datagram came from
+    ASSERT_EQ(htonl(INADDR_LOOPBACK), server.getSourceAddr());
+    ASSERT_EQ(client.getPort(), server.getSourcePort());
+
+    SocketUDP link;
+    link.attach(server.returnSocket(), server.getSourceAddr(), server.getSourcePort());
+    ASSERT_TRUE(link.isPeer(htonl(INADDR_LOOPBACK), client.getPort()));
+    ASSERT_FALSE(link.isPeer(htonl(INADDR_LOOPBACK), server.getPort()));
+
+    const unsigned char answer[] = "answer";
+    link.send(answer, sizeof(answer));
+    ASSERT_TRUE(isReadable(client));
+    unsigned char received_answer[sizeof(answer)];
+    client.receive(received_answer, sizeof(received_answer));
+    ASSERT_STREQ("answer", reinterpret_cast<char*>(received_answer));
+}
+
+TEST_F(SocketUDPTest, ReceivesAreServedFromOneDatagram)
+{
+    const unsigned char first[] = "first";
+    const unsigned char second[] = "second";
+    client.send(first, sizeof(first));
+    client.send(second, sizeof(second));
+
+    ASSERT_TRUE(isReadable(server));
+    char part[3];
+    server.receive(part, sizeof(part));
+    ASSERT_EQ("fir", std::string(part, sizeof(part)));
+    ASSERT_TRUE(server.isDataReady());
+
+    // Asking for more than what is left drops the datagram, but not the next one
+    char rest[4];
+    ASSERT_THROW(server.receive(rest, sizeof(rest)), ::certi::NetworkError);
+    ASSERT_FALSE(server.isDataReady());
+
+    ASSERT_TRUE(isReadable(server));
+    char received[sizeof(second)];
+    server.receive(received, sizeof(received));
+    ASSERT_STREQ("second", received);
+}
+
+TEST_F(SocketUDPTest, InvalidDatagramIsDropped)
+{
+    const unsigned char garbage[] = "this is not a message";
+    client.send(garbage, sizeof(garbage));
+
+    // A message which is not expected as a datagram
+    ::certi::NM_Remove_Object remove;
+    remove.send(&client, buffer);
+
+    // A message cut short
+    auto message = update(100);
+    message.serialize(buffer);
+    buffer.updateReservedBytes();
+    client.send(static_cast<unsigned char*>(buffer(0)), buffer.size() - 10);
+
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(isReadable(server));
+        ASSERT_EQ(nullptr, NetworkMessage::receiveDatagram(&server, buffer));
+        ASSERT_FALSE(server.isDataReady());
+    }
+
+    message.send(&client, buffer);
+    ASSERT_TRUE(isReadable(server));
+    std::unique_ptr<NetworkMessage> received(NetworkMessage::receiveDatagram(&server, buffer));
+    ASSERT_TRUE(received);
+}
+
+TEST_F(SocketUDPTest, LargeMessageGoesThroughTheFallback)
+{
+    MockSocketTcp fallback;
+    client.setFallback(&fallback);
+    client.setMaxDatagramSize(200);
+
+    EXPECT_CALL(fallback, send(::testing::_, ::testing::Gt(200u))).Times(1);
+
+    auto large = update(500);
+    large.send(&client, buffer);
+
+    auto small = update(10);
+    small.send(&client, buffer);
+
+    // Only the small one was sent as a datagram
+    ASSERT_TRUE(isReadable(server));
+    std::unique_ptr<NetworkMessage> received(NetworkMessage::receiveDatagram(&server, buffer));
+    ASSERT_TRUE(received);
+    ASSERT_EQ(::certi::AttributeValue_t(10, 'v'),
+              static_cast<::certi::NM_Update_Attribute_Values&>(*received).getValues(0));
+}
+
+TEST(SocketUDP, MaxDatagramSizeIsReadFromEnvironment)
+{
+    unsetenv("CERTI_UDP_MAX_DATAGRAM");
+    ASSERT_EQ(SocketUDP::the_default_datagram_size, SocketUDP().getMaxDatagramSize());
+
+    setenv("CERTI_UDP_MAX_DATAGRAM", "9000", 1);
+    ASSERT_EQ(9000u, SocketUDP().getMaxDatagramSize());
+
+    setenv("CERTI_UDP_MAX_DATAGRAM", "100000", 1);
+    ASSERT_EQ(SocketUDP::the_max_datagram_size, SocketUDP().getMaxDatagramSize());
+
+    unsetenv("CERTI_UDP_MAX_DATAGRAM");
+}
@@ -0,0 +1,64 @@
+#ifdef BENCHMARK_SOCKET_UN
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#include <libCERTI/SocketUN.hh>
+
+using ::certi::SocketUN;
+
+namespace {
+static constexpr int round_trips{10000};
+static constexpr size_t message_size{64};
+
+/// Average round trip time, in ns, of a small message between the federate and its RTIA.
+void benchmarkPingPong(const bool shared_memory)
+{
+    SocketUN federate{::certi::stIgnoreSignal};
+    SocketUN rtia{::certi::stIgnoreSignal};
+    rtia.setSocketFD(federate.socketpair());
+
+    if (shared_memory) {
+        auto name = SocketUN::buildSharedMemoryName();
+        federate.useSharedMemory(name, true);
+        rtia.useSharedMemory(name, false);
+    }
+
+    std::thread echo([&] {
+        unsigned char buffer[message_size];
+        for (int i{0}; i < round_trips; ++i) {
+            rtia.receive(buffer, message_size);
+            rtia.send(buffer, message_size);
+        }
+    });
+
+    unsigned char buffer[message_size] = {};
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i{0}; i < round_trips; ++i) {
+        buffer[0] = static_cast<unsigned char>(i);
+        federate.send(buffer, message_size);
+        federate.receive(buffer, message_size);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    echo.join();
+    ASSERT_EQ(static_cast<unsigned char>(round_trips - 1), buffer[0]);
+
+    std::cerr << "Round trip of " << message_size << " bytes over " << (shared_memory ? "shared memory" : "socket")
+              << ": " << std::chrono::nanoseconds(end - start).count() / round_trips << " ns" << std::endl;
+}
+}
+
+TEST(SocketUNBenchmark, PingPongSocket)
+{
+    benchmarkPingPong(false);
+}
+
+TEST(SocketUNBenchmark, PingPongSharedMemory)
+{
+    benchmarkPingPong(true);
+}
+
+#endif
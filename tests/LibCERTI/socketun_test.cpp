@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <libCERTI/SHMChannel.hh>
+#include <libCERTI/SocketUN.hh>
+
+using ::certi::SocketUN;
+
+namespace {
+/// Two ends of a socketpair, as the federate and its RTIA.
+class SocketUNSharedMemoryTest : public ::testing::Test {
+protected:
+    SocketUNSharedMemoryTest() : federate{::certi::stIgnoreSignal}, rtia{::certi::stIgnoreSignal}
+    {
+        rtia.setSocketFD(federate.socketpair());
+
+        name = SocketUN::buildSharedMemoryName();
+        federate.useSharedMemory(name, true);
+        rtia.useSharedMemory(name, false);
+    }
+
+    bool isReadable(SocketUN& socket)
+    {
+        struct pollfd fd = {socket.returnSocket(), POLLIN, 0};
+        return poll(&fd, 1, 0) == 1;
+    }
+
+    std::string name;
+    SocketUN federate;
+    SocketUN rtia;
+};
+}
+
+TEST_F(SocketUNSharedMemoryTest, RoundTrip)
+{
+    const unsigned char request[] = "request";
+    federate.send(request, sizeof(request));
+
+    unsigned char received[sizeof(request)];
+    rtia.receive(received, sizeof(received));
+    ASSERT_STREQ("request", reinterpret_cast<char*>(received));
+
+    const unsigned char answer[] = "answer";
+    rtia.send(answer, sizeof(answer));
+    federate.receive(received, sizeof(answer));
+    ASSERT_STREQ("answer", reinterpret_cast<char*>(received));
+}
+
+TEST_F(SocketUNSharedMemoryTest, MessageLargerThanTheRing)
+{
+    std::vector<unsigned char> sent(4 * ::certi::SHMChannel::the_default_capacity + 17);
+    std::iota(begin(sent), end(sent), 0);
+
+    std::thread sender([&] { federate.send(sent.data(), sent.size()); });
+
+    std::vector<unsigned char> received(sent.size());
+    rtia.receive(received.data(), received.size());
+    sender.join();
+
+    ASSERT_EQ(sent, received);
+}
+
+TEST_F(SocketUNSharedMemoryTest, PeersFillingTheirRingsAtOnce)
+{
+    std::vector<unsigned char> sent(4 * ::certi::SHMChannel::the_default_capacity + 17);
+    std::iota(begin(sent), end(sent), 0);
+
+    // Neither peer reads before its own message is sent
+    std::vector<unsigned char> received_by_rtia(sent.size());
+    std::thread other([&] {
+        rtia.send(sent.data(), sent.size());
+        rtia.receive(received_by_rtia.data(), received_by_rtia.size());
+    });
+    federate.send(sent.data(), sent.size());
+
+    std::vector<unsigned char> received(sent.size());
+    federate.receive(received.data(), received.size());
+    other.join();
+
+    ASSERT_EQ(sent, received);
+    ASSERT_EQ(sent, received_by_rtia);
+
+    ASSERT_FALSE(isReadable(federate));
+    ASSERT_FALSE(isReadable(rtia));
+}
+
+TEST_F(SocketUNSharedMemoryTest, DataIsNotCarriedBySocket)
+{
+    const unsigned char data[] = "data";
+    federate.send(data, sizeof(data));
+
+    ASSERT_FALSE(isReadable(rtia));
+    ASSERT_TRUE(rtia.isDataReady());
+}
+
+TEST_F(SocketUNSharedMemoryTest, SocketIsReadableOnlyWhenWaitingForData)
+{
+    ASSERT_FALSE(rtia.isDataReady());
+    ASSERT_FALSE(isReadable(rtia));
+
+    const unsigned char data[] = "data";
+    federate.send(data, sizeof(data));
+    ASSERT_TRUE(isReadable(rtia));
+
+    unsigned char received[sizeof(data)];
+    rtia.receive(received, sizeof(received));
+    ASSERT_STREQ("data", reinterpret_cast<char*>(received));
+
+    // The wake up has been consumed
+    ASSERT_FALSE(isReadable(rtia));
+}
+
+TEST_F(SocketUNSharedMemoryTest, ReceiveThrowsWhenPeerIsGone)
+{
+    int fd = federate.returnSocket();
+    close(fd);
+    federate.setSocketFD(-1);
+
+    unsigned char received[4];
+    ASSERT_THROW(rtia.receive(received, sizeof(received)), ::certi::NetworkError);
+}
+
+TEST_F(SocketUNSharedMemoryTest, SegmentNameIsRemovedOnceAttached)
+{
+    ASSERT_EQ(-1, shm_open(name.c_str(), O_RDWR, 0));
+}
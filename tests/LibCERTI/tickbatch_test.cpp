@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <libCERTI/M_Classes.hh>
+#include <libCERTI/SocketUN.hh>
+#include <libCERTI/TickBatch.hh>
+
+using ::certi::M_Tick_Request;
+using ::certi::Message;
+using ::certi::SocketUN;
+using ::certi::TickBatch;
+
+namespace {
+static constexpr double infinity{std::numeric_limits<double>::infinity()};
+
+/// The federate end of a socketpair, the other one playing the RTIA from a thread.
+class TickBatchTest : public ::testing::Test {
+protected:
+    TickBatchTest() : federate{::certi::stIgnoreSignal}, rtia{::certi::stIgnoreSignal}
+    {
+        rtia.setSocketFD(federate.socketpair());
+    }
+
+    std::unique_ptr<Message> receive()
+    {
+        return std::unique_ptr<Message>(::certi::M_Factory::receive(&rtia));
+    }
+
+    /// Send messages at once, as the RTIA does for a batch.
+    void send(const std::vector<Message*>& messages)
+    {
+        std::vector<unsigned char> bytes;
+        for (auto message : messages) {
+            rtiaBuffer.reset();
+            message->serialize(rtiaBuffer);
+            rtiaBuffer.updateReservedBytes();
+            const unsigned char* data = static_cast<unsigned char*>(rtiaBuffer(0));
+            bytes.insert(end(bytes), data, data + rtiaBuffer.size());
+            delete message;
+        }
+        rtia.send(bytes.data(), bytes.size());
+    }
+
+    static Message* callback(const std::string& label)
+    {
+        auto message = new ::certi::M_Announce_Synchronization_Point();
+        message->setLabel(label);
+        return message;
+    }
+
+    static Message* answer(const bool more)
+    {
+        auto message = new M_Tick_Request();
+        message->setMultiple(more);
+        return message;
+    }
+
+    std::unique_ptr<M_Tick_Request>
+    tick(TickBatch& batch, const bool multiple, const double minimum, const double maximum)
+    {
+        return batch.tick(&federate, federateBuffer, multiple, minimum, maximum, [this](Message& message) {
+            delivered.push_back(message.getLabel());
+        });
+    }
+
+    SocketUN federate;
+    SocketUN rtia;
+    libhla::MessageBuffer federateBuffer;
+    libhla::MessageBuffer rtiaBuffer;
+
+    std::vector<std::string> delivered;
+};
+}
+
+TEST(TickBatch, BudgetIsReadFromEnvironment)
+{
+    unsetenv("CERTI_TICK_BATCH");
+    unsetenv("CERTI_TICK_BATCH_BYTES");
+    ASSERT_FALSE(TickBatch().isEnabled());
+
+    setenv("CERTI_TICK_BATCH", "100", 1);
+    TickBatch batch;
+    ASSERT_TRUE(batch.isEnabled());
+    ASSERT_EQ(100u, batch.getMaxCount());
+    ASSERT_EQ(64u * 1024, batch.getMaxBytes());
+
+    setenv("CERTI_TICK_BATCH_BYTES", "0", 1);
+    ASSERT_EQ(0u, TickBatch().getMaxBytes());
+
+    unsetenv("CERTI_TICK_BATCH");
+    unsetenv("CERTI_TICK_BATCH_BYTES");
+}
+
+TEST_F(TickBatchTest, BatchIsDeliveredBeforeTheAnswer)
+{
+    TickBatch batch(10, 1000);
+
+    std::thread rtiaThread([this] {
+        auto request = receive();
+        ASSERT_EQ(Message::TICK_REQUEST, request->getMessageType());
+        auto& tickRequest = static_cast<M_Tick_Request&>(*request);
+        ASSERT_EQ(10u, tickRequest.getBatchCount());
+        ASSERT_EQ(1000u, tickRequest.getBatchBytes());
+        ASSERT_TRUE(tickRequest.getMultiple());
+
+        send({callback("a"), callback("b"), callback("c"), answer(false)});
+    });
+
+    auto result = tick(batch, true, 0.0, infinity);
+    rtiaThread.join();
+
+    ASSERT_FALSE(result->getMultiple());
+    ASSERT_EQ((std::vector<std::string>{"a", "b", "c"}), delivered);
+    ASSERT_EQ(0u, batch.getPendingCount());
+}
+
+TEST_F(TickBatchTest, NextBatchIsRequestedAfterDelivery)
+{
+    TickBatch batch(2, 0);
+
+    std::thread rtiaThread([this] {
+        receive();
+        send({callback("a"), callback("b"), new ::certi::M_Tick_Request_Next()});
+        ASSERT_EQ(Message::TICK_REQUEST_NEXT, receive()->getMessageType());
+        send({callback("c"), answer(false)});
+    });
+
+    auto result = tick(batch, true, 0.0, infinity);
+    rtiaThread.join();
+
+    ASSERT_FALSE(result->getMultiple());
+    ASSERT_EQ((std::vector<std::string>{"a", "b", "c"}), delivered);
+}
+
+TEST_F(TickBatchTest, DeadlineKeepsCallbacksForTheNextTick)
+{
+    TickBatch batch(3, 0);
+
+    std::thread rtiaThread([this] {
+        receive();
+        send({callback("a"), callback("b"), callback("c"), new ::certi::M_Tick_Request_Next()});
+        ASSERT_EQ(Message::TICK_REQUEST_STOP, receive()->getMessageType());
+        send({answer(true)});
+    });
+
+    // One callback is always delivered
+    auto result = tick(batch, true, 0.0, 0.0);
+    rtiaThread.join();
+
+    ASSERT_TRUE(result->getMultiple());
+    ASSERT_EQ((std::vector<std::string>{"a"}), delivered);
+    ASSERT_EQ(2u, batch.getPendingCount());
+
+    // The RTIA is not asked while pending callbacks are enough
+    result = tick(batch, false, 0.0, 0.0);
+    ASSERT_TRUE(result->getMultiple());
+    ASSERT_EQ((std::vector<std::string>{"a", "b"}), delivered);
+    ASSERT_FALSE(rtia.isDataReady());
+
+    rtiaThread = std::thread([this] {
+        auto request = receive();
+        ASSERT_EQ(Message::TICK_REQUEST, request->getMessageType());
+        // Callbacks were delivered, the RTIA must not wait for others
+        ASSERT_EQ(0.0, static_cast<M_Tick_Request&>(*request).getMinTickTime());
+        send({answer(false)});
+    });
+
+    result = tick(batch, true, 1.0, infinity);
+    rtiaThread.join();
+
+    ASSERT_FALSE(result->getMultiple());
+    ASSERT_EQ((std::vector<std::string>{"a", "b", "c"}), delivered);
+}
+
+TEST_F(TickBatchTest, FailedDeliveryStopsTheRtia)
+{
+    TickBatch batch(3, 0);
+
+    std::thread rtiaThread([this] {
+        receive();
+        send({callback("a"), callback("b"), new ::certi::M_Tick_Request_Next()});
+        ASSERT_EQ(Message::TICK_REQUEST_STOP, receive()->getMessageType());
+        send({answer(true)});
+    });
+
+    ASSERT_THROW(batch.tick(&federate,
+                            federateBuffer,
+                            true,
+                            0.0,
+                            infinity,
+                            [](Message&) { throw ::certi::RTIinternalError("callback failed"); }),
+                 ::certi::RTIinternalError);
+    rtiaThread.join();
+
+    // The failed callback is not delivered again
+    ASSERT_EQ(1u, batch.getPendingCount());
+    ASSERT_FALSE(federate.isDataReady());
+}
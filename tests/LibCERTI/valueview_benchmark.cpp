@@ -0,0 +1,81 @@
+#ifdef BENCHMARK_VALUE_VIEW
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include <libCERTI/M_Classes.hh>
+
+using ::certi::M_Update_Attribute_Values;
+
+namespace {
+static constexpr size_t attributes{4};
+/// Bytes of values serialized per measure, whatever the size of each value.
+static constexpr size_t volume{256 * 1024 * 1024};
+
+/// Building and serializing an update as the 1516 ambassadors do, by copying the values or by viewing them.
+void benchmarkUpdate(const size_t value_size)
+{
+    const std::vector<std::vector<char>> values(attributes, std::vector<char>(value_size, 'v'));
+    const size_t updates{std::max<size_t>(volume / (attributes * value_size), 10)};
+    libhla::MessageBuffer buffer;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t n = 0; n < updates; ++n) {
+        M_Update_Attribute_Values message;
+        message.setAttributesSize(attributes);
+        message.setValuesSize(attributes);
+        for (size_t i = 0; i < attributes; ++i) {
+            message.setAttributes(i + 1, i);
+            ::certi::AttributeValue_t value;
+            value.resize(values[i].size());
+            memcpy(&(value[0]), values[i].data(), values[i].size());
+            message.setValues(value, i);
+        }
+        buffer.reset();
+        message.serialize(buffer);
+    }
+    auto middle = std::chrono::high_resolution_clock::now();
+    const auto copied_size = buffer.size();
+
+    for (size_t n = 0; n < updates; ++n) {
+        M_Update_Attribute_Values message;
+        message.setAttributesSize(attributes);
+        message.setValuesSize(attributes);
+        for (size_t i = 0; i < attributes; ++i) {
+            message.setAttributes(i + 1, i);
+            message.setValuesView(values[i].data(), values[i].size(), i);
+        }
+        buffer.reset();
+        message.serialize(buffer);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    ASSERT_EQ(copied_size, buffer.size());
+
+    std::cerr << "Update of " << attributes << " values of " << value_size << " bytes: copied "
+              << std::chrono::duration_cast<std::chrono::nanoseconds>(middle - start).count() / updates
+              << " ns, viewed " << std::chrono::duration_cast<std::chrono::nanoseconds>(end - middle).count() / updates
+              << " ns" << std::endl;
+}
+}
+
+TEST(ValueViewBenchmark, Values1KB)
+{
+    benchmarkUpdate(1024);
+}
+
+TEST(ValueViewBenchmark, Values64KB)
+{
+    benchmarkUpdate(64 * 1024);
+}
+
+TEST(ValueViewBenchmark, Values1MB)
+{
+    benchmarkUpdate(1024 * 1024);
+}
+
+#endif
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <libCERTI/M_Classes.hh>
+
+using ::certi::AttributeValue_t;
+using ::certi::M_Send_Interaction;
+using ::certi::M_Update_Attribute_Values;
+
+namespace {
+template <typename T>
+T roundTrip(T& message)
+{
+    libhla::MessageBuffer buffer;
+    message.serialize(buffer);
+
+    T received;
+    received.deserialize(buffer);
+    return received;
+}
+
+AttributeValue_t value(const std::string& text)
+{
+    return AttributeValue_t(begin(text), end(text));
+}
+}
+
+TEST(ValueView, ViewsAreSerializedAsValues)
+{
+    const std::string first{"first value"};
+    const std::string empty;
+
+    M_Update_Attribute_Values message;
+    message.setAttributesSize(3);
+    message.setValuesSize(3);
+    message.setValuesView(first.data(), first.size(), 0);
+    message.setValues(value("second value"), 1);
+    message.setValuesView(empty.data(), empty.size(), 2);
+
+    auto received = roundTrip(message);
+    ASSERT_EQ(3u, received.getValuesSize());
+    ASSERT_EQ(value("first value"), received.getValues(0));
+    ASSERT_EQ(value("second value"), received.getValues(1));
+    ASSERT_TRUE(received.getValues(2).empty());
+}
+
+TEST(ValueView, ValueReplacesView)
+{
+    const std::string view{"view"};
+
+    M_Send_Interaction message;
+    message.setParametersSize(2);
+    message.setValuesSize(2);
+    message.setValuesView(view.data(), view.size(), 0);
+    message.setValuesView(view.data(), view.size(), 1);
+    message.setValues(value("value"), 1);
+    message.removeValues(0);
+
+    auto received = roundTrip(message);
+    ASSERT_EQ(1u, received.getValuesSize());
+    ASSERT_EQ(value("value"), received.getValues(0));
+}
+
+TEST(ValueView, DeserializationDropsViews)
+{
+    const std::string view{"view"};
+
+    M_Update_Attribute_Values sent;
+    sent.setValuesSize(1);
+    sent.setValues(value("value"), 0);
+    libhla::MessageBuffer buffer;
+    sent.serialize(buffer);
+
+    M_Update_Attribute_Values message;
+    message.setValuesSize(1);
+    message.setValuesView(view.data(), view.size(), 0);
+    message.deserialize(buffer);
+
+    auto received = roundTrip(message);
+    ASSERT_EQ(value("value"), received.getValues(0));
+}
@@ -0,0 +1,62 @@
+#ifdef BENCHMARK_TSO_QUEUE
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <RTIA/Files.hh>
+#include <libCERTI/NM_Classes.hh>
+
+using ::certi::rtia::Queues;
+
+namespace {
+static constexpr int messages_count{100000};
+}
+
+/// Cost of a burst of TSO reflections with unsorted timestamps, then of delivering them.
+TEST(QueuesBenchmark, InsertAndGive100kTsoMessagesWithRandomTimestamps)
+{
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<double> dates{0.0, 1000.0};
+
+    std::vector<std::unique_ptr<::certi::NetworkMessage>> messages;
+    for (int i{0}; i < messages_count; ++i) {
+        messages.emplace_back(new ::certi::NM_Message_Null);
+        messages.back()->setDate(dates(generator));
+    }
+
+    Queues q;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (auto& msg : messages) {
+        q.insertTsoMessage(msg.get());
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::cerr << "insertTsoMessage of " << messages_count << " messages: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+
+    bool gave{false};
+    bool remaining{false};
+    double previous{0.0};
+    int given{0};
+
+    start = std::chrono::high_resolution_clock::now();
+    while (auto msg = q.giveTsoMessage(1000.0, gave, remaining)) {
+        ASSERT_LE(previous, msg->getDate().getTime());
+        previous = msg->getDate().getTime();
+        ++given;
+    }
+    end = std::chrono::high_resolution_clock::now();
+
+    std::cerr << "giveTsoMessage of " << messages_count << " messages: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+
+    ASSERT_EQ(messages_count, given);
+}
+
+#endif
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include <RTIA/Files.hh>
+#include <libCERTI/NM_Classes.hh>
+
+using ::certi::rtia::Queues;
+
+namespace {
+std::unique_ptr<::certi::NetworkMessage> dated(const double date)
+{
+    std::unique_ptr<::certi::NetworkMessage> msg{new ::certi::NM_Message_Null};
+    msg->setDate(date);
+    return msg;
+}
+}
+
+TEST(QueuesTest, NextTsoDateOfEmptyQueue)
+{
+    Queues q;
+
+    bool found{true};
+    ::certi::FederationTime date{0.0};
+    q.nextTsoDate(found, date);
+
+    ASSERT_FALSE(found);
+    ASSERT_EQ(-1.0, date.getTime());
+}
+
+TEST(QueuesTest, TsoMessagesAreGivenInTimestampOrder)
+{
+    Queues q;
+    auto late = dated(3.0);
+    auto early = dated(1.0);
+    auto middle = dated(2.0);
+    q.insertTsoMessage(late.get());
+    q.insertTsoMessage(early.get());
+    q.insertTsoMessage(middle.get());
+
+    bool found{false};
+    ::certi::FederationTime date{0.0};
+    q.nextTsoDate(found, date);
+    ASSERT_TRUE(found);
+    ASSERT_EQ(1.0, date.getTime());
+
+    bool gave{false};
+    bool remaining{false};
+    ASSERT_EQ(early.get(), q.giveTsoMessage(10.0, gave, remaining));
+    ASSERT_TRUE(gave);
+    ASSERT_TRUE(remaining);
+    ASSERT_EQ(middle.get(), q.giveTsoMessage(10.0, gave, remaining));
+    ASSERT_TRUE(remaining);
+    ASSERT_EQ(late.get(), q.giveTsoMessage(10.0, gave, remaining));
+    ASSERT_TRUE(gave);
+    ASSERT_FALSE(remaining);
+}
+
+TEST(QueuesTest, TsoMessagesWithSameTimestampKeepReceiveOrder)
+{
+    Queues q;
+    std::vector<std::unique_ptr<::certi::NetworkMessage>> messages;
+    for (int i = 0; i < 100; ++i) {
+        messages.push_back(dated(i % 2 == 0 ? 5.0 : 4.0));
+        q.insertTsoMessage(messages.back().get());
+    }
+
+    bool gave{false};
+    bool remaining{false};
+    for (int i = 1; i < 100; i += 2) {
+        ASSERT_EQ(messages[i].get(), q.giveTsoMessage(5.0, gave, remaining));
+    }
+    for (int i = 0; i < 100; i += 2) {
+        ASSERT_EQ(messages[i].get(), q.giveTsoMessage(5.0, gave, remaining));
+    }
+    ASSERT_FALSE(remaining);
+}
+
+TEST(QueuesTest, TsoMessageLaterThanLogicalTimeIsKept)
+{
+    Queues q;
+    auto early = dated(1.0);
+    auto late = dated(3.0);
+    q.insertTsoMessage(late.get());
+    q.insertTsoMessage(early.get());
+
+    bool gave{false};
+    bool remaining{true};
+    ASSERT_EQ(early.get(), q.giveTsoMessage(2.0, gave, remaining));
+    ASSERT_TRUE(gave);
+    ASSERT_FALSE(remaining);
+
+    ASSERT_EQ(nullptr, q.giveTsoMessage(2.0, gave, remaining));
+    ASSERT_FALSE(gave);
+
+    bool found{false};
+    ::certi::FederationTime date{0.0};
+    q.nextTsoDate(found, date);
+    ASSERT_TRUE(found);
+    ASSERT_EQ(3.0, date.getTime());
+}
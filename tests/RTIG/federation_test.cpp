@@ -1,5 +1,15 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <thread>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
 #define TEST_FOR_FEDERATION
 #include <RTIG/Federation.hh>
 
@@ -92,6 +102,19 @@ static const std::string fed_type{"fed_type"};
 
 static constexpr int quiet{0};
 static constexpr int verbose{1};
+
+/// The responses which end the save, once its snapshot is written.
+::certi::Responses waitForSaveResult(Federation& federation)
+{
+    while (federation.getNextSaveCheckTime() != std::chrono::steady_clock::time_point::max()) {
+        auto responses = federation.provideSaveResult(std::chrono::steady_clock::now());
+        if (!responses.empty()) {
+            return responses;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return {};
+}
 }
 
 class FederationTest : public ::testing::Test {
@@ -273,6 +296,66 @@ TEST_F(FederationTest, AddFederateCreateUnderlying)
     ASSERT_EQ("fed", f.getFederate(fed).getName());
 }
 
+TEST_F(FederationTest, JoiningWithoutModulesSendsNoFomToOtherFederates)
+{
+    f.add("fed1", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0);
+    auto responses = f.add("fed2", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0).second;
+
+    for (const auto& response : responses) {
+        ASSERT_NE(::certi::NetworkMessage::Type::ADDITIONAL_FOM_MODULE, response.message()->getMessageType());
+    }
+
+    // The joining federate still gets the whole FOM, from the cache
+    ::certi::NM_Join_Federation_Execution first;
+    f.getFOM(first);
+    ASSERT_LT(0u, first.getObjectClassesSize());
+
+    ::certi::NM_Join_Federation_Execution second;
+    f.getFOM(second);
+    ASSERT_EQ(first.getObjectClassesSize(), second.getObjectClassesSize());
+    ASSERT_EQ(first.getInteractionClassesSize(), second.getInteractionClassesSize());
+}
+
+#ifdef HAVE_XML
+namespace {
+/// Write a 1516-2010 module declaring the object class name.
+void writeModule(const std::string& path, const std::string& name)
+{
+    std::ofstream file(path);
+    file << "<?xml version=\"1.0\"?>" << std::endl
+         << "<objectModel><objects>" << std::endl
+         << "  <objectClass name=\"" << name << "\">" << std::endl
+         << "    <attribute name=\"Value\" transportation=\"HLAreliable\" order=\"TimeStamp\" />" << std::endl
+         << "  </objectClass>" << std::endl
+         << "</objects></objectModel>" << std::endl;
+}
+}
+
+TEST_F(FederationTest, ModulesMergedBeforeAFailingOneAreSentWithTheNextJoin)
+{
+    TemporaryEnvironmentLocation env{"CERTI_FOM_PATH"};
+
+    writeModule(env.path() + "Base.xml", "Base");
+    writeModule(env.path() + "Extra.xml", "Extra");
+
+    Federation f{"modules", federation_handle, s, a, {"Base.xml"}, CERTI_TEST_MIM, ::certi::IEEE_1516_2010, quiet};
+
+    f.add("fed", fed_type, {}, ::certi::IEEE_1516_2010, &federate_socket, 0, 0);
+    ASSERT_ANY_THROW(
+        f.add("fed2", fed_type, {"Extra.xml", "Missing.xml"}, ::certi::IEEE_1516_2010, &federate_socket, 0, 0));
+    auto responses = f.add("fed3", fed_type, {}, ::certi::IEEE_1516_2010, &federate_socket, 0, 0).second;
+
+    // The federates joined before the failure never got the class of the module merged
+    auto it = std::find_if(begin(responses), end(responses), [](const ::certi::MessageEvent<::certi::NetworkMessage>& r) {
+        return r.message()->getMessageType() == ::certi::NetworkMessage::Type::ADDITIONAL_FOM_MODULE;
+    });
+    ASSERT_NE(end(responses), it);
+    auto fom = static_cast<::certi::NM_Additional_Fom_Module*>(it->message());
+    ASSERT_EQ(1u, fom->getObjectClassesSize());
+    ASSERT_EQ("Extra", fom->getObjectClasses(0).getName());
+}
+#endif
+
 TEST_F(FederationTest, CannotAddSameFederateTwice)
 {
     f.add("fed", "typeerate", {}, ::certi::HLA_1_3, &federate_socket, 0, 0);
@@ -869,6 +952,23 @@ TEST_F(FederationTest, PublishInteractionThrowsOnUknFederate)
     ASSERT_THROW(f.publishInteraction(ukn_federate, 1, false), ::certi::FederateNotExecutionMember);
 }
 
+TEST_F(FederationTest, CheckPublishingThrowsOnUknFederate)
+{
+    ASSERT_THROW(f.checkPublishing(ukn_federate, 3), ::certi::FederateNotExecutionMember);
+}
+
+TEST_F(FederationTest, CheckPublishingThrowsUnlessTheFederatePublishes)
+{
+    // InteractionRoot is 1, RTIprivate 2 and Message 3
+    auto federate = f.add("federate", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+
+    ASSERT_THROW(f.checkPublishing(federate, 42), ::certi::InteractionClassNotDefined);
+    ASSERT_THROW(f.checkPublishing(federate, 3), ::certi::InteractionClassNotPublished);
+
+    f.publishInteraction(federate, 3, true);
+    ASSERT_NO_THROW(f.checkPublishing(federate, 3));
+}
+
 TEST_F(FederationTest, PublishObjectThrowsOnUknFederate)
 {
     ASSERT_THROW(f.publishObject(ukn_federate, 1, {}, false), ::certi::FederateNotExecutionMember);
@@ -894,6 +994,42 @@ TEST_F(FederationTest, UpdateAttrValuesThrowsOnUknFederate)
     ASSERT_THROW(f.updateAttributeValues(ukn_federate, 1, {}, {}, 0, ""), ::certi::FederateNotExecutionMember);
 }
 
+TEST_F(FederationTest, UpdateAttrValuesReflectsOncePerFederate)
+{
+    // ObjectRoot is 1, with privilegeToDelete 1, Data is 3, with Attr1 2 and Attr2 3
+    auto publisher = f.add("publisher", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+    auto both_levels = f.add("both_levels", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+    auto data_only = f.add("data_only", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+
+    f.publishObject(publisher, 3, {1, 2, 3}, true);
+    auto object = f.registerObject(publisher, 3, "object").first;
+
+    f.subscribeObject(both_levels, 1, {1}, true);
+    f.subscribeObject(both_levels, 3, {2}, true);
+    f.subscribeObject(data_only, 3, {2, 3}, true);
+
+    auto responses = f.updateAttributeValues(publisher, object, {1, 2, 3}, {{'a'}, {'b'}, {'c'}}, "");
+    ASSERT_EQ(2u, responses.size());
+    std::set<std::vector<::certi::AttributeHandle>> received;
+    for (auto& response : responses) {
+        ASSERT_EQ(1u, response.sockets().size());
+        ASSERT_EQ(::certi::NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES, response.message()->getMessageType());
+        auto* reflect = static_cast<::certi::NM_Reflect_Attribute_Values*>(response.message());
+        for (uint32_t i = 0; i < reflect->getAttributesSize(); ++i) {
+            ASSERT_EQ(::certi::AttributeValue_t(1, 'a' + reflect->getAttributes(i) - 1), reflect->getValues(i));
+        }
+        received.insert(reflect->getAttributes());
+    }
+    ASSERT_EQ(std::set<std::vector<::certi::AttributeHandle>>({{1, 2}, {2, 3}}), received);
+
+    // The routes follow the subscriptions
+    f.subscribeObject(data_only, 3, {}, false);
+    responses = f.updateAttributeValues(publisher, object, {1, 2, 3}, {{'a'}, {'b'}, {'c'}}, "");
+    ASSERT_EQ(1u, responses.size());
+    auto* reflect = static_cast<::certi::NM_Reflect_Attribute_Values*>(responses.front().message());
+    ASSERT_EQ(std::vector<::certi::AttributeHandle>({1, 2}), reflect->getAttributes());
+}
+
 TEST_F(FederationTest, IsOwnerThrowsOnUknFederate)
 {
     ASSERT_THROW(f.isOwner(ukn_federate, 1, 1), ::certi::FederateNotExecutionMember);
@@ -991,6 +1127,108 @@ TEST_F(FederationTest, FederateSaveStatusUpdatesFlagAndUnderlyingFederate)
     ASSERT_FALSE(f.getFederate(handle).isSaving());
 }
 
+TEST_F(FederationTest, RestoreAppliesTheSavedState)
+{
+    auto handle = f.add("fed", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+    f.getFederate(handle).setConstrained(true);
+
+    try {
+        f.requestFederationSave(handle, "save");
+        f.federateSaveStatus(handle, true);
+    }
+    catch (certi::FederateNotExecutionMember& e) {
+        // SocketServer is empty, so we will throw from SocketServer::getWithReferences
+    }
+    waitForSaveResult(f);
+
+    f.getFederate(handle).setConstrained(false);
+
+    try {
+        f.requestFederationRestore(handle, "save");
+    }
+    catch (certi::FederateNotExecutionMember& e) {
+        // SocketServer is empty, so we will throw from SocketServer::getWithReferences
+    }
+
+    std::remove("name_save.snapshot");
+
+    ASSERT_TRUE(f.getFederate(handle).isConstrained());
+}
+
+TEST_F(FederationTest, SaveIsNotReportedBeforeItsSnapshotIsWritten)
+{
+    auto handle = f.add("fed", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+
+    // An older snapshot of the label, and the new one cannot be written where a directory is
+    const auto path = ::certi::rtig::FederationSnapshot::filename("name", "failing");
+    const auto temporary = path + ".tmp";
+    std::ofstream(path) << "older";
+    ASSERT_EQ(0, mkdir(temporary.c_str(), 0700));
+
+    try {
+        f.requestFederationSave(handle, "failing");
+    }
+    catch (certi::FederateNotExecutionMember& e) {
+        // SocketServer is empty, so we will throw from SocketServer::getWithReferences
+    }
+    auto responses = f.federateSaveStatus(handle, true);
+    for (const auto& response : responses) {
+        ASSERT_NE(::certi::NetworkMessage::Type::FEDERATION_SAVED, response.message()->getMessageType());
+    }
+
+    responses = waitForSaveResult(f);
+    rmdir(temporary.c_str());
+
+    ASSERT_EQ(1u, responses.size());
+    ASSERT_EQ(::certi::NetworkMessage::Type::FEDERATION_NOT_SAVED, responses.front().message()->getMessageType());
+
+    // The older snapshot must not be restored instead
+    ASSERT_NE(0, access(path.c_str(), F_OK));
+}
+
+TEST_F(FederationTest, RestoreFailsWithoutSnapshot)
+{
+    auto handle = f.add("fed", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+
+    try {
+        f.requestFederationRestore(handle, "never_saved");
+    }
+    catch (certi::FederateNotExecutionMember& e) {
+        // SocketServer is empty, so we will throw from SocketServer::getWithReferences
+    }
+
+    ASSERT_FALSE(f.getFederate(handle).isRestoring());
+}
+
+TEST_F(FederationTest, RestoreOfAnInvalidSnapshotChangesNothing)
+{
+    using certi::rtig::FederationSnapshot;
+
+    auto handle = f.add("fed", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+
+    // A valid record which would make the federate constrained, then a truncated one
+    FederationSnapshot::Records records;
+    FederationSnapshot::Encoder valid;
+    valid.string("fed").uint8(true).uint8(false).uint8(false).real(0.0).uint8(false).real(0.0);
+    for (int i = 0; i < 8; ++i) {
+        valid.uint8(false);
+    }
+    records[{FederationSnapshot::Kind::Federate, handle}] = valid.bytes();
+    records[{FederationSnapshot::Kind::Federate, handle + 1}] = FederationSnapshot::Encoder().string("fed").bytes();
+    ASSERT_NE(0u, FederationSnapshot::write("name", "invalid", "", 0, records, {}));
+
+    try {
+        f.requestFederationRestore(handle, "invalid");
+    }
+    catch (certi::FederateNotExecutionMember& e) {
+        // SocketServer is empty, so we will throw from SocketServer::getWithReferences
+    }
+
+    std::remove(FederationSnapshot::filename("name", "invalid").c_str());
+
+    ASSERT_FALSE(f.getFederate(handle).isConstrained());
+}
+
 TEST_F(FederationTest, FederateRestoreStatusThrowsOnUknFederate)
 {
     ASSERT_THROW(f.federateRestoreStatus(ukn_federate, true), ::certi::FederateNotExecutionMember);
@@ -1006,3 +1244,35 @@ TEST_F(FederationTest, updateLastNERxForFederateThrowsOnUknFederate)
 {
     ASSERT_THROW(f.updateLastNERxForFederate(ukn_federate, {}), ::certi::FederateNotExecutionMember);
 }
+
+TEST_F(FederationTest, MinNERxNeedsTwoNERingRegulators)
+{
+    std::vector<::certi::FederateHandle> regulators;
+    for (auto name : {"fed1", "fed2", "fed3"}) {
+        auto fed = f.add(name, fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+        try {
+            f.addRegulator(fed, {});
+        }
+        catch (certi::FederateNotExecutionMember& e) {
+            // SocketServer is empty, but the regulator is registered
+        }
+        regulators.push_back(fed);
+    }
+
+    ASSERT_FALSE(f.updateLastNERxForFederate(regulators[0], 5.0));
+    ASSERT_EQ(::certi::FederationTime{}, f.computeMinNERx());
+
+    // Not NERing regulator's clock is still the minimum
+    ASSERT_FALSE(f.updateLastNERxForFederate(regulators[1], 3.0));
+    ASSERT_EQ(::certi::FederationTime{}, f.computeMinNERx());
+
+    ASSERT_TRUE(f.updateLastNERxForFederate(regulators[2], 4.0));
+    ASSERT_EQ(::certi::FederationTime(3.0), f.getMinNERx());
+
+    // A new minimum resets every federate's NERx status
+    for (auto fed : regulators) {
+        ASSERT_FALSE(f.getFederate(fed).isUsingNERx());
+    }
+    ASSERT_FALSE(f.updateLastNERxForFederate(regulators[0], 6.0));
+    ASSERT_EQ(::certi::FederationTime{}, f.computeMinNERx());
+}
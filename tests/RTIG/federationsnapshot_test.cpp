@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <RTIG/FederationSnapshot.hh>
+#include <libCERTI/Exception.hh>
+
+using ::certi::rtig::FederationSnapshot;
+using ::certi::rtig::SnapshotWriter;
+
+using Kind = FederationSnapshot::Kind;
+using Records = FederationSnapshot::Records;
+
+namespace {
+static const std::string federation{"snapshot_test"};
+
+/// Remove the snapshots of the labels written by a test.
+class FederationSnapshotTest : public ::testing::Test {
+protected:
+    ~FederationSnapshotTest()
+    {
+        for (const auto& label : {"a", "b", "c", "d"}) {
+            std::remove(FederationSnapshot::filename(federation, label).c_str());
+        }
+    }
+
+    static std::string readFile(const std::string& label)
+    {
+        std::ifstream file(FederationSnapshot::filename(federation, label), std::ios::binary);
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    static std::string record(const std::string& value)
+    {
+        return FederationSnapshot::Encoder().string(value).bytes();
+    }
+
+    static Records records(const uint64_t count, const std::string& value)
+    {
+        Records result;
+        for (uint64_t id = 1; id <= count; ++id) {
+            result[{Kind::Object, id}] = record(value + std::to_string(id));
+        }
+        return result;
+    }
+};
+}
+
+TEST(FederationSnapshotCodingTest, FieldsRoundTrip)
+{
+    FederationSnapshot::Encoder encoder;
+    encoder.uint8(7).uint32(0xdeadbeef).uint64(0x0123456789abcdefull).real(-2.5).string("label").string("");
+
+    // Network byte order
+    ASSERT_EQ('\xde', encoder.bytes()[1]);
+
+    FederationSnapshot::Decoder decoder(encoder.bytes());
+    ASSERT_EQ(7u, decoder.uint8());
+    ASSERT_EQ(0xdeadbeefu, decoder.uint32());
+    ASSERT_EQ(0x0123456789abcdefull, decoder.uint64());
+    ASSERT_EQ(-2.5, decoder.real());
+    ASSERT_EQ("label", decoder.string());
+    ASSERT_EQ("", decoder.string());
+    ASSERT_TRUE(decoder.atEnd());
+}
+
+TEST(FederationSnapshotCodingTest, ReadingPastTheEndThrows)
+{
+    auto bytes = FederationSnapshot::Encoder().string("label").bytes();
+
+    FederationSnapshot::Decoder decoder(bytes.substr(0, bytes.size() - 1));
+    ASSERT_THROW(decoder.string(), ::certi::RTIinternalError);
+
+    FederationSnapshot::Decoder empty(bytes.data(), 0);
+    ASSERT_THROW(empty.uint8(), ::certi::RTIinternalError);
+}
+
+TEST_F(FederationSnapshotTest, FullSnapshotRoundTrip)
+{
+    auto saved = records(100, "object");
+    saved[{Kind::Federate, 1}] = record("federate");
+
+    ASSERT_NE(0u, FederationSnapshot::write(federation, "a", "", 0, saved, {}));
+    ASSERT_EQ(saved, FederationSnapshot::load(federation, "a"));
+}
+
+TEST_F(FederationSnapshotTest, DeltaIsAppliedOverItsBase)
+{
+    auto base = records(100, "object");
+    auto identifier = FederationSnapshot::write(federation, "a", "", 0, base, {});
+    ASSERT_NE(0u, identifier);
+
+    Records changed{{{Kind::Object, 3}, record("changed")}, {{Kind::Region, 1}, record("region")}};
+    ASSERT_NE(0u, FederationSnapshot::write(federation, "b", "a", identifier, changed, {{Kind::Object, 4}}));
+
+    auto expected = base;
+    expected[{Kind::Object, 3}] = record("changed");
+    expected[{Kind::Region, 1}] = record("region");
+    expected.erase({Kind::Object, 4});
+
+    ASSERT_EQ(expected, FederationSnapshot::load(federation, "b"));
+    ASSERT_EQ(base, FederationSnapshot::load(federation, "a"));
+}
+
+TEST_F(FederationSnapshotTest, MissingOrInvalidSnapshotThrows)
+{
+    ASSERT_THROW(FederationSnapshot::load(federation, "a"), ::certi::RTIinternalError);
+
+    // A delta whose base is missing, then saved again
+    ASSERT_NE(0u, FederationSnapshot::write(federation, "b", "a", 1, records(1, "object"), {}));
+    ASSERT_THROW(FederationSnapshot::load(federation, "b"), ::certi::RTIinternalError);
+
+    ASSERT_NE(0u, FederationSnapshot::write(federation, "a", "", 0, records(10, "object"), {}));
+    ASSERT_THROW(FederationSnapshot::load(federation, "b"), ::certi::RTIinternalError);
+
+    auto content = readFile("a");
+    {
+        std::ofstream file(FederationSnapshot::filename(federation, "a"), std::ios::binary);
+        file << content.substr(0, content.size() - 5);
+    }
+    ASSERT_THROW(FederationSnapshot::load(federation, "a"), ::certi::RTIinternalError);
+
+    // A snapshot saved under another label
+    {
+        std::ofstream file(FederationSnapshot::filename(federation, "c"), std::ios::binary);
+        file << readFile("b");
+    }
+    ASSERT_THROW(FederationSnapshot::load(federation, "c"), ::certi::RTIinternalError);
+}
+
+TEST_F(FederationSnapshotTest, WriterChainsDeltas)
+{
+    SnapshotWriter writer(federation, 2);
+
+    writer.save("a", records(1000, "object"));
+    auto b = records(1000, "object");
+    b[{Kind::Object, 500}] = record("moved");
+    writer.save("b", b);
+    auto c = b;
+    c.erase({Kind::Object, 1});
+    writer.save("c", c);
+    ASSERT_TRUE(writer.flush());
+
+    ASSERT_EQ(b, FederationSnapshot::load(federation, "b"));
+    ASSERT_EQ(c, FederationSnapshot::load(federation, "c"));
+
+    // Only the changes are written
+    ASSERT_LT(readFile("b").size() * 10, readFile("a").size());
+    ASSERT_LT(readFile("c").size() * 10, readFile("a").size());
+
+    // The chain is full, a full snapshot starts the next one
+    writer.save("d", c);
+    ASSERT_TRUE(writer.flush());
+    ASSERT_GT(readFile("d").size() * 2, readFile("a").size());
+    ASSERT_EQ(c, FederationSnapshot::load(federation, "d"));
+}
+
+TEST_F(FederationSnapshotTest, SavingALabelOfTheChainAgainWritesItFull)
+{
+    SnapshotWriter writer(federation, 16);
+
+    writer.save("a", records(100, "object"));
+    writer.save("b", records(100, "changed"));
+    writer.save("a", records(50, "again"));
+    ASSERT_TRUE(writer.flush());
+
+    // b cannot be based on the new a, which is written full
+    ASSERT_EQ(records(50, "again"), FederationSnapshot::load(federation, "a"));
+    ASSERT_THROW(FederationSnapshot::load(federation, "b"), ::certi::RTIinternalError);
+}
+
+TEST(SnapshotWriter, MaxDeltasIsReadFromEnvironment)
+{
+    unsetenv("CERTI_SAVE_DELTAS");
+    ASSERT_EQ(16u, SnapshotWriter(federation).getMaxDeltas());
+
+    setenv("CERTI_SAVE_DELTAS", "0", 1);
+    ASSERT_EQ(0u, SnapshotWriter(federation).getMaxDeltas());
+
+    unsetenv("CERTI_SAVE_DELTAS");
+}
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <RTIG/FederationWorkers.hh>
+
+#include <libCERTI/NM_Classes.hh>
+
+using ::certi::rtig::FederationWorkers;
+using ::certi::MessageEvent;
+using ::certi::NetworkMessage;
+
+namespace {
+MessageEvent<NetworkMessage> nullMessage(const ::certi::Handle federation, const ::certi::FederateHandle federate)
+{
+    auto message = new ::certi::NM_Message_Null;
+    message->setFederation(federation);
+    message->setFederate(federate);
+    return MessageEvent<NetworkMessage>(nullptr, std::unique_ptr<NetworkMessage>(message));
+}
+}
+
+TEST(FederationWorkersTest, DrainWaitsForEveryDispatchedEvent)
+{
+    std::mutex mutex;
+    int processed{0};
+
+    FederationWorkers w(4, [&](MessageEvent<NetworkMessage>&&, MessageBuffer&) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        std::lock_guard<std::mutex> lock(mutex);
+        ++processed;
+    });
+
+    for (auto i(0u); i < 50; ++i) {
+        w.dispatch(nullMessage(i % 5 + 1, i));
+    }
+    w.drain();
+
+    ASSERT_EQ(50, processed);
+}
+
+TEST(FederationWorkersTest, EventsOfAFederationAreProcessedInOrderByOneThread)
+{
+    std::mutex mutex;
+    std::map<::certi::Handle, std::vector<::certi::FederateHandle>> order;
+    std::map<::certi::Handle, std::thread::id> threads;
+    bool sameThread{true};
+
+    FederationWorkers w(3, [&](MessageEvent<NetworkMessage>&& event, MessageBuffer&) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto federation = event.message()->getFederation();
+        order[federation].push_back(event.message()->getFederate());
+
+        auto it = threads.emplace(federation, std::this_thread::get_id()).first;
+        sameThread = sameThread && (it->second == std::this_thread::get_id());
+    });
+
+    for (auto i(0u); i < 300; ++i) {
+        w.dispatch(nullMessage(i % 7 + 1, i));
+    }
+    w.drain();
+
+    ASSERT_TRUE(sameThread);
+    ASSERT_EQ(7u, order.size());
+    for (const auto& kv : order) {
+        ASSERT_TRUE(std::is_sorted(begin(kv.second), end(kv.second)));
+        ASSERT_EQ(300u / 7 + (kv.first <= 300 % 7 ? 1 : 0), kv.second.size());
+    }
+}
+
+TEST(FederationWorkersTest, DestructorProcessesPendingEvents)
+{
+    std::atomic<int> processed{0};
+
+    {
+        FederationWorkers w(2, [&](MessageEvent<NetworkMessage>&&, MessageBuffer&) { ++processed; });
+
+        for (auto i(0u); i < 20; ++i) {
+            w.dispatch(nullMessage(i % 2 + 1, i));
+        }
+    }
+
+    ASSERT_EQ(20, processed);
+}
+
+TEST(FederationWorkersTest, HandlerExceptionsDoNotStopTheWorker)
+{
+    std::atomic<int> processed{0};
+
+    FederationWorkers w(1, [&](MessageEvent<NetworkMessage>&& event, MessageBuffer&) {
+        ++processed;
+        switch (event.message()->getFederate()) {
+        case 0:
+            throw ::certi::RTIinternalError("test");
+        case 1:
+            throw std::runtime_error("test");
+        case 2:
+            throw 42;
+        }
+    });
+
+    for (auto i(0u); i < 4; ++i) {
+        w.dispatch(nullMessage(1, i));
+    }
+    w.drain();
+
+    ASSERT_EQ(4, processed);
+}
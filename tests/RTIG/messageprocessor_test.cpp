@@ -295,6 +295,37 @@ TEST_F(MessageProcessorTest, Process_NM_Send_Interaction_Empty)
     ASSERT_ANY_THROW(mp.processEvent({nullptr, std::move(message)}););
 }
 
+TEST_F(MessageProcessorTest, Process_NM_Update_Attribute_Values_Pipelined_AnswersFailureWithSequence)
+{
+    auto message = make_unique<::certi::NM_Update_Attribute_Values>();
+    message->setFederate(3);
+    message->setSequence(42);
+
+    auto responses = mp.processEvent({nullptr, std::move(message)});
+
+    ASSERT_EQ(1u, responses.size());
+    auto rep = static_cast<::certi::NM_Update_Attribute_Values*>(responses.front().message());
+    ASSERT_EQ(::certi::Exception::Type::FederationExecutionDoesNotExist, rep->getException());
+    ASSERT_EQ(3u, rep->getFederate());
+    ASSERT_TRUE(rep->hasSequence());
+    ASSERT_EQ(42u, rep->getSequence());
+}
+
+TEST_F(MessageProcessorTest, Process_NM_Send_Interaction_Pipelined_AnswersFailureWithSequence)
+{
+    auto message = make_unique<::certi::NM_Send_Interaction>();
+    message->setFederate(3);
+    message->setSequence(7);
+
+    auto responses = mp.processEvent({nullptr, std::move(message)});
+
+    ASSERT_EQ(1u, responses.size());
+    auto rep = static_cast<::certi::NM_Send_Interaction*>(responses.front().message());
+    ASSERT_EQ(::certi::Exception::Type::FederationExecutionDoesNotExist, rep->getException());
+    ASSERT_TRUE(rep->hasSequence());
+    ASSERT_EQ(7u, rep->getSequence());
+}
+
 TEST_F(MessageProcessorTest, Process_NM_Delete_Object_Empty)
 {
     auto message = make_unique<::certi::NM_Delete_Object>();
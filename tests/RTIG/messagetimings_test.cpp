@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <signal.h>
+
+#include <RTIG/MessageTimings.hh>
+
+using ::certi::NetworkMessage;
+using ::certi::rtig::MessageTimings;
+
+using Histogram = MessageTimings::Histogram;
+
+namespace {
+static const std::string path{"timings_test.json"};
+
+std::string readFile(const std::string& name)
+{
+    std::ifstream file(name);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+}
+
+TEST(MessageTimingsHistogramTest, SmallValuesHaveTheirOwnBucket)
+{
+    for (uint64_t value = 0; value < 8; ++value) {
+        ASSERT_EQ(value, Histogram::bucketOf(value));
+        ASSERT_EQ(value, Histogram::bucketUpperBound(value));
+    }
+}
+
+TEST(MessageTimingsHistogramTest, BucketsAreContiguous)
+{
+    for (size_t bucket = 1; bucket < Histogram::the_bucket_count - 1; ++bucket) {
+        auto lowest = Histogram::bucketUpperBound(bucket - 1) + 1;
+        ASSERT_EQ(bucket, Histogram::bucketOf(lowest));
+        ASSERT_EQ(bucket, Histogram::bucketOf(Histogram::bucketUpperBound(bucket)));
+    }
+}
+
+TEST(MessageTimingsHistogramTest, BucketsAreWithinAnEighth)
+{
+    for (uint64_t value = 8; value < (1ull << 40); value = value * 3 / 2) {
+        auto upper = Histogram::bucketUpperBound(Histogram::bucketOf(value));
+        ASSERT_LE(value, upper);
+        ASSERT_LE(upper - value, value / 8);
+    }
+}
+
+TEST(MessageTimingsHistogramTest, LongValuesGoToTheLastBucket)
+{
+    ASSERT_EQ(Histogram::the_bucket_count - 1, Histogram::bucketOf(UINT64_MAX));
+}
+
+TEST(MessageTimingsHistogramTest, Quantiles)
+{
+    Histogram h;
+    ASSERT_EQ(0u, h.valueAtQuantile(0.5));
+
+    for (uint64_t value = 1; value <= 1000; ++value) {
+        h.record(value);
+    }
+
+    ASSERT_EQ(1000u, h.count());
+    ASSERT_EQ(1u, h.min());
+    ASSERT_EQ(1000u, h.max());
+    ASSERT_EQ(500500u, h.sum());
+
+    auto median = h.valueAtQuantile(0.5);
+    ASSERT_GE(median, 500u);
+    ASSERT_LE(median, 500u + 500u / 8);
+    ASSERT_EQ(1000u, h.valueAtQuantile(1.0));
+}
+
+TEST(MessageTimingsHistogramTest, ConcurrentRecords)
+{
+    Histogram h;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&h] {
+            for (uint64_t value = 0; value < 10000; ++value) {
+                h.record(value);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(40000u, h.count());
+    ASSERT_EQ(0u, h.min());
+    ASSERT_EQ(9999u, h.max());
+}
+
+TEST(MessageTimingsTest, RecordsPerTypeAndStage)
+{
+    MessageTimings timings{path, std::chrono::seconds(0)};
+    timings.record(NetworkMessage::Type::MESSAGE_NULL, MessageTimings::Stage::Process, std::chrono::microseconds(3));
+
+    ASSERT_EQ(1u, timings.histogram(NetworkMessage::Type::MESSAGE_NULL, MessageTimings::Stage::Process).count());
+    ASSERT_EQ(0u, timings.histogram(NetworkMessage::Type::MESSAGE_NULL, MessageTimings::Stage::Send).count());
+    ASSERT_EQ(0u,
+              timings.histogram(NetworkMessage::Type::UPDATE_ATTRIBUTE_VALUES, MessageTimings::Stage::Process).count());
+}
+
+TEST(MessageTimingsTest, DumpOnlyHoldsRecordedHistograms)
+{
+    MessageTimings timings{path, std::chrono::seconds(0)};
+    timings.record(NetworkMessage::Type::MESSAGE_NULL, MessageTimings::Stage::Receive, std::chrono::nanoseconds(100));
+
+    std::stringstream dump;
+    timings.dump(dump);
+
+    auto content = dump.str();
+    ASSERT_NE(std::string::npos, content.find("\"stage\": \"receive\""));
+    ASSERT_NE(std::string::npos, content.find("\"count\": 1"));
+    ASSERT_EQ(std::string::npos, content.find("\"stage\": \"process\""));
+}
+
+TEST(MessageTimingsTest, DumpedAtDestruction)
+{
+    std::remove(path.c_str());
+    {
+        MessageTimings timings{path, std::chrono::seconds(0)};
+        timings.record(NetworkMessage::Type::MESSAGE_NULL, MessageTimings::Stage::Send, std::chrono::nanoseconds(10));
+    }
+    ASSERT_NE(std::string::npos, readFile(path).find("\"stage\": \"send\""));
+    std::remove(path.c_str());
+}
+
+TEST(MessageTimingsTest, DumpedOnSIGUSR1)
+{
+    std::remove(path.c_str());
+
+    sigset_t previous;
+    pthread_sigmask(SIG_SETMASK, nullptr, &previous);
+    {
+        MessageTimings timings{path, std::chrono::seconds(0)};
+        timings.startDumping();
+        timings.record(NetworkMessage::Type::MESSAGE_NULL, MessageTimings::Stage::Send, std::chrono::nanoseconds(10));
+
+        kill(getpid(), SIGUSR1);
+        for (int i = 0; i < 1000 && readFile(path).empty(); ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        ASSERT_NE(std::string::npos, readFile(path).find("\"stage\": \"send\""));
+    }
+    pthread_sigmask(SIG_SETMASK, &previous, nullptr);
+
+    std::remove(path.c_str());
+}
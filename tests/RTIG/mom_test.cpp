@@ -7,9 +7,16 @@
 #include <libCERTI/ObjectClassSet.hh>
 #include <libCERTI/RootObject.hh>
 
+#include <libCERTI/InteractionSet.hh>
+#include <libCERTI/NM_Classes.hh>
+
 #include "../mocks/sockettcp_mock.h"
 #include "../fakes/socketserver_fake.h"
 
+#include <chrono>
+#include <cstring>
+#include <tuple>
+
 // using ::testing::_;
 
 using ::certi::rtig::Federation;
@@ -22,6 +29,13 @@ static const ::certi::FederationHandle federation_handle{1};
 static const std::string fed_type{"fed_type"};
 
 // static const ::certi::FederateHandle ukn_federate{42};
+
+::certi::ParameterValue_t uint32Value(const uint32_t value)
+{
+    ::certi::ParameterValue_t result(sizeof(value));
+    std::memcpy(&result[0], &value, sizeof(value));
+    return result;
+}
 }
 
 class MomTest : public ::testing::Test {
@@ -44,6 +58,26 @@ protected:
     ::certi::ObjectClassHandle federationOCH{
         f.getRootObject().ObjectClasses->getHandleFromName("HLAmanager.HLAfederation")};
     ::certi::ObjectClass* federationOC{f.getRootObject().ObjectClasses->getObjectFromHandle(federationOCH)};
+
+    ::certi::AttributeHandle attributeOfFederate(const std::string& name)
+    {
+        return f.getRootObject().ObjectClasses->getAttributeHandle(name, federateOCH);
+    }
+
+    /// Send the HLAsetTiming interaction as federate.
+    void setReportPeriod(const ::certi::FederateHandle federate, const uint32_t period)
+    {
+        auto setTiming
+            = f.getRootObject().Interactions->getInteractionClassHandle("HLAmanager.HLAfederate.HLAadjust.HLAsetTiming");
+        f.publishInteraction(federate, setTiming, true);
+        f.broadcastInteraction(federate,
+                               setTiming,
+                               {f.getRootObject().Interactions->getParameterHandle("HLAfederate", setTiming),
+                                f.getRootObject().Interactions->getParameterHandle("HLAreportPeriod", setTiming)},
+                               {uint32Value(federate), uint32Value(period)},
+                               0,
+                               "");
+    }
 };
 
 // Overview, TODO check it is checked by other test cases
@@ -201,4 +235,49 @@ TEST_F(MomTest, 11_4_1_l_The_RTI_shall_always_supply_all_pre_defined_parameters_
     // ok
 }
 
+TEST_F(MomTest, PeriodicAttributesAreNotReportedWithoutReportPeriod)
+{
+    ::certi::FederateHandle federate;
+    std::tie(federate, std::ignore) = f.add("fed", fed_type, {}, ::certi::IEEE_1516_2010, &federate_socket, 0, 0);
+
+    f.updateTimeState(federate, 1.0, 0.0, false, 0.0, 0.0);
+    ASSERT_EQ(std::chrono::steady_clock::time_point::max(), f.getNextMomReportTime());
+    ASSERT_TRUE(f.provideMomReports(std::chrono::steady_clock::now() + std::chrono::hours(1)).empty());
+}
+
+TEST_F(MomTest, PeriodicAttributesAreReportedOncePerReportPeriod)
+{
+    ::certi::FederateHandle federate, subscriber;
+    std::tie(federate, std::ignore) = f.add("fed", fed_type, {}, ::certi::IEEE_1516_2010, &federate_socket, 0, 0);
+    std::tie(subscriber, std::ignore) = f.add("fed2", fed_type, {}, ::certi::IEEE_1516_2010, &federate_socket, 0, 0);
+
+    auto logicalTime = attributeOfFederate("HLAlogicalTime");
+    auto updatesSent = attributeOfFederate("HLAupdatesSent");
+    f.subscribeObject(subscriber, federateOCH, {logicalTime, updatesSent}, true);
+
+    auto start = std::chrono::steady_clock::now();
+    f.updateTimeState(federate, 1.0, 0.0, false, 0.0, 0.0);
+    setReportPeriod(federate, 2);
+
+    // The changes are coalesced until the end of the period
+    f.updateTimeState(federate, 2.0, 0.0, false, 0.0, 0.0);
+    auto report = f.getNextMomReportTime();
+    ASSERT_LE(start + std::chrono::seconds(2), report);
+    ASSERT_GE(std::chrono::steady_clock::now() + std::chrono::seconds(2), report);
+    ASSERT_TRUE(f.provideMomReports(report - std::chrono::milliseconds(1)).empty());
+
+    // Only the changed attributes are reported
+    auto responses = f.provideMomReports(report);
+    ASSERT_EQ(1u, responses.size());
+    auto reflect = dynamic_cast<::certi::NM_Reflect_Attribute_Values*>(responses.front().message());
+    ASSERT_NE(nullptr, reflect);
+    ASSERT_EQ(std::vector<::certi::AttributeHandle>{logicalTime}, reflect->getAttributes());
+
+    // Nothing changed since
+    ASSERT_EQ(std::chrono::steady_clock::time_point::max(), f.getNextMomReportTime());
+
+    f.updateTimeState(federate, 3.0, 0.0, false, 0.0, 0.0);
+    ASSERT_EQ(report + std::chrono::seconds(2), f.getNextMomReportTime());
+}
+
 #endif
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <libCERTI/SocketTCP.hh>
+
+/// A never connected TCP socket reporting a chosen file descriptor.
+class FakeSocketTcp : public ::certi::SocketTCP {
+public:
+    explicit FakeSocketTcp(const SOCKET fd) : my_fd{fd}
+    {
+    }
+
+    virtual SOCKET returnSocket() override
+    {
+        return my_fd;
+    }
+
+private:
+    SOCKET my_fd;
+};